@@ -23,6 +23,8 @@ class API {
         bool write_vk{ false };    // should we addditionally write the verification key when writing the proof
         bool include_gates_per_opcode{ false }; // should we include gates_per_opcode in the gates command output
         bool slow_low_memory{ false };          // use file backed memory for polynomials
+        size_t low_memory_max_resident_mb{ 0 }; // cap on prefetched file backed memory, 0 for none
+        std::string numa_policy;                // NUMA placement of polynomials and threads (see common/numa.hpp)
         bool update_inputs{ false };            // update inputs when check fails
 
         friend std::ostream& operator<<(std::ostream& os, const Flags& flags)
@@ -40,6 +42,8 @@ class API {
                << "  write_vk " << flags.write_vk << "\n"
                << "  include_gates_per_opcode " << flags.include_gates_per_opcode << "\n"
                << "  slow_low_memory " << flags.slow_low_memory << "\n"
+               << "  low_memory_max_resident_mb " << flags.low_memory_max_resident_mb << "\n"
+               << "  numa_policy " << flags.numa_policy << "\n"
                << "]" << std::endl;
             return os;
         }
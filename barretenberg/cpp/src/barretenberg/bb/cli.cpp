@@ -22,11 +22,14 @@
 #include "barretenberg/api/prove_tube.hpp"
 #include "barretenberg/bb/cli11_formatter.hpp"
 #include "barretenberg/bbapi/bbapi.hpp"
+#include "barretenberg/bbapi/bbapi_daemon.hpp"
 #include "barretenberg/bbapi/bbapi_ultra_honk.hpp"
 #include "barretenberg/bbapi/c_bind.hpp"
+#include "barretenberg/common/numa.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/flavor/ultra_rollup_flavor.hpp"
+#include "barretenberg/polynomials/backing_memory.hpp"
 #include "barretenberg/srs/factories/native_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include <fstream>
@@ -278,6 +281,25 @@ int parse_and_run_cli_command(int argc, char* argv[])
             "--slow_low_memory", flags.slow_low_memory, "Enable low memory mode (can be 2x slower or more).");
     };
 
+    const auto add_low_memory_max_resident_option = [&](CLI::App* subcommand) {
+        return subcommand->add_option("--low_memory_max_resident_mb",
+                                      flags.low_memory_max_resident_mb,
+                                      "With --slow_low_memory, the most file backed polynomial memory (in MB) to keep "
+                                      "prefetched in RAM before evicting it back to disk. Defaults to the "
+                                      "BB_LOW_MEMORY_MAX_RESIDENT_MB environment variable, or no limit.");
+    };
+
+    const auto add_numa_option = [&](CLI::App* subcommand) {
+        return subcommand
+            ->add_option("--numa",
+                         flags.numa_policy,
+                         "NUMA placement of polynomial memory and worker threads on multi-socket machines. "
+                         "interleave spreads every large polynomial over all nodes, partition gives each node a "
+                         "contiguous part of each polynomial and the threads that process it. Defaults to the "
+                         "BB_NUMA_POLICY environment variable, or none. Has no effect on single node machines.")
+            ->check(CLI::IsMember({ "none", "interleave", "partition" }).name("is_member"));
+    };
+
     const auto add_update_inputs_flag = [&](CLI::App* subcommand) {
         return subcommand->add_flag("--update_inputs", flags.update_inputs, "Update inputs if vk check fails.");
     };
@@ -351,6 +373,8 @@ int parse_and_run_cli_command(int argc, char* argv[])
     add_ipa_accumulation_flag(prove);
     remove_zk_option(prove);
     add_slow_low_memory_flag(prove);
+    add_low_memory_max_resident_option(prove);
+    add_numa_option(prove);
     add_print_op_counts_flag(prove);
     add_op_counts_out_option(prove);
 
@@ -519,6 +543,31 @@ int parse_and_run_cli_command(int argc, char* argv[])
     msgpack_run_command->add_option(
         "-i,--input", msgpack_input_file, "Input file containing msgpack buffers (defaults to stdin)");
 
+    // Subcommand: msgpack serve
+    CLI::App* msgpack_serve_command = msgpack_command->add_subcommand(
+        "serve", "Serve msgpack API commands over a Unix socket, keeping the CRS and caches warm between requests.");
+    add_verbose_flag(msgpack_serve_command);
+    add_debug_flag(msgpack_serve_command);
+    add_crs_path_option(msgpack_serve_command);
+    bbapi::DaemonSettings daemon_settings;
+    size_t daemon_memory_budget_mb = 0;
+    msgpack_serve_command->add_option("--socket", daemon_settings.socket_path, "Path of the Unix socket to listen on.")
+        ->required();
+    msgpack_serve_command
+        ->add_option("--max_concurrent_requests",
+                     daemon_settings.max_concurrent_requests,
+                     "Most requests to execute at the same time. They share the worker threads.")
+        ->check(CLI::PositiveNumber);
+    msgpack_serve_command->add_option("--memory_budget_mb",
+                                      daemon_memory_budget_mb,
+                                      "Most memory (in MB) that concurrent requests may need together, by their "
+                                      "estimates. Requests wait until it is available. Defaults to no limit.");
+    msgpack_serve_command->add_option(
+        "--vk_cache_size", daemon_settings.vk_cache_size, "Most verification keys to keep cached across requests.");
+    msgpack_serve_command->add_option("--srs_points",
+                                      daemon_settings.srs_points,
+                                      "Number of CRS points to load at startup, rather than on the first request.");
+
     /***************************************************************************************************************
      * Subcommand: prove_tube
      ***************************************************************************************************************/
@@ -558,6 +607,13 @@ int parse_and_run_cli_command(int argc, char* argv[])
     debug_logging = flags.debug;
     verbose_logging = debug_logging || flags.verbose;
     slow_low_memory = flags.slow_low_memory;
+    if (flags.low_memory_max_resident_mb != 0) {
+        file_backed_memory::set_max_resident_bytes(flags.low_memory_max_resident_mb << 20);
+    }
+    // Must happen before the first parallel_for, which starts (and pins) the worker threads
+    if (!flags.numa_policy.empty()) {
+        numa::set_policy(numa::parse_policy(flags.numa_policy));
+    }
 #ifndef __wasm__
     if (print_op_counts || !op_counts_out.empty()) {
         bb::detail::use_op_count_time = true;
@@ -612,6 +668,12 @@ int parse_and_run_cli_command(int argc, char* argv[])
         if (msgpack_run_command->parsed()) {
             return execute_msgpack_run(msgpack_input_file);
         }
+#ifndef __wasm__
+        if (msgpack_serve_command->parsed()) {
+            daemon_settings.memory_budget_bytes = daemon_memory_budget_mb << 20;
+            return bbapi::execute_msgpack_serve(daemon_settings);
+        }
+#endif
         // TUBE
         if (prove_tube_command->parsed()) {
             // TODO(https://github.com/AztecProtocol/barretenberg/issues/1201): Potentially remove this extra logic.
@@ -0,0 +1,390 @@
+#ifndef __wasm__
+#include "barretenberg/bbapi/bbapi_daemon.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+namespace bb::bbapi {
+
+namespace {
+// Floor of the memory estimate, covering the fixed costs of a proof
+constexpr size_t MIN_REQUEST_MEMORY_BYTES = 256UL << 20;
+// Ratio of proving memory to serialized circuit and witness size. Loose, gates per opcode vary a lot.
+constexpr size_t MEMORY_BYTES_PER_INPUT_BYTE = 2048;
+
+uint64_t get_elapsed_us(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end)
+{
+    return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(end - start).count());
+}
+
+template <typename T> void send_message(int fd, const T& message)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, message);
+    write_daemon_message(fd, buffer.data(), buffer.size());
+}
+} // namespace
+
+AdmissionControl::AdmissionControl(size_t max_concurrent, size_t memory_budget_bytes)
+    : max_concurrent_(max_concurrent)
+    , memory_budget_(memory_budget_bytes)
+{
+    BB_ASSERT_GT(max_concurrent, 0UL);
+}
+
+size_t AdmissionControl::acquire(size_t memory_bytes)
+{
+    // Clamped so that a request larger than the budget still runs, alone
+    const size_t reserved = memory_budget_ == 0 ? 0 : std::min(memory_bytes, memory_budget_);
+    std::unique_lock<std::mutex> lock(mutex_);
+    // First come first served, so that large requests are not starved by a stream of small ones
+    const uint64_t ticket = next_ticket_++;
+    admitted_.wait(lock, [&] {
+        return ticket == now_serving_ && num_running_ < max_concurrent_ &&
+               (memory_budget_ == 0 || reserved_bytes_ + reserved <= memory_budget_);
+    });
+    now_serving_++;
+    num_running_++;
+    reserved_bytes_ += reserved;
+    admitted_.notify_all();
+    return reserved;
+}
+
+void AdmissionControl::release(size_t reserved_bytes)
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        num_running_--;
+        reserved_bytes_ -= reserved_bytes;
+    }
+    admitted_.notify_all();
+}
+
+size_t AdmissionControl::get_num_running() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return num_running_;
+}
+
+size_t AdmissionControl::get_reserved_bytes() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return reserved_bytes_;
+}
+
+VkCache::VkCache(size_t max_entries)
+    : max_entries_(max_entries)
+{}
+
+std::string VkCache::get_key(const std::vector<uint8_t>& bytecode, const ProofSystemSettings& settings)
+{
+    // msgpack is self-delimiting, so the concatenation is unambiguous
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, settings);
+    msgpack::pack(buffer, bytecode);
+    return { buffer.data(), buffer.size() };
+}
+
+std::optional<CircuitComputeVk::Response> VkCache::get(const std::string& key)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    it->second.last_use = ++clock_;
+    return it->second.vk;
+}
+
+void VkCache::put(const std::string& key, const CircuitComputeVk::Response& vk)
+{
+    if (max_entries_ == 0 || vk.bytes.empty()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!entries_.contains(key) && entries_.size() == max_entries_) {
+        auto least_recent = std::min_element(entries_.begin(), entries_.end(), [](const auto& a, const auto& b) {
+            return a.second.last_use < b.second.last_use;
+        });
+        entries_.erase(least_recent);
+    }
+    entries_[key] = Entry{ vk, ++clock_ };
+}
+
+size_t VkCache::size() const
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    return entries_.size();
+}
+
+size_t estimate_request_memory(const Command& command)
+{
+    const size_t input_bytes = command.visit([](const auto& cmd) -> size_t {
+        size_t bytes = 0;
+        if constexpr (requires { cmd.circuit.bytecode; }) {
+            bytes += cmd.circuit.bytecode.size();
+        }
+        if constexpr (requires { cmd.witness; }) {
+            bytes += cmd.witness.size();
+        }
+        return bytes;
+    });
+    return std::max(MIN_REQUEST_MEMORY_BYTES, input_bytes * MEMORY_BYTES_PER_INPUT_BYTE);
+}
+
+Daemon::Daemon(DaemonSettings settings)
+    : settings_(std::move(settings))
+    , admission_(settings_.max_concurrent_requests, settings_.memory_budget_bytes)
+    , vk_cache_(settings_.vk_cache_size)
+{}
+
+CommandResponse Daemon::execute_with_vk_cache(BBApiRequest& session, Command&& command)
+{
+    if (auto* compute_vk = std::get_if<CircuitComputeVk>(&command.get())) {
+        const std::string key = VkCache::get_key(compute_vk->circuit.bytecode, compute_vk->settings);
+        if (auto cached = vk_cache_.get(key)) {
+            return std::move(*cached);
+        }
+        auto response = std::move(*compute_vk).execute(session);
+        vk_cache_.put(key, response);
+        return response;
+    }
+    auto* prove = std::get_if<CircuitProve>(&command.get());
+    if (prove != nullptr && prove->circuit.verification_key.empty()) {
+        const std::string key = VkCache::get_key(prove->circuit.bytecode, prove->settings);
+        auto cached = vk_cache_.get(key);
+        if (cached) {
+            prove->circuit.verification_key = cached->bytes;
+        }
+        auto response = std::move(*prove).execute(session);
+        // Answer as if the key had been computed, which is what the client asked for
+        if (cached) {
+            response.vk = std::move(*cached);
+        } else {
+            vk_cache_.put(key, response.vk);
+        }
+        return response;
+    }
+    return bbapi::execute(session, std::move(command));
+}
+
+DaemonResponse Daemon::execute(BBApiRequest& session, DaemonRequest&& request)
+{
+    const std::string name(request.command.get_type_name());
+    const size_t memory_estimate = request.memory_estimate_bytes != 0 ? request.memory_estimate_bytes
+                                                                      : estimate_request_memory(request.command);
+    DaemonResponse result;
+    const auto queued = std::chrono::steady_clock::now();
+    const size_t reserved = admission_.acquire(memory_estimate);
+    const auto started = std::chrono::steady_clock::now();
+    try {
+        result.response = execute_with_vk_cache(session, std::move(request.command));
+    } catch (const std::exception& e) {
+        result.error = e.what();
+    }
+    const auto finished = std::chrono::steady_clock::now();
+    admission_.release(reserved);
+
+    result.queue_time_us = get_elapsed_us(queued, started);
+    result.execution_time_us = get_elapsed_us(started, finished);
+    info("bbapi daemon: ",
+         name,
+         " queued for ",
+         result.queue_time_us / 1000,
+         " ms, executed in ",
+         result.execution_time_us / 1000,
+         " ms",
+         result.error.empty() ? "" : ", failed: " + result.error);
+    return result;
+}
+
+void Daemon::serve_connection(int connection_fd)
+{
+    BBApiRequest session;
+    std::vector<uint8_t> buffer;
+    while (read_daemon_message(connection_fd, buffer)) {
+        try {
+            auto unpacked = msgpack::unpack(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+            auto obj = unpacked.get();
+            messaging::HeaderOnlyMessage header;
+            obj.convert(header);
+            if (header.msgType == messaging::SystemMsgTypes::TERMINATE) {
+                stop();
+                break;
+            }
+            if (header.msgType == messaging::SystemMsgTypes::PING) {
+                messaging::MsgHeader pong_header(next_message_id_++, header.header.messageId);
+                send_message(connection_fd, messaging::HeaderOnlyMessage(messaging::SystemMsgTypes::PONG, pong_header));
+                continue;
+            }
+            if (header.msgType != DaemonMsgTypes::EXECUTE) {
+                throw_or_abort("Unknown bbapi daemon message type " + std::to_string(header.msgType));
+            }
+            messaging::TypedMessage<DaemonRequest> request;
+            obj.convert(request);
+            DaemonResponse response = execute(session, std::move(request.value));
+            messaging::MsgHeader response_header(next_message_id_++, request.header.messageId);
+            send_message(connection_fd,
+                         messaging::TypedMessage<DaemonResponse>(DaemonMsgTypes::EXECUTE, response_header, response));
+        } catch (const std::exception& e) {
+            // A malformed message says nothing about what follows it on the stream
+            info("bbapi daemon: dropping connection after bad message: ", e.what());
+            break;
+        }
+    }
+    std::unique_lock<std::mutex> lock(connections_mutex_);
+    close(connection_fd);
+    connection_fds_.erase(connection_fd);
+    // Under the lock, serve() may return as soon as it is released
+    connections_closed_.notify_all();
+}
+
+int Daemon::serve()
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string socket_path = settings_.socket_path.string();
+    if (socket_path.empty() || socket_path.size() >= sizeof(address.sun_path)) {
+        info("bbapi daemon: invalid socket path ", socket_path);
+        return 1;
+    }
+    std::copy(socket_path.begin(), socket_path.end(), address.sun_path);
+
+    const int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0) {
+        info("bbapi daemon: could not create socket: ", std::strerror(errno));
+        return 1;
+    }
+    // A previous daemon that did not shut down cleanly leaves its socket file behind
+    unlink(socket_path.c_str());
+    if (bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        listen(listen_fd, SOMAXCONN) != 0) {
+        info("bbapi daemon: could not listen on ", socket_path, ": ", std::strerror(errno));
+        close(listen_fd);
+        return 1;
+    }
+    listen_fd_ = listen_fd;
+    info("bbapi daemon: listening on ", socket_path);
+
+    while (!stopping_) {
+        const int connection_fd = accept(listen_fd, nullptr, nullptr);
+        if (connection_fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            break;
+        }
+        {
+            std::unique_lock<std::mutex> lock(connections_mutex_);
+            if (stopping_) {
+                close(connection_fd);
+                break;
+            }
+            connection_fds_.insert(connection_fd);
+        }
+        std::thread([this, connection_fd] { serve_connection(connection_fd); }).detach();
+    }
+    stop();
+    {
+        std::unique_lock<std::mutex> lock(connections_mutex_);
+        connections_closed_.wait(lock, [&] { return connection_fds_.empty(); });
+    }
+    close(listen_fd);
+    unlink(socket_path.c_str());
+    info("bbapi daemon: stopped");
+    return 0;
+}
+
+void Daemon::stop()
+{
+    std::unique_lock<std::mutex> lock(connections_mutex_);
+    stopping_ = true;
+    // Wakes up accept(); reads of the sessions see the end of the stream after their current request
+    if (listen_fd_ >= 0) {
+        shutdown(listen_fd_, SHUT_RDWR);
+    }
+    for (int fd : connection_fds_) {
+        shutdown(fd, SHUT_RD);
+    }
+}
+
+bool read_daemon_message(int fd, std::vector<uint8_t>& buffer)
+{
+    const auto read_exactly = [fd](uint8_t* data, size_t size) {
+        while (size > 0) {
+            const ssize_t num_read = recv(fd, data, size, 0);
+            if (num_read < 0 && errno == EINTR) {
+                continue;
+            }
+            if (num_read <= 0) {
+                return false;
+            }
+            data += num_read;
+            size -= static_cast<size_t>(num_read);
+        }
+        return true;
+    };
+    // Little-endian length prefix, as in `bb msgpack run`
+    std::array<uint8_t, 4> length_bytes{};
+    if (!read_exactly(length_bytes.data(), length_bytes.size())) {
+        return false;
+    }
+    uint32_t length = 0;
+    for (size_t i = 0; i < length_bytes.size(); ++i) {
+        length |= static_cast<uint32_t>(length_bytes[i]) << (8 * i);
+    }
+    buffer.resize(length);
+    return read_exactly(buffer.data(), length);
+}
+
+bool write_daemon_message(int fd, const char* data, size_t size)
+{
+    const auto write_all = [fd](const char* bytes, size_t remaining) {
+        while (remaining > 0) {
+            // The client may have gone away, which must not kill the daemon with SIGPIPE
+            const ssize_t num_written = send(fd, bytes, remaining, MSG_NOSIGNAL);
+            if (num_written < 0 && errno == EINTR) {
+                continue;
+            }
+            if (num_written <= 0) {
+                return false;
+            }
+            bytes += num_written;
+            remaining -= static_cast<size_t>(num_written);
+        }
+        return true;
+    };
+    BB_ASSERT_LTE(size, static_cast<size_t>(UINT32_MAX));
+    std::array<char, 4> length_bytes{};
+    for (size_t i = 0; i < length_bytes.size(); ++i) {
+        length_bytes[i] = static_cast<char>((size >> (8 * i)) & 0xff);
+    }
+    return write_all(length_bytes.data(), length_bytes.size()) && write_all(data, size);
+}
+
+int execute_msgpack_serve(const DaemonSettings& settings)
+{
+    if (settings.srs_points > 0) {
+        const auto start = std::chrono::steady_clock::now();
+        srs::get_bn254_crs_factory()->get_crs(settings.srs_points);
+        info("bbapi daemon: loaded ",
+             settings.srs_points,
+             " CRS points in ",
+             get_elapsed_us(start, std::chrono::steady_clock::now()) / 1000,
+             " ms");
+    }
+    Daemon daemon(settings);
+    return daemon.serve();
+}
+
+} // namespace bb::bbapi
+#endif
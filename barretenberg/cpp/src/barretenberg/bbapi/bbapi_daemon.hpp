@@ -0,0 +1,180 @@
+#pragma once
+/**
+ * @file bbapi_daemon.hpp
+ * @brief A long-running prover that serves bbapi commands over a Unix socket.
+ *
+ * A one-shot `bb prove` pays for loading the CRS and warming the allocators on every invocation, which dominates the
+ * latency of small circuits. The daemon keeps all of that in memory between requests and additionally caches
+ * verification keys by circuit.
+ *
+ * Messages on the socket use the same framing as `bb msgpack run`: a 4-byte little-endian length followed by a
+ * msgpack buffer. The buffers are messaging/ messages: a TypedMessage<DaemonRequest> of type EXECUTE, answered with a
+ * TypedMessage<DaemonResponse> whose header.requestId is the request's messageId, or one of the system messages (PING
+ * is answered with PONG, TERMINATE shuts the daemon down).
+ *
+ * Each connection is a session with its own BBApiRequest, so e.g. a ClientIvcStart/Load/Accumulate/Prove sequence must
+ * be sent on one connection. Requests of a connection run in order, requests of different connections run
+ * concurrently subject to admission control.
+ */
+#include "barretenberg/bbapi/bbapi_execute.hpp"
+#include "barretenberg/bbapi/bbapi_shared.hpp"
+#include "barretenberg/messaging/header.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace bb::bbapi {
+
+enum DaemonMsgTypes { EXECUTE = messaging::FIRST_APP_MSG_TYPE };
+
+struct DaemonRequest {
+    Command command;
+    /**
+     * @brief Memory the command is expected to need, used for admission control
+     *
+     * Zero lets the daemon estimate it from the size of the command. Clients that know better (e.g. from CircuitStats)
+     * should pass it.
+     */
+    uint64_t memory_estimate_bytes = 0;
+    MSGPACK_FIELDS(command, memory_estimate_bytes);
+};
+
+struct DaemonResponse {
+    CommandResponse response;
+    // Empty on success, otherwise the reason the command failed; response is then default-constructed
+    std::string error;
+    // Time spent waiting for admission
+    uint64_t queue_time_us = 0;
+    // Time spent executing the command
+    uint64_t execution_time_us = 0;
+    MSGPACK_FIELDS(response, error, queue_time_us, execution_time_us);
+};
+
+struct DaemonSettings {
+    std::filesystem::path socket_path;
+    // Most requests executing at the same time
+    size_t max_concurrent_requests = 1;
+    // Most memory (by estimate) that executing requests may need together, zero for no limit
+    size_t memory_budget_bytes = 0;
+    // Most verification keys kept in the cache
+    size_t vk_cache_size = 64;
+    // Number of bn254 CRS points to load at startup rather than on the first request
+    size_t srs_points = 0;
+};
+
+/**
+ * @brief Blocks requests until both a concurrency slot and their memory estimate are available
+ * @details A request whose estimate exceeds the whole budget is still admitted once nothing else is running, so that
+ * every request eventually makes progress.
+ */
+class AdmissionControl {
+  public:
+    AdmissionControl(size_t max_concurrent, size_t memory_budget_bytes);
+
+    // Returns the bytes actually reserved, to be passed to release()
+    size_t acquire(size_t memory_bytes);
+    void release(size_t reserved_bytes);
+
+    size_t get_num_running() const;
+    size_t get_reserved_bytes() const;
+
+  private:
+    size_t max_concurrent_;
+    size_t memory_budget_;
+    size_t num_running_ = 0;
+    size_t reserved_bytes_ = 0;
+    uint64_t next_ticket_ = 0;
+    uint64_t now_serving_ = 0;
+    mutable std::mutex mutex_;
+    std::condition_variable admitted_;
+};
+
+/**
+ * @brief Verification keys by circuit and settings, shared by all sessions
+ * @details Filled by CircuitComputeVk and by CircuitProve requests that come without a key. CircuitComputeVk is then
+ * answered from the cache and CircuitProve gets the cached key instead of recomputing it from the proving key.
+ */
+class VkCache {
+  public:
+    explicit VkCache(size_t max_entries);
+
+    static std::string get_key(const std::vector<uint8_t>& bytecode, const ProofSystemSettings& settings);
+
+    std::optional<CircuitComputeVk::Response> get(const std::string& key);
+    void put(const std::string& key, const CircuitComputeVk::Response& vk);
+
+    size_t size() const;
+
+  private:
+    struct Entry {
+        CircuitComputeVk::Response vk;
+        uint64_t last_use;
+    };
+
+    size_t max_entries_;
+    uint64_t clock_ = 0;
+    std::unordered_map<std::string, Entry> entries_;
+    mutable std::mutex mutex_;
+};
+
+/**
+ * @brief Estimate of the memory a command needs when the client did not provide one
+ * @details Proving memory grows with the circuit, for which the size of the serialized inputs is a rough proxy.
+ */
+size_t estimate_request_memory(const Command& command);
+
+class Daemon {
+  public:
+    explicit Daemon(DaemonSettings settings);
+
+    /**
+     * @brief Run a command of a session through admission control and the VK cache, timing it
+     */
+    DaemonResponse execute(BBApiRequest& session, DaemonRequest&& request);
+
+    /**
+     * @brief Listen on the socket and serve connections until a TERMINATE message or stop()
+     * @return int 0 on a clean shutdown, non-zero if the socket could not be set up
+     */
+    int serve();
+
+    /**
+     * @brief Stop accepting connections and end all sessions once their current request is answered
+     */
+    void stop();
+
+    const DaemonSettings& get_settings() const { return settings_; }
+    VkCache& get_vk_cache() { return vk_cache_; }
+
+  private:
+    void serve_connection(int connection_fd);
+    CommandResponse execute_with_vk_cache(BBApiRequest& session, Command&& command);
+
+    DaemonSettings settings_;
+    AdmissionControl admission_;
+    VkCache vk_cache_;
+    std::atomic<bool> stopping_ = false;
+    std::atomic<int> listen_fd_ = -1;
+    std::mutex connections_mutex_;
+    std::condition_variable connections_closed_;
+    std::unordered_set<int> connection_fds_;
+    std::atomic<uint32_t> next_message_id_ = 0;
+};
+
+// Framing helpers, also usable by C++ clients of the daemon
+bool read_daemon_message(int fd, std::vector<uint8_t>& buffer);
+bool write_daemon_message(int fd, const char* data, size_t size);
+
+/**
+ * @brief Execute msgpack serve command: load the CRS and serve bbapi commands until terminated
+ */
+int execute_msgpack_serve(const DaemonSettings& settings);
+
+} // namespace bb::bbapi
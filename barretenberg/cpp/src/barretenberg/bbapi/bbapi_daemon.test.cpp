@@ -0,0 +1,201 @@
+#ifndef __wasm__
+#include "barretenberg/bbapi/bbapi_daemon.hpp"
+#include "barretenberg/client_ivc/acir_bincode_mocks.hpp"
+#include "barretenberg/srs/global_crs.hpp"
+#include <atomic>
+#include <chrono>
+#include <gtest/gtest.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+namespace bb::bbapi {
+
+namespace {
+int connect_to_daemon(const std::filesystem::path& socket_path)
+{
+    sockaddr_un address{};
+    address.sun_family = AF_UNIX;
+    const std::string path = socket_path.string();
+    std::copy(path.begin(), path.end(), address.sun_path);
+    // The daemon starts listening asynchronously
+    for (size_t attempt = 0; attempt < 100; ++attempt) {
+        const int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+        if (connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            return fd;
+        }
+        close(fd);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return -1;
+}
+
+template <typename T> msgpack::object_handle round_trip(int fd, const T& message)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, message);
+    EXPECT_TRUE(write_daemon_message(fd, buffer.data(), buffer.size()));
+    std::vector<uint8_t> response;
+    EXPECT_TRUE(read_daemon_message(fd, response));
+    return msgpack::unpack(reinterpret_cast<const char*>(response.data()), response.size());
+}
+} // namespace
+
+class BBApiDaemonTest : public ::testing::Test {
+  protected:
+    static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
+};
+
+TEST_F(BBApiDaemonTest, AdmissionControlLimitsMemory)
+{
+    AdmissionControl admission(/*max_concurrent=*/4, /*memory_budget_bytes=*/100);
+    EXPECT_EQ(admission.acquire(60), 60UL);
+
+    std::atomic<bool> admitted = false;
+    std::thread waiter([&] {
+        const size_t reserved = admission.acquire(60);
+        admitted = true;
+        admission.release(reserved);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_FALSE(admitted);
+    EXPECT_EQ(admission.get_num_running(), 1UL);
+
+    admission.release(60);
+    waiter.join();
+    EXPECT_TRUE(admitted);
+
+    // Larger than the whole budget still runs, alone
+    EXPECT_EQ(admission.acquire(1000), 100UL);
+    admission.release(100);
+    EXPECT_EQ(admission.get_reserved_bytes(), 0UL);
+}
+
+TEST_F(BBApiDaemonTest, AdmissionControlLimitsConcurrency)
+{
+    AdmissionControl admission(/*max_concurrent=*/2, /*memory_budget_bytes=*/0);
+    std::atomic<size_t> num_running = 0;
+    std::atomic<size_t> max_running = 0;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            const size_t reserved = admission.acquire(1UL << 40);
+            const size_t running = ++num_running;
+            size_t expected = max_running;
+            while (running > expected && !max_running.compare_exchange_weak(expected, running)) {
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            num_running--;
+            admission.release(reserved);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_LE(max_running, 2UL);
+    EXPECT_EQ(admission.get_num_running(), 0UL);
+}
+
+TEST_F(BBApiDaemonTest, VkCacheEvictsLeastRecentlyUsed)
+{
+    VkCache cache(2);
+    const ProofSystemSettings settings;
+    const std::string a = VkCache::get_key({ 1 }, settings);
+    const std::string b = VkCache::get_key({ 2 }, settings);
+    const std::string c = VkCache::get_key({ 3 }, settings);
+    EXPECT_NE(a, VkCache::get_key({ 1 }, { .disable_zk = true }));
+
+    cache.put(a, { .bytes = { 1 } });
+    cache.put(b, { .bytes = { 2 } });
+    EXPECT_TRUE(cache.get(a).has_value());
+    cache.put(c, { .bytes = { 3 } });
+    EXPECT_EQ(cache.size(), 2UL);
+    EXPECT_TRUE(cache.get(a).has_value());
+    EXPECT_FALSE(cache.get(b).has_value());
+    EXPECT_EQ(cache.get(c)->bytes, std::vector<uint8_t>{ 3 });
+}
+
+TEST_F(BBApiDaemonTest, ProveUsesCachedVk)
+{
+    auto [bytecode, witness] = acir_bincode_mocks::create_simple_circuit_bytecode();
+    const ProofSystemSettings settings{ .disable_zk = true };
+    Daemon daemon({ .vk_cache_size = 4 });
+    BBApiRequest session;
+
+    auto compute_vk = [&] {
+        DaemonResponse response = daemon.execute(
+            session,
+            { .command = CircuitComputeVk{ .circuit = { .name = "test_circuit", .bytecode = bytecode },
+                                           .settings = settings } });
+        EXPECT_TRUE(response.error.empty()) << response.error;
+        return std::get<CircuitComputeVk::Response>(response.response.get());
+    };
+    const CircuitComputeVk::Response vk = compute_vk();
+    EXPECT_EQ(daemon.get_vk_cache().size(), 1UL);
+    EXPECT_EQ(compute_vk(), vk);
+
+    // Without a key, the response still carries the (cached) key
+    DaemonResponse prove_response = daemon.execute(
+        session,
+        { .command = CircuitProve{ .circuit = { .name = "test_circuit", .bytecode = bytecode },
+                                   .witness = witness,
+                                   .settings = settings } });
+    ASSERT_TRUE(prove_response.error.empty()) << prove_response.error;
+    const auto& proof = std::get<CircuitProve::Response>(prove_response.response.get());
+    EXPECT_EQ(proof.vk, vk);
+
+    DaemonResponse verify_response = daemon.execute(session,
+                                                    { .command = CircuitVerify{ .verification_key = vk.bytes,
+                                                                                .public_inputs = proof.public_inputs,
+                                                                                .proof = proof.proof,
+                                                                                .settings = settings } });
+    EXPECT_TRUE(std::get<CircuitVerify::Response>(verify_response.response.get()).verified);
+}
+
+TEST_F(BBApiDaemonTest, ServesSocket)
+{
+    const std::filesystem::path socket_path =
+        std::filesystem::temp_directory_path() / ("bb-daemon-test-" + std::to_string(getpid()) + ".sock");
+    Daemon daemon({ .socket_path = socket_path });
+    int exit_code = -1;
+    std::thread server([&] { exit_code = daemon.serve(); });
+
+    const int fd = connect_to_daemon(socket_path);
+    ASSERT_GE(fd, 0);
+
+    messaging::MsgHeader ping_header(7, 0);
+    auto pong = round_trip(fd, messaging::HeaderOnlyMessage(messaging::SystemMsgTypes::PING, ping_header));
+    messaging::HeaderOnlyMessage pong_message;
+    pong.get().convert(pong_message);
+    EXPECT_EQ(pong_message.msgType, static_cast<uint32_t>(messaging::SystemMsgTypes::PONG));
+    EXPECT_EQ(pong_message.header.requestId, 7U);
+
+    // Failures are reported in the response and leave the session usable
+    messaging::MsgHeader request_header(8, 0);
+    DaemonRequest request{ .command = ClientIvcLoad{} };
+    auto response = round_trip(fd, messaging::TypedMessage<DaemonRequest>(EXECUTE, request_header, request));
+    messaging::TypedMessage<DaemonResponse> response_message;
+    response.get().convert(response_message);
+    EXPECT_EQ(response_message.header.requestId, 8U);
+    EXPECT_NE(response_message.value.error.find("ClientIvcStart"), std::string::npos);
+
+    messaging::MsgHeader start_header(9, 0);
+    request = { .command = ClientIvcStart{ .num_circuits = 1 } };
+    response = round_trip(fd, messaging::TypedMessage<DaemonRequest>(EXECUTE, start_header, request));
+    response.get().convert(response_message);
+    EXPECT_EQ(response_message.header.requestId, 9U);
+    EXPECT_TRUE(response_message.value.error.empty()) << response_message.value.error;
+
+    messaging::MsgHeader terminate_header(10, 0);
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, messaging::HeaderOnlyMessage(messaging::SystemMsgTypes::TERMINATE, terminate_header));
+    EXPECT_TRUE(write_daemon_message(fd, buffer.data(), buffer.size()));
+    server.join();
+    close(fd);
+    EXPECT_EQ(exit_code, 0);
+    EXPECT_FALSE(std::filesystem::exists(socket_path));
+}
+
+} // namespace bb::bbapi
+#endif
@@ -71,6 +71,37 @@ template <typename TreeType> void append_only_tree_bench(State& state) noexcept
 
     std::filesystem::remove_all(directory);
 }
+/**
+ * @brief Leaves appended per second for a batch size (first argument) and number of tree workers (second argument)
+ */
+template <typename TreeType> void append_only_tree_throughput_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const auto num_threads = uint32_t(state.range(1));
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(directory, name, 1024 * 1024, num_threads);
+    std::unique_ptr<StoreType> store = std::make_unique<StoreType>(name, TREE_DEPTH, db);
+    std::shared_ptr<ThreadPool> workers = std::make_shared<ThreadPool>(num_threads);
+    TreeType tree = TreeType(std::move(store), workers);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<fr> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            values[i] = fr(random_engine.get_random_uint256());
+        }
+        state.ResumeTiming();
+        perform_batch_insert(tree, values);
+    }
+    state.SetItemsProcessed(int64_t(state.iterations()) * int64_t(batch_size));
+
+    std::filesystem::remove_all(directory);
+}
+
 BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -81,6 +112,10 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->RangeMultiplier(2)
     ->Range(512, 8192)
     ->Iterations(10);
+BENCHMARK(append_only_tree_throughput_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ benchmark::CreateRange(64, 64 * 1024, 4), { 1, 4, 16 } })
+    ->Iterations(10);
 
 } // namespace
 
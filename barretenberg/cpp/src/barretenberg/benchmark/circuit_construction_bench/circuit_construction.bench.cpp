@@ -1,9 +1,14 @@
 
 #include <benchmark/benchmark.h>
 
+#include "barretenberg/dsl/acir_format/acir_format.hpp"
+#include "barretenberg/dsl/acir_format/acir_format_mocks.hpp"
+#include "barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp"
 #include "barretenberg/stdlib/primitives/biggroup/biggroup.hpp"
 #include "barretenberg/stdlib/primitives/curves/bn254.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
+#include <fstream>
+#include <string>
 
 using namespace benchmark;
 using namespace bb;
@@ -40,7 +45,131 @@ void biggroup_construction_bench(State& state)
         state.PauseTiming();
     }
 }
+
+/**
+ * @brief Serialized msgpack program with `num_opcodes` width-4 arithmetic opcodes, as Noir emits them
+ */
+std::vector<uint8_t> create_msgpack_program(size_t num_opcodes)
+{
+    const std::string one = "0000000000000000000000000000000000000000000000000000000000000001";
+    Acir::Circuit circuit;
+    for (size_t i = 0; i < num_opcodes; ++i) {
+        const auto w = static_cast<uint32_t>(4 * i);
+        Acir::Expression expr{ .mul_terms = { { one, Acir::Witness{ w }, Acir::Witness{ w + 1 } } },
+                               .linear_combinations = { { one, Acir::Witness{ w + 1 } },
+                                                        { one, Acir::Witness{ w + 2 } },
+                                                        { one, Acir::Witness{ w + 3 } } },
+                               .q_c = one };
+        circuit.opcodes.push_back(Acir::Opcode{ Acir::Opcode::AssertZero{ expr } });
+    }
+    circuit.current_witness_index = static_cast<uint32_t>(4 * num_opcodes);
+    circuit.expression_width = Acir::ExpressionWidth{ Acir::ExpressionWidth::Bounded{ 4 } };
+    Acir::ProgramWithoutBrillig program{ .functions = { circuit } };
+
+    msgpack::sbuffer buffer;
+    const char format = 2;
+    buffer.write(&format, 1);
+    msgpack::pack(buffer, program);
+    return { buffer.data(), buffer.data() + buffer.size() };
+}
+
+/**
+ * @brief Resets the peak resident set size of the process, so that it can be measured per benchmark iteration
+ */
+void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+double get_peak_rss_mb()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stod(line.substr(6)) / 1024;
+        }
+    }
+    return 0;
+}
+
+void acir_to_constraints_streamed_bench(State& state)
+{
+    const std::vector<uint8_t> bytecode = create_msgpack_program(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<uint8_t> buf = bytecode;
+        reset_peak_rss();
+        state.ResumeTiming();
+        DoNotOptimize(acir_format::circuit_buf_to_acir_format(std::move(buf)));
+    }
+    state.counters["peak_rss_mb"] = get_peak_rss_mb();
+}
+
+// What circuit_buf_to_acir_format did before streaming, for comparison
+void acir_to_constraints_materialized_bench(State& state)
+{
+    const std::vector<uint8_t> bytecode = create_msgpack_program(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<uint8_t> buf = bytecode;
+        reset_peak_rss();
+        state.ResumeTiming();
+        auto oh = msgpack::unpack(reinterpret_cast<const char*>(buf.data()) + 1, buf.size() - 1);
+        Acir::ProgramWithoutBrillig program;
+        oh.get().convert(program);
+        DoNotOptimize(acir_format::circuit_serde_to_acir_format(program.functions[0]));
+    }
+    state.counters["peak_rss_mb"] = get_peak_rss_mb();
+}
+
+/**
+ * @brief Constraint system with `num_pairs` pairs of 32-bit XOR and AND opcodes on range constrained inputs
+ */
+acir_format::AcirProgram create_logic_program(uint32_t num_pairs)
+{
+    acir_format::AcirProgram program{};
+    auto& constraint_system = program.constraints;
+    constraint_system.varnum = 4 * num_pairs;
+    constraint_system.num_acir_opcodes = 4 * num_pairs;
+    for (uint32_t i = 0; i < num_pairs; ++i) {
+        const uint32_t a = engine.get_random_uint32();
+        const uint32_t b = engine.get_random_uint32();
+        program.witness.insert(program.witness.end(), { a, b, a ^ b, a & b });
+        for (uint32_t is_xor_gate = 0; is_xor_gate < 2; ++is_xor_gate) {
+            constraint_system.logic_constraints.push_back({
+                .a = acir_format::WitnessOrConstant<fr>::from_index(4 * i),
+                .b = acir_format::WitnessOrConstant<fr>::from_index(4 * i + 1),
+                .result = 4 * i + 3 - is_xor_gate,
+                .num_bits = 32,
+                .is_xor_gate = is_xor_gate,
+            });
+        }
+        for (uint32_t j = 0; j < 2; ++j) {
+            constraint_system.range_constraints.push_back({ .witness = 4 * i + j, .num_bits = 32 });
+            constraint_system.minimal_range[4 * i + j] = 32;
+        }
+    }
+    mock_opcode_indices(constraint_system);
+    return program;
+}
+
+// Thread scaling of parallel circuit construction: each task runs on at most one thread, zero tasks is sequential
+void acir_parallel_construction_bench(State& state)
+{
+    const acir_format::AcirProgram program = create_logic_program(1 << 12);
+    const acir_format::ProgramMetadata metadata{ .parallel_construction_tasks = static_cast<size_t>(state.range(0)) };
+    for (auto _ : state) {
+        state.PauseTiming();
+        acir_format::AcirProgram program_copy = program;
+        state.ResumeTiming();
+        DoNotOptimize(acir_format::create_circuit(program_copy, metadata));
+    }
+}
 } // namespace
 BENCHMARK(biggroup_construction_bench)->Unit(kMicrosecond)->DenseRange(2, 20);
+BENCHMARK(acir_to_constraints_streamed_bench)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 12, 1 << 20);
+BENCHMARK(acir_to_constraints_materialized_bench)->Unit(kMillisecond)->RangeMultiplier(4)->Range(1 << 12, 1 << 20);
+BENCHMARK(acir_parallel_construction_bench)->Unit(kMillisecond)->Arg(0)->RangeMultiplier(2)->Range(1, 32);
 
 BENCHMARK_MAIN();
@@ -5,11 +5,15 @@
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/cached_content_addressed_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/content_addressed_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/ordered_flat_map.hpp"
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
 #include <benchmark/benchmark.h>
 #include <filesystem>
+#include <map>
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 using namespace benchmark;
@@ -360,4 +364,119 @@ BENCHMARK(multi_thread_indexed_tree_bench<Poseidon2, SEQUENTIAL>)
     ->Range(512, 8192)
     ->Iterations(100);
 
+// Counts the bytes allocated by the cache maps, to report the memory used per cached node
+size_t allocated_bytes = 0;
+
+template <typename T> struct CountingAllocator {
+    using value_type = T;
+    CountingAllocator() = default;
+    template <typename U> CountingAllocator(const CountingAllocator<U>& /*unused*/) {}
+    T* allocate(size_t n)
+    {
+        allocated_bytes += n * sizeof(T);
+        return std::allocator<T>().allocate(n);
+    }
+    void deallocate(T* p, size_t n)
+    {
+        allocated_bytes -= n * sizeof(T);
+        std::allocator<T>().deallocate(p, n);
+    }
+    bool operator==(const CountingAllocator& /*unused*/) const { return true; }
+};
+
+using StdNodeAllocator = CountingAllocator<std::pair<const fr, NodePayload>>;
+using StdNodeMap = std::unordered_map<fr, NodePayload, std::hash<fr>, std::equal_to<fr>, StdNodeAllocator>;
+using FlatNodeAllocator = CountingAllocator<std::pair<fr, NodePayload>>;
+using FlatNodeMap = ::ankerl::unordered_dense::map<fr, NodePayload, FrHash, std::equal_to<fr>, FlatNodeAllocator>;
+
+using StdIndices = std::map<uint256_t, index_t>;
+using FlatIndices = ContentAddressedCache<NullifierLeafValue>::Indices;
+
+std::vector<fr> random_hashes(size_t num_hashes)
+{
+    std::vector<fr> hashes(num_hashes);
+    for (auto& hash : hashes) {
+        hash = fr(random_engine.get_random_uint256());
+    }
+    return hashes;
+}
+
+template <typename NodeMap> void cache_node_insert_bench(State& state) noexcept
+{
+    const size_t num_nodes = size_t(state.range(0));
+    std::vector<fr> hashes = random_hashes(num_nodes);
+    for (auto _ : state) {
+        allocated_bytes = 0;
+        NodeMap nodes;
+        for (const fr& hash : hashes) {
+            nodes[hash] = NodePayload{ .left = hash, .right = std::nullopt, .ref = 1 };
+        }
+        DoNotOptimize(nodes);
+        state.counters["bytes_per_node"] = static_cast<double>(allocated_bytes) / static_cast<double>(num_nodes);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_nodes));
+}
+
+template <typename NodeMap> void cache_node_lookup_bench(State& state) noexcept
+{
+    const size_t num_nodes = size_t(state.range(0));
+    std::vector<fr> hashes = random_hashes(num_nodes);
+    NodeMap nodes;
+    for (const fr& hash : hashes) {
+        nodes[hash] = NodePayload{ .left = hash, .right = std::nullopt, .ref = 1 };
+    }
+    for (auto _ : state) {
+        for (const fr& hash : hashes) {
+            DoNotOptimize(nodes.find(hash));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_nodes));
+}
+
+void insert_index(StdIndices& indices, const uint256_t& key, index_t index)
+{
+    indices.insert({ key, index });
+}
+
+void insert_index(FlatIndices& indices, const uint256_t& key, index_t index)
+{
+    indices.insert(key, index);
+}
+
+index_t find_low_index(const StdIndices& indices, const uint256_t& key)
+{
+    auto it = indices.upper_bound(key);
+    return it == indices.begin() ? 0 : std::prev(it)->second;
+}
+
+index_t find_low_index(const FlatIndices& indices, const uint256_t& key)
+{
+    const auto* entry = indices.find_floor(key);
+    return entry == nullptr ? 0 : entry->second;
+}
+
+template <typename Indices> void cache_indices_bench(State& state) noexcept
+{
+    const size_t num_keys = size_t(state.range(0));
+    std::vector<fr> keys = random_hashes(num_keys);
+    std::vector<fr> queries = random_hashes(num_keys);
+    for (auto _ : state) {
+        Indices indices;
+        for (size_t i = 0; i < num_keys; ++i) {
+            insert_index(indices, uint256_t(keys[i]), i);
+        }
+        for (const fr& query : queries) {
+            DoNotOptimize(find_low_index(indices, uint256_t(query)));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(num_keys));
+}
+
+BENCHMARK(cache_node_insert_bench<StdNodeMap>)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(512, 262144);
+BENCHMARK(cache_node_insert_bench<FlatNodeMap>)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(512, 262144);
+BENCHMARK(cache_node_lookup_bench<StdNodeMap>)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(512, 262144);
+BENCHMARK(cache_node_lookup_bench<FlatNodeMap>)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(512, 262144);
+BENCHMARK(cache_indices_bench<StdIndices>)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(512, 262144);
+BENCHMARK(cache_indices_bench<FlatIndices>)->Unit(benchmark::kMicrosecond)->RangeMultiplier(8)->Range(512, 262144);
+
 BENCHMARK_MAIN();
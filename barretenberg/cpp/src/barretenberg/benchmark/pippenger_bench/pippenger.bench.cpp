@@ -1,5 +1,6 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
 
@@ -10,6 +11,7 @@
 
 #include <chrono>
 #include <cstdlib>
+#include <map>
 
 // #include <valgrind/callgrind.h>
 //  CALLGRIND_START_INSTRUMENTATION;
@@ -70,9 +72,59 @@ BENCHMARK_DEFINE_F(PippengerBench, Full)(benchmark::State& state)
     }
 }
 
+/**
+ * @brief As `Full`, but slicing scalars into signed digits, which halves the number of buckets per round
+ */
+BENCHMARK_DEFINE_F(PippengerBench, SignedDigit)(benchmark::State& state)
+{
+    using MSM = scalar_multiplication::MSM<Curve>;
+    std::span<const G1> points =
+        PippengerBench::srs->get_monomial_points().subspan(0, static_cast<size_t>(state.range(0)));
+    std::span<Fr> span(&PippengerBench::scalars[0], static_cast<size_t>(state.range(0)));
+    PolynomialSpan<const Fr> scalars = PolynomialSpan<const Fr>(0, span);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        DoNotOptimize(MSM::msm(points, scalars, false, MSM::SliceStrategy::SignedDigit));
+    }
+}
+
+/**
+ * @brief Fixed-base lookup-and-add MSM over a precomputed table of the SRS points, for comparison against `Full`
+ * @details The table is built once per size (outside of the timed loop) within FIXED_BASE_MEMORY_BUDGET, so larger
+ * sizes get narrower windows.
+ */
+BENCHMARK_DEFINE_F(PippengerBench, FixedBase)(benchmark::State& state)
+{
+    using Table = scalar_multiplication::FixedBaseTable<Curve>;
+    constexpr size_t FIXED_BASE_MEMORY_BUDGET = static_cast<size_t>(4) << 30;
+    static std::map<size_t, std::shared_ptr<Table>> tables;
+
+    const size_t num_points = static_cast<size_t>(state.range(0));
+    auto& table = tables[num_points];
+    if (table == nullptr) {
+        std::span<const G1> points = PippengerBench::srs->get_monomial_points().subspan(0, num_points);
+        table = Table::create(points, FIXED_BASE_MEMORY_BUDGET);
+    }
+    BB_ASSERT_EQ(table->get_num_points(), num_points);
+    state.counters["window_bits"] = static_cast<double>(table->get_window_bits());
+
+    std::span<Fr> span(&PippengerBench::scalars[0], num_points);
+    PolynomialSpan<const Fr> scalars = PolynomialSpan<const Fr>(0, span);
+
+    for (auto _ : state) {
+        BB_REPORT_OP_COUNT_IN_BENCH(state);
+        DoNotOptimize(table->msm(scalars));
+    }
+}
+
 #define ARGS RangeMultiplier(4)->Range(1 << 11, 1 << 21);
+// The narrowest table costs 16KiB per point, so stay within the memory budget
+#define FIXED_BASE_ARGS RangeMultiplier(4)->Range(1 << 11, 1 << 17);
 
 BENCHMARK_REGISTER_F(PippengerBench, Full)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(PippengerBench, SignedDigit)->Unit(benchmark::kMillisecond)->ARGS;
+BENCHMARK_REGISTER_F(PippengerBench, FixedBase)->Unit(benchmark::kMillisecond)->FIXED_BASE_ARGS;
 
 } // namespace
 
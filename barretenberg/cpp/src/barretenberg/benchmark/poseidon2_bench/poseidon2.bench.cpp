@@ -1,4 +1,5 @@
 #include "barretenberg/crypto/poseidon2/poseidon2.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <benchmark/benchmark.h>
 
@@ -41,4 +42,65 @@ void poseiden_hash_bench(State& state) noexcept
 }
 BENCHMARK(poseiden_hash_bench)->Unit(benchmark::kMillisecond);
 
+/**
+ * @brief Two-to-one hashes of a batch of independent pairs, one at a time (arg 1 = 0) or batched (arg 1 = 1)
+ * @details Runs on a single thread, so the reported items per second are hashes per second per core.
+ */
+void poseidon2_hash_pairs_bench(State& state) noexcept
+{
+    using Poseidon2 = bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    const bool batched = state.range(1) != 0;
+    std::vector<fr> inputs(batch_size * 2);
+    for (auto& input : inputs) {
+        input = fr::random_element();
+    }
+    std::vector<fr> outputs(batch_size);
+    for (auto _ : state) {
+        if (batched) {
+            Poseidon2::hash_batch(inputs, 2, outputs);
+        } else {
+            for (size_t i = 0; i < batch_size; ++i) {
+                const std::array<fr, 2> pair{ inputs[i * 2], inputs[i * 2 + 1] };
+                outputs[i] = Poseidon2::Sponge::hash_internal(pair);
+            }
+        }
+        DoNotOptimize(outputs.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+}
+BENCHMARK(poseidon2_hash_pairs_bench)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({ benchmark::CreateRange(1, 1024, 4), { 0, 1 } });
+
+/**
+ * @brief Permutations of a batch of independent states, one at a time (arg 1 = 0) or batched (arg 1 = 1)
+ */
+void poseidon2_permutation_batch_bench(State& state) noexcept
+{
+    using Permutation = bb::crypto::Poseidon2Permutation<bb::crypto::Poseidon2Bn254ScalarFieldParams>;
+    const auto batch_size = static_cast<size_t>(state.range(0));
+    const bool batched = state.range(1) != 0;
+    std::vector<Permutation::State> states(batch_size);
+    for (auto& permutation_state : states) {
+        for (auto& element : permutation_state) {
+            element = fr::random_element();
+        }
+    }
+    for (auto _ : state) {
+        if (batched) {
+            Permutation::permutation_batch(states);
+        } else {
+            for (auto& permutation_state : states) {
+                permutation_state = Permutation::permutation(permutation_state);
+            }
+        }
+        DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(batch_size));
+}
+BENCHMARK(poseidon2_permutation_batch_bench)
+    ->Unit(benchmark::kMicrosecond)
+    ->ArgsProduct({ benchmark::CreateRange(1, 1024, 4), { 0, 1 } });
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -18,7 +18,9 @@ enum {
     LOG_DERIVATIVE_INVERSE,
     GRAND_PRODUCT_COMPUTATION,
     GENERATE_ALPHAS,
-    RELATION_CHECK
+    RELATION_CHECK,
+    // RELATION_CHECK with blocked sumcheck rounds, see SumcheckProverRound::compute_univariate_blocked
+    RELATION_CHECK_BLOCKED
 };
 
 /**
@@ -58,7 +60,11 @@ BB_PROFILE void test_round_inner(State& state, MegaProver& prover, size_t index)
     prover.generate_gate_challenges();
 
     DeciderProver_<MegaFlavor> decider_prover(prover.proving_key, prover.transcript);
-    time_if_index(RELATION_CHECK, [&] { decider_prover.execute_relation_check_rounds(); });
+    const bool original_blocked_rounds = sumcheck_blocked_rounds;
+    sumcheck_blocked_rounds = index == RELATION_CHECK_BLOCKED;
+    time_if_index(sumcheck_blocked_rounds ? RELATION_CHECK_BLOCKED : RELATION_CHECK,
+                  [&] { decider_prover.execute_relation_check_rounds(); });
+    sumcheck_blocked_rounds = original_blocked_rounds;
 }
 BB_PROFILE static void test_round(State& state, size_t index) noexcept
 {
@@ -91,5 +97,6 @@ ROUND_BENCHMARK(LOG_DERIVATIVE_INVERSE)->Iterations(1);
 ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(GENERATE_ALPHAS)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
+ROUND_BENCHMARK(RELATION_CHECK_BLOCKED);
 
 BENCHMARK_MAIN();
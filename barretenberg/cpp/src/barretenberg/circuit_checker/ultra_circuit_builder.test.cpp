@@ -10,6 +10,13 @@ using namespace bb;
 
 namespace {
 auto& engine = numeric::get_debug_randomness();
+
+uint32_t create_lookup(UltraCircuitBuilder& builder, plookup::MultiTableId id, uint32_t a_idx, uint32_t b_idx)
+{
+    const auto accumulators =
+        plookup::get_lookup_accumulators(id, builder.get_variable(a_idx), builder.get_variable(b_idx), true);
+    return builder.create_gates_from_plookup_accumulators(id, accumulators, a_idx, b_idx)[plookup::ColumnIdx::C3][0];
+}
 }
 namespace bb {
 
@@ -916,4 +923,52 @@ TEST(UltraCircuitBuilder, CheckCircuitShowcase)
     EXPECT_EQ(CircuitChecker::check(builder), true);
 }
 
+TEST(UltraCircuitBuilder, MergeSubBuilders)
+{
+    UltraCircuitBuilder builder;
+    const uint32_t a_idx = builder.add_variable(100);
+    const uint32_t b_idx = builder.add_variable(200);
+    builder.create_new_range_constraint(b_idx, 255);
+    create_lookup(builder, plookup::MultiTableId::UINT32_AND, a_idx, b_idx);
+    const size_t num_shared_variables = builder.get_num_variables();
+
+    // Lookups on a new and an existing table, range constraints, constants and copy constraints on shared variables
+    UltraCircuitBuilder first = builder.create_sub_builder();
+    const uint32_t xor_idx = create_lookup(first, plookup::MultiTableId::UINT32_XOR, a_idx, b_idx);
+    create_lookup(first, plookup::MultiTableId::UINT32_AND, xor_idx, b_idx);
+    first.create_new_range_constraint(xor_idx, 511);
+    first.create_new_range_constraint(a_idx, 127);
+    first.assert_equal_constant(xor_idx, 100 ^ 200);
+
+    // ROM reads, the same constant and a tighter range on a variable that is range constrained in the parent
+    UltraCircuitBuilder second = builder.create_sub_builder();
+    const size_t rom_id = second.create_ROM_array(2);
+    second.set_ROM_element(rom_id, 0, a_idx);
+    second.set_ROM_element(rom_id, 1, b_idx);
+    second.assert_equal(second.read_ROM_array(rom_id, second.add_variable(1)), b_idx);
+    second.create_new_range_constraint(b_idx, 200);
+    second.assert_equal_constant(second.add_variable(100 ^ 200), 100 ^ 200);
+
+    builder.merge_sub_builder(std::move(first), num_shared_variables);
+    builder.merge_sub_builder(std::move(second), num_shared_variables);
+
+    EXPECT_EQ(builder.rom_ram_logic.rom_arrays.size(), 1UL);
+    EXPECT_FALSE(builder.failed());
+    EXPECT_TRUE(CircuitChecker::check(builder));
+}
+
+TEST(UltraCircuitBuilder, MergeSubBuilderFailure)
+{
+    UltraCircuitBuilder builder;
+    const uint32_t a_idx = builder.add_variable(100);
+    const size_t num_shared_variables = builder.get_num_variables();
+
+    UltraCircuitBuilder sub_builder = builder.create_sub_builder();
+    sub_builder.create_new_range_constraint(a_idx, 63);
+    builder.merge_sub_builder(std::move(sub_builder), num_shared_variables);
+
+    EXPECT_TRUE(builder.failed());
+    EXPECT_FALSE(CircuitChecker::check(builder));
+}
+
 } // namespace bb
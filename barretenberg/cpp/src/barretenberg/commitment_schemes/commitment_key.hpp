@@ -16,6 +16,7 @@
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/constants.hpp"
 #include "barretenberg/ecc/batched_affine_addition/batched_affine_addition.hpp"
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
@@ -25,8 +26,11 @@
 #include "barretenberg/srs/global_crs.hpp"
 
 #include <cstddef>
+#include <filesystem>
+#include <limits>
 #include <memory>
 #include <string_view>
+#include <vector>
 
 namespace bb {
 /**
@@ -57,6 +61,8 @@ template <class Curve> class CommitmentKey {
   public:
     std::shared_ptr<srs::factories::Crs<Curve>> srs;
     size_t dyadic_size;
+    // Precomputed multiples of the SRS points, only present if fixed-base mode has been enabled
+    std::shared_ptr<scalar_multiplication::FixedBaseTable<Curve>> fixed_base_table;
 
     CommitmentKey() = default;
 
@@ -78,6 +84,23 @@ template <class Curve> class CommitmentKey {
      */
     bool initialized() const { return srs != nullptr; }
 
+    /**
+     * @brief Opt in to fixed-base commitments using a precomputed table of windowed multiples of the SRS points
+     * @details The table trades memory for a bucket-free lookup-and-add MSM (see FixedBaseTable). It covers as many
+     * leading SRS points as `memory_budget` allows; commitments to polynomials extending past the covered range fall
+     * back to Pippenger. The table is cached in `cache_dir` so that subsequent processes only need to map it.
+     *
+     * @param memory_budget maximum size of the table in bytes
+     * @param cache_dir directory for the on-disk table cache; pass an empty path to keep the table in memory only
+     */
+    void enable_fixed_base_mode(size_t memory_budget, const std::filesystem::path& cache_dir = srs::bb_crs_path())
+    {
+        std::span<const G1> points = srs->get_monomial_points();
+        points = points.subspan(0, std::min(points.size(), dyadic_size));
+        fixed_base_table = scalar_multiplication::FixedBaseTable<Curve>::create(points, memory_budget, cache_dir);
+    }
+    bool fixed_base_mode_enabled() const { return fixed_base_table != nullptr; }
+
     /**
      * @brief Uses the ProverSRS to create a commitment to p(X)
      *
@@ -99,11 +122,74 @@ template <class Curve> class CommitmentKey {
                                   srs->get_monomial_size()));
         }
 
+        if (fixed_base_table != nullptr && consumed_srs <= fixed_base_table->get_num_points()) {
+            return fixed_base_table->msm(polynomial);
+        }
+
         G1 r = scalar_multiplication::pippenger_unsafe<Curve>(polynomial, point_table);
         Commitment point(r);
         return point;
     };
 
+    /**
+     * @brief Commits to several polynomials with a single batched MSM
+     * @details Rather than running a parallel Pippenger per polynomial, the non-zero scalars of all polynomials in a
+     * batch are split into equal work units across threads. This keeps every thread busy when committing to many small
+     * or sparse polynomials, where per-polynomial parallelism is poor. Falls back to commit() per polynomial when
+     * fixed-base mode is enabled.
+     *
+     * @param polynomials the polynomials to commit to
+     * @param max_batch_size maximum number of polynomials per MSM batch, bounds the memory used for scalar indices
+     * @return the commitments, in the order of the polynomials
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials,
+                                         size_t max_batch_size = std::numeric_limits<size_t>::max()) const
+    {
+        PROFILE_THIS_NAME("batch_commit");
+        std::vector<Commitment> commitments(polynomials.size(), Curve::Group::affine_point_at_infinity);
+        if (fixed_base_table != nullptr) {
+            for (size_t i = 0; i < polynomials.size(); ++i) {
+                commitments[i] = commit(polynomials[i]);
+            }
+            return commitments;
+        }
+
+        std::span<const G1> point_table = srs->get_monomial_points();
+        for (size_t batch_start = 0; batch_start < polynomials.size();) {
+            std::vector<std::span<const G1>> points;
+            std::vector<std::span<Fr>> scalars;
+            std::vector<size_t> batch_indices;
+            for (size_t i = batch_start; i < polynomials.size() && batch_indices.size() < max_batch_size; ++i) {
+                batch_start = i + 1;
+                const auto& polynomial = polynomials[i];
+                if (polynomial.size() == 0) {
+                    continue;
+                }
+                size_t consumed_srs = polynomial.start_index + polynomial.size();
+                if (consumed_srs > srs->get_monomial_size()) {
+                    throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                          consumed_srs,
+                                          " points with an SRS of size ",
+                                          srs->get_monomial_size()));
+                }
+                // The MSM converts the scalars out of Montgomery form and back in place, see MSM::msm.
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+                scalars.emplace_back(const_cast<Fr*>(polynomial.span.data()), polynomial.size());
+                points.emplace_back(point_table.subspan(polynomial.start_index));
+                batch_indices.push_back(i);
+            }
+            if (batch_indices.empty()) {
+                continue;
+            }
+
+            auto results = scalar_multiplication::MSM<Curve>::batch_multi_scalar_mul(points, scalars, false);
+            for (size_t i = 0; i < batch_indices.size(); ++i) {
+                commitments[batch_indices[i]] = results[i];
+            }
+        }
+        return commitments;
+    }
+
     /**
      * @brief Efficiently commit to a polynomial whose nonzero elements are arranged in discrete blocks
      * @details Given a set of ranges where the polynomial takes non-zero values, copy the non-zero inputs (scalars,
@@ -178,6 +178,70 @@ TYPED_TEST(CommitmentKeyTest, CommitSRSCheck)
     EXPECT_EQ(commit_result, full_commit_result);
 }
 
+// Check that fixed-base mode commits agree with Pippenger, including past the range covered by the table
+TYPED_TEST(CommitmentKeyTest, CommitFixedBase)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+    using Table = scalar_multiplication::FixedBaseTable<Curve>;
+
+    const size_t num_points = 1024;
+    const size_t num_covered_points = 512;
+
+    Polynomial small_poly = Polynomial::random(300, num_points, 100);
+    Polynomial large_poly = Polynomial::random(num_points);
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 expected_small = key.commit(small_poly);
+    G1 expected_large = key.commit(large_poly);
+
+    // Only leave room for a prefix of the SRS
+    key.enable_fixed_base_mode(Table::get_table_size_in_bytes(num_covered_points, Table::MIN_WINDOW_BITS),
+                               /*cache_dir=*/{});
+    ASSERT_TRUE(key.fixed_base_mode_enabled());
+    EXPECT_EQ(key.fixed_base_table->get_num_points(), num_covered_points);
+
+    EXPECT_EQ(key.commit(small_poly), expected_small);
+    EXPECT_EQ(key.commit(large_poly), expected_large);
+}
+
+// Check that batch commits agree with individual commits, for polynomials of various sizes and offsets
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1024;
+
+    std::vector<Polynomial> polys;
+    polys.push_back(Polynomial::random(num_points));
+    polys.push_back(Polynomial::random(5, num_points, 1)); // small enough to skip pippenger
+    polys.push_back(Polynomial(0, num_points));            // empty
+    polys.push_back(Polynomial::random(300, num_points, 100));
+    Polynomial sparse_poly(600, num_points);
+    for (size_t i = 0; i < sparse_poly.size(); i += 7) {
+        sparse_poly.at(i) = Fr::random_element();
+    }
+    polys.push_back(std::move(sparse_poly));
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<PolynomialSpan<const Fr>> spans(polys.begin(), polys.end());
+    std::vector<G1> expected;
+    for (const auto& poly : polys) {
+        expected.push_back(key.commit(poly));
+    }
+
+    EXPECT_EQ(key.batch_commit(spans), expected);
+    // Batches smaller than the number of polynomials give the same results
+    EXPECT_EQ(key.batch_commit(spans, 2), expected);
+}
+
 /**
  * @brief Test commit_structured on polynomial with blocks of non-zero values (like wires when using structured trace)
  *
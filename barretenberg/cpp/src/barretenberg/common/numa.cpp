@@ -0,0 +1,300 @@
+#include "barretenberg/common/numa.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+
+#if defined(__linux__) && !defined(__wasm__)
+#define BB_NUMA_SUPPORTED
+#include <linux/mempolicy.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bb::numa {
+namespace {
+
+struct Topology {
+    // OS node id and CPUs of each node
+    std::vector<size_t> node_ids;
+    std::vector<std::vector<size_t>> node_cpus;
+    // Node index of each OS CPU id
+    std::vector<size_t> cpu_nodes;
+};
+
+/**
+ * @brief Parse a sysfs CPU/node list such as "0-3,8-11"
+ */
+std::vector<size_t> parse_list(const std::string& list)
+{
+    std::vector<size_t> result;
+    const char* position = list.c_str();
+    while (*position >= '0' && *position <= '9') {
+        char* end = nullptr;
+        const size_t first = std::strtoul(position, &end, 10);
+        size_t last = first;
+        if (*end == '-') {
+            last = std::strtoul(end + 1, &end, 10);
+        }
+        for (size_t i = first; i <= last; ++i) {
+            result.push_back(i);
+        }
+        position = *end == ',' ? end + 1 : end;
+    }
+    return result;
+}
+
+std::string read_line(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+Topology read_topology()
+{
+    Topology topology;
+#ifdef BB_NUMA_SUPPORTED
+    for (size_t node_id : parse_list(read_line("/sys/devices/system/node/online"))) {
+        auto cpus = parse_list(read_line("/sys/devices/system/node/node" + std::to_string(node_id) + "/cpulist"));
+        // Memory-only nodes can't run our threads, skip them
+        if (cpus.empty()) {
+            continue;
+        }
+        for (size_t cpu : cpus) {
+            if (topology.cpu_nodes.size() <= cpu) {
+                topology.cpu_nodes.resize(cpu + 1, 0);
+            }
+            topology.cpu_nodes[cpu] = topology.node_ids.size();
+        }
+        topology.node_ids.push_back(node_id);
+        topology.node_cpus.push_back(std::move(cpus));
+    }
+#endif
+    if (topology.node_ids.empty()) {
+        topology.node_ids = { 0 };
+        topology.node_cpus = { {} };
+    }
+    return topology;
+}
+
+const Topology& get_topology()
+{
+    static const Topology topology = read_topology();
+    return topology;
+}
+
+Policy get_default_policy()
+{
+    const char* value = std::getenv("BB_NUMA_POLICY");
+    return value == nullptr ? Policy::None : parse_policy(value);
+}
+
+std::atomic<Policy>& get_policy_storage()
+{
+    static std::atomic<Policy> policy = get_default_policy();
+    return policy;
+}
+
+// Node the calling thread has been pinned to, if any
+thread_local size_t pinned_node = static_cast<size_t>(-1);
+
+#ifdef BB_NUMA_SUPPORTED
+bool mbind_nodes(void* data, size_t size, int mode, const std::vector<size_t>& nodes)
+{
+    constexpr size_t BITS_PER_WORD = 8 * sizeof(unsigned long);
+    const auto& topology = get_topology();
+    size_t max_node_id = 0;
+    for (size_t node : nodes) {
+        max_node_id = std::max(max_node_id, topology.node_ids[node]);
+    }
+    std::vector<unsigned long> mask(max_node_id / BITS_PER_WORD + 1, 0);
+    for (size_t node : nodes) {
+        const size_t node_id = topology.node_ids[node];
+        mask[node_id / BITS_PER_WORD] |= 1UL << (node_id % BITS_PER_WORD);
+    }
+    // The kernel reads maxnode - 1 bits of the mask
+    const unsigned long max_node = mask.size() * BITS_PER_WORD + 1;
+    return syscall(SYS_mbind, data, size, mode, mask.data(), max_node, MPOL_MF_MOVE) == 0;
+}
+#endif
+} // namespace
+
+Policy parse_policy(const std::string& name)
+{
+    if (name == "none") {
+        return Policy::None;
+    }
+    if (name == "interleave") {
+        return Policy::Interleave;
+    }
+    if (name == "partition") {
+        return Policy::Partition;
+    }
+    throw_or_abort("Unknown NUMA policy: " + name + " (expected none, interleave or partition)");
+}
+
+std::string get_policy_name(Policy policy)
+{
+    switch (policy) {
+    case Policy::None:
+        return "none";
+    case Policy::Interleave:
+        return "interleave";
+    case Policy::Partition:
+        return "partition";
+    }
+    return "unknown";
+}
+
+void set_policy(Policy policy)
+{
+    get_policy_storage() = policy;
+}
+
+Policy get_policy()
+{
+    return get_policy_storage();
+}
+
+size_t get_num_nodes()
+{
+    return get_topology().node_ids.size();
+}
+
+const std::vector<size_t>& get_node_cpus(size_t node)
+{
+    return get_topology().node_cpus[node];
+}
+
+size_t get_current_node()
+{
+    if (pinned_node != static_cast<size_t>(-1)) {
+        return pinned_node;
+    }
+#ifdef BB_NUMA_SUPPORTED
+    const auto& cpu_nodes = get_topology().cpu_nodes;
+    const int cpu = sched_getcpu();
+    if (cpu >= 0 && static_cast<size_t>(cpu) < cpu_nodes.size()) {
+        return cpu_nodes[static_cast<size_t>(cpu)];
+    }
+#endif
+    return 0;
+}
+
+size_t get_num_active_nodes()
+{
+    return get_policy() == Policy::None ? 1 : get_num_nodes();
+}
+
+size_t get_num_partitions()
+{
+    return get_policy() == Policy::Partition ? get_num_nodes() : 1;
+}
+
+size_t get_worker_node(size_t worker_index, size_t num_workers)
+{
+    const size_t num_nodes = get_num_nodes();
+    if (num_nodes == 1) {
+        return 0;
+    }
+    size_t total_cpus = 0;
+    for (size_t node = 0; node < num_nodes; ++node) {
+        total_cpus += get_node_cpus(node).size();
+    }
+    // Thread slot 0 is the thread driving the pool, workers take slots 1..num_workers
+    const size_t slot = get_partition_start(worker_index + 1, num_workers + 1, total_cpus);
+    size_t cpus_before = 0;
+    for (size_t node = 0; node < num_nodes; ++node) {
+        cpus_before += get_node_cpus(node).size();
+        if (slot < cpus_before) {
+            return node;
+        }
+    }
+    return num_nodes - 1;
+}
+
+bool pin_current_thread_to_node(size_t node)
+{
+#ifdef BB_NUMA_SUPPORTED
+    const auto& cpus = get_node_cpus(node);
+    if (cpus.empty()) {
+        return false;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (size_t cpu : cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &cpu_set);
+        }
+    }
+    if (sched_setaffinity(0, sizeof(cpu_set), &cpu_set) != 0) {
+        return false;
+    }
+    pinned_node = node;
+    return true;
+#else
+    static_cast<void>(node);
+    return false;
+#endif
+}
+
+bool place_memory(void* data, size_t size)
+{
+    const Policy policy = get_policy();
+    const size_t num_nodes = get_num_nodes();
+    if (policy == Policy::None || num_nodes == 1 || size < MIN_PLACEMENT_BYTES) {
+        return false;
+    }
+#ifdef BB_NUMA_SUPPORTED
+    // mbind works on whole pages: shrink the range to the pages fully inside the buffer
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = reinterpret_cast<uintptr_t>(data);
+    const uintptr_t aligned_begin = (begin + page_size - 1) & ~(page_size - 1);
+    const uintptr_t aligned_end = (begin + size) & ~(page_size - 1);
+    if (aligned_end <= aligned_begin) {
+        return false;
+    }
+    const size_t num_pages = (aligned_end - aligned_begin) / page_size;
+
+    bool success = true;
+    if (policy == Policy::Interleave) {
+        std::vector<size_t> nodes(num_nodes);
+        for (size_t node = 0; node < num_nodes; ++node) {
+            nodes[node] = node;
+        }
+        success = mbind_nodes(
+            reinterpret_cast<void*>(aligned_begin), aligned_end - aligned_begin, MPOL_INTERLEAVE, nodes);
+    } else {
+        for (size_t node = 0; node < num_nodes; ++node) {
+            const size_t first_page = get_partition_start(node, num_nodes, num_pages);
+            const size_t end_page = get_partition_start(node + 1, num_nodes, num_pages);
+            if (end_page == first_page) {
+                continue;
+            }
+            // Preferred rather than bind, so that a full node spills over instead of failing the allocation
+            success &= mbind_nodes(reinterpret_cast<void*>(aligned_begin + first_page * page_size),
+                                   (end_page - first_page) * page_size,
+                                   MPOL_PREFERRED,
+                                   { node });
+        }
+    }
+    if (!success) {
+        static std::atomic<bool> warned = false;
+        if (!warned.exchange(true)) {
+            info("Warning: failed to apply NUMA policy ", get_policy_name(policy), " to polynomial memory");
+        }
+    }
+    return success;
+#else
+    static_cast<void>(data);
+    return false;
+#endif
+}
+
+} // namespace bb::numa
@@ -0,0 +1,82 @@
+#pragma once
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @brief NUMA placement policy for polynomial memory and worker threads
+ *
+ * @details By default (Policy::None) memory lands wherever the first write to it happens and threads float freely,
+ * which on a multi-socket machine means roughly half of all polynomial reads in MSMs and sumcheck go to the remote
+ * node. The other policies:
+ *  - Interleave: large allocations are interleaved page by page across all nodes, and parallel_for workers are pinned
+ *    to nodes. Bandwidth is balanced but half of all accesses remain remote.
+ *  - Partition: large allocations are split into one contiguous part per node (part k on node k), workers are pinned,
+ *    and each parallel_for hands out the k-th contiguous block of iterations to node k's threads first. Since
+ *    parallel_for_range and parallel_for_heuristic split their index range into contiguous chunks, a loop over a
+ *    polynomial mostly reads memory local to the thread doing the work.
+ *
+ * Nodes are identified by their index 0..get_num_nodes()-1 (not necessarily the OS node id). On machines with a single
+ * node, or when the topology can't be read (non-Linux, WASM), everything here is a no-op.
+ *
+ * The policy defaults to the BB_NUMA_POLICY environment variable ("none", "interleave" or "partition") and can be set
+ * from the bb CLI with --numa. Worker threads are pinned when the thread pool starts, so the policy must be set before
+ * the first parallel_for call for pinning to take effect.
+ */
+namespace bb::numa {
+
+enum class Policy { None, Interleave, Partition };
+
+Policy parse_policy(const std::string& name);
+std::string get_policy_name(Policy policy);
+
+void set_policy(Policy policy);
+Policy get_policy();
+
+// Number of NUMA nodes with CPUs or memory attached; 1 if unknown
+size_t get_num_nodes();
+// The CPUs of a node, as OS CPU ids
+const std::vector<size_t>& get_node_cpus(size_t node);
+// Node of the calling thread: the node it is pinned to, or else the node of the CPU it is running on
+size_t get_current_node();
+
+// Number of nodes threads and memory are spread over: get_num_nodes() unless the policy is None
+size_t get_num_active_nodes();
+// Number of blocks parallel_for splits its iterations into: get_num_nodes() if the policy is Partition, otherwise 1
+size_t get_num_partitions();
+
+/**
+ * @brief Start of the part of [0, count) owned by partition `index` out of `num_partitions`
+ * @details Partition k owns [get_partition_start(k, n, count), get_partition_start(k + 1, n, count)).
+ */
+inline size_t get_partition_start(size_t index, size_t num_partitions, size_t count)
+{
+    // Splitting via 128-bit arithmetic avoids overflow for byte counts
+    return static_cast<size_t>((static_cast<unsigned __int128>(count) * index) / num_partitions);
+}
+
+/**
+ * @brief Node that worker `worker_index` of a pool of `num_workers` threads should be pinned to
+ * @details Threads are spread over the nodes in proportion to their CPU counts; slot 0 is left for the thread that
+ * drives the pool.
+ */
+size_t get_worker_node(size_t worker_index, size_t num_workers);
+
+/**
+ * @brief Pin the calling thread to the CPUs of a node
+ * @return false if pinning is not supported or failed
+ */
+bool pin_current_thread_to_node(size_t node);
+
+// Allocations smaller than this are left alone, as the placement syscalls would cost more than they save
+constexpr size_t MIN_PLACEMENT_BYTES = 1UL << 21;
+
+/**
+ * @brief Apply the current policy to a freshly allocated buffer
+ * @details Pages that were already touched are migrated. Does nothing if the policy is None, the machine has a single
+ * node or the buffer is smaller than MIN_PLACEMENT_BYTES.
+ * @return true if a placement was applied
+ */
+bool place_memory(void* data, size_t size);
+
+} // namespace bb::numa
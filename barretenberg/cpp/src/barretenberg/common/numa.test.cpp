@@ -0,0 +1,63 @@
+#include "barretenberg/common/numa.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+TEST(Numa, ParsePolicy)
+{
+    for (auto policy : { numa::Policy::None, numa::Policy::Interleave, numa::Policy::Partition }) {
+        EXPECT_EQ(numa::parse_policy(numa::get_policy_name(policy)), policy);
+    }
+}
+
+TEST(Numa, PartitionsCoverRange)
+{
+    for (size_t num_partitions : { 1UL, 2UL, 3UL, 8UL }) {
+        for (size_t count : { 0UL, 1UL, 7UL, 1000UL }) {
+            EXPECT_EQ(numa::get_partition_start(0, num_partitions, count), 0UL);
+            EXPECT_EQ(numa::get_partition_start(num_partitions, num_partitions, count), count);
+            for (size_t i = 0; i < num_partitions; ++i) {
+                const size_t size = numa::get_partition_start(i + 1, num_partitions, count) -
+                                    numa::get_partition_start(i, num_partitions, count);
+                EXPECT_LE(size, count / num_partitions + 1);
+            }
+        }
+    }
+}
+
+TEST(Numa, Topology)
+{
+    const size_t num_nodes = numa::get_num_nodes();
+    EXPECT_GE(num_nodes, 1UL);
+    EXPECT_LT(numa::get_current_node(), num_nodes);
+    for (size_t worker = 0; worker < 16; ++worker) {
+        EXPECT_LT(numa::get_worker_node(worker, 16), num_nodes);
+    }
+}
+
+TEST(Numa, PolicyIsNoOpOnSingleNode)
+{
+    const numa::Policy original = numa::get_policy();
+    std::vector<uint8_t> buffer(2 * numa::MIN_PLACEMENT_BYTES);
+    for (auto policy : { numa::Policy::None, numa::Policy::Interleave, numa::Policy::Partition }) {
+        numa::set_policy(policy);
+        // Too small to be worth placing
+        EXPECT_FALSE(numa::place_memory(buffer.data(), 64));
+        const bool placed = numa::place_memory(buffer.data(), buffer.size());
+        if (policy == numa::Policy::None || numa::get_num_nodes() == 1) {
+            EXPECT_FALSE(placed);
+        }
+        EXPECT_EQ(numa::get_num_partitions(), policy == numa::Policy::Partition ? numa::get_num_nodes() : 1UL);
+
+        // parallel_for is unaffected
+        std::vector<std::atomic<size_t>> visits(1000);
+        parallel_for(visits.size(), [&](size_t i) { visits[i]++; });
+        for (const auto& count : visits) {
+            EXPECT_EQ(count, 1UL);
+        }
+    }
+    numa::set_policy(original);
+}
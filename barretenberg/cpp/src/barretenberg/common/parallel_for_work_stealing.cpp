@@ -0,0 +1,442 @@
+#include "barretenberg/common/numa.hpp"
+#include "barretenberg/common/task_group.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Run func, storing the first exception it throws rather than letting it escape a worker thread
+ */
+template <typename Func> void invoke_capturing_exception(const Func& func, std::mutex& mutex, std::exception_ptr& error)
+{
+#ifdef BB_NO_EXCEPTIONS
+    static_cast<void>(mutex);
+    static_cast<void>(error);
+    func();
+#else
+    try {
+        func();
+    } catch (...) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (!error) {
+            error = std::current_exception();
+        }
+    }
+#endif
+}
+
+void rethrow_if_set(BB_UNUSED std::exception_ptr& error)
+{
+#ifndef BB_NO_EXCEPTIONS
+    if (error) {
+        std::exception_ptr to_throw = error;
+        error = nullptr;
+        std::rethrow_exception(to_throw);
+    }
+#endif
+}
+} // namespace
+
+#ifndef NO_MULTITHREADING
+namespace {
+
+using Task = std::function<void()>;
+
+constexpr size_t NOT_A_WORKER = static_cast<size_t>(-1);
+// Index of the scheduler queue owned by this thread, or NOT_A_WORKER for threads outside the pool
+thread_local size_t current_queue_index = NOT_A_WORKER;
+// Priority of the task this thread is executing
+thread_local bb::TaskPriority current_priority = bb::TaskPriority::Normal;
+
+/**
+ * @brief A work-stealing scheduler shared by parallel_for and TaskGroup
+ *
+ * @details Every worker owns a queue (one deque per priority). A thread pushes the tasks it spawns to the back of its
+ * own queue and pops from the back too, so it works depth-first on the freshest (cache-hot) tasks. Idle threads steal
+ * from the front of other queues, i.e. the oldest and typically largest tasks. Threads outside the pool share one extra
+ * queue.
+ *
+ * A thread that has to wait for a set of tasks (the end of a parallel_for, TaskGroup::wait) keeps executing queued
+ * tasks until the condition it waits for is met, and only sleeps when there is nothing to run. That is what makes
+ * nested parallelism work: an inner parallel_for does not block its worker, and all nesting levels share the same
+ * get_num_cpus() threads.
+ *
+ * Per-queue mutexes are used instead of lock-free deques: tasks are coarse (parallel_for spawns at most one task per
+ * worker), so the queues are never hot enough for the locks to matter.
+ */
+class WorkStealingScheduler {
+  public:
+    explicit WorkStealingScheduler(size_t num_workers);
+    WorkStealingScheduler(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler(WorkStealingScheduler&& other) = delete;
+    ~WorkStealingScheduler();
+
+    WorkStealingScheduler& operator=(const WorkStealingScheduler& other) = delete;
+    WorkStealingScheduler& operator=(WorkStealingScheduler&& other) = delete;
+
+    size_t num_workers() const { return workers_.size(); }
+
+    /**
+     * @brief Queue `count` copies of task on the calling thread's queue
+     */
+    void submit(const Task& task, bb::TaskPriority priority, size_t count = 1);
+
+    /**
+     * @brief Execute queued tasks until done() returns true, sleeping when there is nothing to do
+     * @details Whoever makes done() true must call notify_waiters() afterwards.
+     */
+    template <typename Done> void wait_until(const Done& done);
+
+    void notify_waiters();
+
+  private:
+    // Spin this many times (yielding) before going to sleep when there is no work
+    static constexpr size_t SPIN_COUNT = 32;
+
+    struct alignas(64) TaskQueue {
+        std::mutex mutex;
+        std::array<std::deque<Task>, bb::NUM_TASK_PRIORITIES> tasks;
+    };
+
+    // One queue per worker, followed by the queue shared by threads outside the pool
+    std::vector<std::unique_ptr<TaskQueue>> queues_;
+    std::array<std::atomic<size_t>, bb::NUM_TASK_PRIORITIES> num_queued_{};
+    std::atomic<size_t> total_queued_ = 0;
+
+    std::mutex sleep_mutex_;
+    std::condition_variable sleep_condition_;
+    std::atomic<size_t> num_sleepers_ = 0;
+    std::atomic<bool> stop_ = false;
+
+    std::vector<std::thread> workers_;
+
+    BB_NO_PROFILE void worker_loop(size_t worker_index, size_t numa_node);
+
+    size_t get_own_queue_index() const
+    {
+        return current_queue_index == NOT_A_WORKER ? workers_.size() : current_queue_index;
+    }
+    bool try_pop(size_t queue_index, size_t priority, bool from_back, Task& task);
+    bool try_get_task(Task& task, bb::TaskPriority& priority);
+
+    static void execute(const Task& task, bb::TaskPriority priority)
+    {
+        const bb::TaskPriority previous_priority = current_priority;
+        current_priority = priority;
+        task();
+        current_priority = previous_priority;
+    }
+};
+
+WorkStealingScheduler::WorkStealingScheduler(size_t num_workers)
+{
+    queues_.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        queues_.emplace_back(std::make_unique<TaskQueue>());
+    }
+    // Reading the NUMA topology before starting the workers also guarantees that it outlives them
+    const bool pin_workers = bb::numa::get_num_nodes() > 1 && bb::numa::get_num_active_nodes() > 1;
+    workers_.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        const size_t numa_node = pin_workers ? bb::numa::get_worker_node(i, num_workers) : NOT_A_WORKER;
+        workers_.emplace_back(&WorkStealingScheduler::worker_loop, this, i, numa_node);
+    }
+}
+
+WorkStealingScheduler::~WorkStealingScheduler()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    sleep_condition_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+void WorkStealingScheduler::submit(const Task& task, bb::TaskPriority priority, size_t count)
+{
+    if (count == 0) {
+        return;
+    }
+    const auto priority_index = static_cast<size_t>(priority);
+    {
+        TaskQueue& queue = *queues_[get_own_queue_index()];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        for (size_t i = 0; i < count; ++i) {
+            queue.tasks[priority_index].push_back(task);
+        }
+        // Counted under the queue lock so that a concurrent pop can never take them below zero
+        num_queued_[priority_index] += count;
+        total_queued_ += count;
+    }
+    // A sleeper registers itself under sleep_mutex_ before re-checking total_queued_, so it either sees the tasks above
+    // or is counted here
+    if (num_sleepers_ > 0) {
+        { std::unique_lock<std::mutex> lock(sleep_mutex_); }
+        if (count == 1) {
+            sleep_condition_.notify_one();
+        } else {
+            sleep_condition_.notify_all();
+        }
+    }
+}
+
+void WorkStealingScheduler::notify_waiters()
+{
+    if (num_sleepers_ > 0) {
+        { std::unique_lock<std::mutex> lock(sleep_mutex_); }
+        sleep_condition_.notify_all();
+    }
+}
+
+bool WorkStealingScheduler::try_pop(size_t queue_index, size_t priority, bool from_back, Task& task)
+{
+    TaskQueue& queue = *queues_[queue_index];
+    std::unique_lock<std::mutex> lock(queue.mutex);
+    auto& tasks = queue.tasks[priority];
+    if (tasks.empty()) {
+        return false;
+    }
+    if (from_back) {
+        task = std::move(tasks.back());
+        tasks.pop_back();
+    } else {
+        task = std::move(tasks.front());
+        tasks.pop_front();
+    }
+    num_queued_[priority]--;
+    total_queued_--;
+    return true;
+}
+
+/**
+ * @brief Take the highest priority task available: from the back of our own queue first, otherwise steal from the
+ * front of another one
+ */
+bool WorkStealingScheduler::try_get_task(Task& task, bb::TaskPriority& priority)
+{
+    const size_t own_index = get_own_queue_index();
+    const size_t num_queues = queues_.size();
+    for (size_t priority_index = 0; priority_index < bb::NUM_TASK_PRIORITIES; ++priority_index) {
+        if (num_queued_[priority_index] == 0) {
+            continue;
+        }
+        priority = static_cast<bb::TaskPriority>(priority_index);
+        if (try_pop(own_index, priority_index, /*from_back=*/true, task)) {
+            return true;
+        }
+        for (size_t offset = 1; offset < num_queues; ++offset) {
+            if (try_pop((own_index + offset) % num_queues, priority_index, /*from_back=*/false, task)) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+template <typename Done> void WorkStealingScheduler::wait_until(const Done& done)
+{
+    while (!done()) {
+        {
+            Task task;
+            bb::TaskPriority priority{};
+            if (try_get_task(task, priority)) {
+                execute(task, priority);
+                continue;
+            }
+        }
+        bool ready = false;
+        for (size_t i = 0; i < SPIN_COUNT && !ready; ++i) {
+            std::this_thread::yield();
+            ready = done() || total_queued_ > 0;
+        }
+        if (ready) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        num_sleepers_++;
+        sleep_condition_.wait(lock, [&] { return done() || total_queued_ > 0 || stop_; });
+        num_sleepers_--;
+    }
+}
+
+void WorkStealingScheduler::worker_loop(size_t worker_index, size_t numa_node)
+{
+    current_queue_index = worker_index;
+    if (numa_node != NOT_A_WORKER) {
+        bb::numa::pin_current_thread_to_node(numa_node);
+    }
+    wait_until([this] { return stop_.load(); });
+}
+
+WorkStealingScheduler& get_scheduler()
+{
+    static WorkStealingScheduler scheduler(bb::get_num_cpus() - 1);
+    return scheduler;
+}
+
+/**
+ * @brief A contiguous block of parallel_for iterations, claimed one at a time
+ */
+struct alignas(64) IterationBlock {
+    std::atomic<size_t> next_iteration = 0;
+    size_t end = 0;
+};
+
+struct ParallelForState {
+    const std::function<void(size_t)>* func;
+    size_t num_iterations;
+    // One block per NUMA partition (see numa::get_num_partitions), or a single block covering everything
+    std::vector<IterationBlock> blocks;
+    std::atomic<size_t> num_completed = 0;
+    std::mutex exception_mutex;
+    std::exception_ptr exception;
+
+    ParallelForState(const std::function<void(size_t)>& func, size_t num_iterations, size_t num_blocks)
+        : func(&func)
+        , num_iterations(num_iterations)
+        , blocks(num_blocks)
+    {
+        for (size_t i = 0; i < num_blocks; ++i) {
+            blocks[i].next_iteration = bb::numa::get_partition_start(i, num_blocks, num_iterations);
+            blocks[i].end = bb::numa::get_partition_start(i + 1, num_blocks, num_iterations);
+        }
+    }
+
+    bool is_complete() const { return num_completed == num_iterations; }
+
+    /**
+     * @brief Run iterations until none are left to claim, starting with the block of the calling thread's node
+     */
+    void run_iterations(WorkStealingScheduler& scheduler)
+    {
+        const size_t num_blocks = blocks.size();
+        const size_t first_block = num_blocks == 1 ? 0 : bb::numa::get_current_node() % num_blocks;
+        for (size_t offset = 0; offset < num_blocks; ++offset) {
+            IterationBlock& block = blocks[(first_block + offset) % num_blocks];
+            size_t iteration = 0;
+            while ((iteration = block.next_iteration.fetch_add(1)) < block.end) {
+                invoke_capturing_exception([&] { (*func)(iteration); }, exception_mutex, exception);
+                if (num_completed.fetch_add(1) + 1 == num_iterations) {
+                    scheduler.notify_waiters();
+                }
+            }
+        }
+    }
+};
+} // namespace
+
+namespace bb {
+/**
+ * A work-stealing strategy. The calling thread queues one helper task per worker (at most one per iteration), then
+ * claims iterations from a shared atomic counter along with whichever workers pick up the helpers. Once all iterations
+ * are claimed it executes other queued tasks until the remaining iterations complete. As it never blocks a thread,
+ * parallel_for can be nested and called concurrently from several threads.
+ * Under the NUMA partition policy the iterations are split into one contiguous block per node and threads drain their
+ * own node's block before helping with the others.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    WorkStealingScheduler& scheduler = get_scheduler();
+    if (num_iterations <= 1 || scheduler.num_workers() == 0) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    // Helpers may be dequeued after we return, so the state is shared. They only touch func when they manage to claim
+    // an iteration, which can't happen once we have returned.
+    // With the NUMA partition policy, iteration blocks line up with the per-node parts of polynomial memory
+    const size_t num_blocks = std::min(numa::get_num_partitions(), num_iterations);
+    auto state = std::make_shared<ParallelForState>(func, num_iterations, num_blocks);
+
+    const size_t num_helpers = std::min(num_iterations - 1, scheduler.num_workers());
+    scheduler.submit([state, &scheduler] { state->run_iterations(scheduler); }, current_priority, num_helpers);
+    state->run_iterations(scheduler);
+    scheduler.wait_until([&] { return state->is_complete(); });
+    rethrow_if_set(state->exception);
+}
+
+TaskPriority get_current_task_priority()
+{
+    return current_priority;
+}
+
+TaskGroup::TaskGroup(TaskPriority priority)
+    : priority_(priority)
+    , state_(std::make_shared<State>())
+{}
+
+TaskGroup::~TaskGroup()
+{
+    wait_for_pending();
+}
+
+void TaskGroup::run(std::function<void()> task)
+{
+    WorkStealingScheduler& scheduler = get_scheduler();
+    state_->num_pending++;
+    scheduler.submit(
+        [state = state_, task = std::move(task), &scheduler] {
+            invoke_capturing_exception(task, state->exception_mutex, state->exception);
+            if (--state->num_pending == 0) {
+                scheduler.notify_waiters();
+            }
+        },
+        priority_);
+}
+
+void TaskGroup::wait_for_pending() const
+{
+    get_scheduler().wait_until([this] { return state_->num_pending == 0; });
+}
+
+void TaskGroup::wait()
+{
+    wait_for_pending();
+    rethrow_if_set(state_->exception);
+}
+} // namespace bb
+
+#else
+
+namespace bb {
+TaskPriority get_current_task_priority()
+{
+    return TaskPriority::Normal;
+}
+
+TaskGroup::TaskGroup(TaskPriority priority)
+    : priority_(priority)
+    , state_(std::make_shared<State>())
+{}
+
+TaskGroup::~TaskGroup() = default;
+
+// Without threads tasks run as soon as they are scheduled
+void TaskGroup::run(std::function<void()> task)
+{
+    invoke_capturing_exception(task, state_->exception_mutex, state_->exception);
+}
+
+void TaskGroup::wait_for_pending() const {}
+
+void TaskGroup::wait()
+{
+    rethrow_if_set(state_->exception);
+}
+} // namespace bb
+#endif
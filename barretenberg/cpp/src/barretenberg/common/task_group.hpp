@@ -0,0 +1,90 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace bb {
+
+/**
+ * @brief Scheduling priority of tasks submitted to the work-stealing scheduler
+ * @details Whenever a thread looks for work it takes the highest priority task available anywhere in the pool before
+ * considering lower priority ones. A task that is already running is never preempted. Tasks spawned while running a
+ * task (including the chunks of a nested parallel_for) inherit the priority of the running task.
+ */
+enum class TaskPriority : uint8_t { High = 0, Normal = 1, Low = 2 };
+constexpr size_t NUM_TASK_PRIORITIES = 3;
+
+/**
+ * @brief Priority that parallel_for and TaskGroup use by default on the calling thread
+ * @details This is the priority of the task currently being executed, or TaskPriority::Normal on threads that are not
+ * running a scheduler task.
+ */
+TaskPriority get_current_task_priority();
+
+/**
+ * @brief Runs a set of independent tasks on the work-stealing scheduler and waits for all of them
+ *
+ * @details Tasks may themselves call parallel_for or create TaskGroups: the scheduler shares its workers between all
+ * levels of nesting, so running e.g. two provers concurrently does not oversubscribe the cores. While waiting, the
+ * calling thread executes pending tasks instead of blocking.
+ *
+ * The first exception thrown by a task is rethrown from wait(). The destructor waits for outstanding tasks but does
+ * not rethrow, so call wait() explicitly if the tasks can throw.
+ *
+ * Example:
+ * @code
+ * TaskGroup group(TaskPriority::High);
+ * group.run([&] { eccvm_proof = eccvm_prover.construct_proof(); });
+ * group.run([&] { merge_proof = merge_prover.construct_proof(); });
+ * group.wait();
+ * @endcode
+ */
+class TaskGroup {
+  public:
+    struct State {
+        std::atomic<size_t> num_pending = 0;
+        std::mutex exception_mutex;
+        std::exception_ptr exception;
+    };
+
+    explicit TaskGroup(TaskPriority priority = get_current_task_priority());
+    TaskGroup(const TaskGroup& other) = delete;
+    TaskGroup(TaskGroup&& other) = delete;
+    ~TaskGroup();
+
+    TaskGroup& operator=(const TaskGroup& other) = delete;
+    TaskGroup& operator=(TaskGroup&& other) = delete;
+
+    /**
+     * @brief Schedule a task. It may start running before this call returns.
+     */
+    void run(std::function<void()> task);
+
+    /**
+     * @brief Wait for all tasks scheduled so far, helping to execute pending tasks in the meantime
+     */
+    void wait();
+
+    TaskPriority get_priority() const { return priority_; }
+
+  private:
+    TaskPriority priority_;
+    std::shared_ptr<State> state_;
+
+    void wait_for_pending() const;
+};
+
+/**
+ * @brief Run the given callables concurrently and return once all of them have completed
+ */
+template <typename... Funcs> void parallel_invoke(Funcs&&... funcs)
+{
+    TaskGroup group;
+    (group.run(std::forward<Funcs>(funcs)), ...);
+    group.wait();
+}
+
+} // namespace bb
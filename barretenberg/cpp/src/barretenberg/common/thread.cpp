@@ -34,6 +34,13 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: All of the above are flat fork-join pools: a parallel_for nested inside another (or issued concurrently
+ * from a second thread) is an error in mutex_pool and oversubscribes the cores in the others. "work_stealing" keeps
+ * per-worker task queues and lets waiting threads execute queued tasks, so nesting is allowed and independent
+ * computations (see TaskGroup in task_group.hpp) can share one pool. A flat loop costs it the same handful of lock
+ * operations per worker as mutex_pool, so it is the default. Compare parallel_for_field_element_addition and
+ * nested_parallel_for in basics_bench when changing this.
  */
 
 namespace bb {
@@ -69,6 +76,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -82,8 +91,9 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
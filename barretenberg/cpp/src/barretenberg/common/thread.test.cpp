@@ -0,0 +1,118 @@
+#include "barretenberg/common/task_group.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace bb;
+
+TEST(Thread, ParallelForVisitsEveryIterationOnce)
+{
+    for (size_t num_iterations : { 0UL, 1UL, 7UL, 1000UL }) {
+        std::vector<std::atomic<size_t>> visits(num_iterations);
+        parallel_for(num_iterations, [&](size_t i) { visits[i]++; });
+        for (const auto& count : visits) {
+            EXPECT_EQ(count, 1UL);
+        }
+    }
+}
+
+TEST(Thread, NestedParallelFor)
+{
+    const size_t num_outer = 2 * get_num_cpus() + 1;
+    const size_t num_inner = 100;
+    const size_t num_innermost = 4;
+    std::vector<std::vector<size_t>> results(num_outer, std::vector<size_t>(num_inner * num_innermost, 0));
+    parallel_for(num_outer, [&](size_t i) {
+        parallel_for(num_inner, [&](size_t j) {
+            // Third level
+            parallel_for_range(num_innermost, [&](size_t start, size_t end) {
+                for (size_t k = start; k < end; ++k) {
+                    results[i][j * num_innermost + k] += k + 1;
+                }
+            });
+        });
+    });
+    for (const auto& row : results) {
+        for (size_t j = 0; j < row.size(); ++j) {
+            EXPECT_EQ(row[j], (j % num_innermost) + 1);
+        }
+    }
+}
+
+TEST(Thread, ConcurrentParallelForFromExternalThreads)
+{
+    const size_t num_threads = 4;
+    const size_t num_iterations = 1000;
+    std::vector<size_t> sums(num_threads, 0);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            std::vector<size_t> values(num_iterations, 0);
+            parallel_for(num_iterations, [&](size_t i) { values[i] = i * (t + 1); });
+            sums[t] = std::accumulate(values.begin(), values.end(), 0UL);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (size_t t = 0; t < num_threads; ++t) {
+        EXPECT_EQ(sums[t], (t + 1) * num_iterations * (num_iterations - 1) / 2);
+    }
+}
+
+TEST(Thread, TaskGroupRunsTasksWithPriority)
+{
+    std::vector<size_t> results(16, 0);
+    std::atomic<size_t> num_high_priority = 0;
+    TaskGroup group(TaskPriority::High);
+    for (size_t i = 0; i < results.size(); ++i) {
+        group.run([&, i] {
+            num_high_priority += static_cast<size_t>(get_current_task_priority() == TaskPriority::High);
+            // Nested parallel_for inherits the priority of the task
+            parallel_for(4, [&](size_t) {
+                num_high_priority += static_cast<size_t>(get_current_task_priority() == TaskPriority::High);
+            });
+            results[i] = i * i;
+        });
+    }
+    group.wait();
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], i * i);
+    }
+    EXPECT_EQ(num_high_priority, results.size() * 5);
+}
+
+TEST(Thread, ParallelInvoke)
+{
+    size_t a = 0;
+    size_t b = 0;
+    parallel_invoke([&] { parallel_for(10, [&](size_t) {}); a = 1; }, [&] { b = 2; });
+    EXPECT_EQ(a, 1UL);
+    EXPECT_EQ(b, 2UL);
+}
+
+#ifndef BB_NO_EXCEPTIONS
+TEST(Thread, ExceptionsPropagateToCaller)
+{
+    EXPECT_THROW(parallel_for(100,
+                              [](size_t i) {
+                                  if (i == 42) {
+                                      throw std::runtime_error("iteration failed");
+                                  }
+                              }),
+                 std::runtime_error);
+
+    TaskGroup group;
+    group.run([] { throw std::runtime_error("task failed"); });
+    group.run([] {});
+    EXPECT_THROW(group.wait(), std::runtime_error);
+    // The pool is still usable afterwards
+    std::atomic<size_t> count = 0;
+    parallel_for(100, [&](size_t) { count++; });
+    EXPECT_EQ(count, 100UL);
+}
+#endif
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <exception>
@@ -28,6 +29,8 @@
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/crypto/merkle_tree/workers_parallel_for.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
 
 namespace bb::crypto::merkle_tree {
@@ -235,6 +238,22 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
      */
     void commit(const CommitCallback& on_completion);
 
+    /**
+     * @brief Serialise the uncommitted state for a later commit_prepared, without writing anything
+     */
+    void prepare_commit(const EmptyResponseCallback& on_completion);
+
+    /**
+     * @brief Write the state serialised by prepare_commit to the backing store
+     * @param deferSync Whether to leave the commit to be made durable by a later sync_commit
+     */
+    void commit_prepared(bool deferSync, const CommitCallback& on_completion);
+
+    /**
+     * @brief Flush any commits made with a deferred sync to disk
+     */
+    void sync_commit(const EmptyResponseCallback& on_completion);
+
     /**
      * @brief Rollback the uncommitted changes
      */
@@ -279,16 +298,43 @@ template <typename Store, typename HashingPolicy> class ContentAddressedAppendOn
                                                           const RequestContext& requestContext,
                                                           ReadTransaction& tx) const;
 
+    /**
+     * @brief Returns the sibling paths of many leaves, walking down the tree a level at a time so that the nodes of
+     * each level are retrieved in a single batch
+     */
+    std::vector<OptionalSiblingPath> get_sibling_paths_internal(const std::vector<index_t>& leaf_indices,
+                                                                const RequestContext& requestContext,
+                                                                ReadTransaction& tx) const;
+
+    std::vector<std::optional<SiblingPathAndIndex>> find_leaf_sibling_paths_internal(
+        const std::vector<typename Store::LeafType>& leaves,
+        const RequestContext& requestContext,
+        ReadTransaction& tx) const;
+
     std::optional<fr> find_leaf_hash(const index_t& leaf_index,
                                      const RequestContext& requestContext,
                                      ReadTransaction& tx,
                                      bool updateNodesByIndexCache = false) const;
 
+    /**
+     * @brief Fills in the siblings of the path to a leaf from the upper levels of the request's block, if they were
+     * stored. Returns the number of levels filled in and sets hash to the node on the path below them.
+     */
+    uint32_t read_upper_siblings(const index_t& leaf_index,
+                                 const RequestContext& requestContext,
+                                 OptionalSiblingPath& path,
+                                 fr& hash) const;
+
     index_t get_batch_insertion_size(const index_t& treeSize, const index_t& remainingAppendSize);
 
     void add_batch_internal(
         std::vector<fr>& values, fr& new_root, index_t& new_size, bool update_index, ReadTransaction& tx);
 
+    std::vector<std::vector<fr>> hash_subtree(const std::vector<fr>& leaves) const;
+
+    // Below this many leaves per worker, hashing a sub tree is not worth spreading across the workers
+    static constexpr size_t MIN_LEAVES_PER_HASHING_TASK = 32;
+
     std::unique_ptr<Store> store_;
     uint32_t depth_;
     uint64_t max_size_;
@@ -430,6 +476,7 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_path(cons
                 requestContext.blockNumber = blockNumber;
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.root = blockData.root;
+                requestContext.upperNodes = store_->get_block_upper_nodes(blockNumber, *tx);
                 OptionalSiblingPath optional_path = get_subtree_sibling_path_internal(index, 0, requestContext, *tx);
                 response.inner.path = optional_sibling_path_to_full_sibling_path(optional_path);
             },
@@ -561,11 +608,25 @@ std::optional<fr> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_lea
     // std::cout << "Finding leaf hash for root " << hash << " at index " << leaf_index << std::endl;
     index_t mask = static_cast<index_t>(1) << (depth_ - 1);
     index_t child_index_at_level = 0;
-    for (uint32_t i = 0; i < depth_; ++i) {
+    uint32_t start_level = 0;
+    // The stored upper levels don't populate the nodes by index cache, so only use them when that isn't needed
+    if (requestContext.upperNodes && !updateNodesByIndexCache) {
+        start_level = std::min(requestContext.upperNodes->num_levels(), depth_ - 1);
+        if (start_level > 0) {
+            std::optional<fr> node =
+                requestContext.upperNodes->get_node(start_level, leaf_index >> (depth_ - start_level));
+            if (!node.has_value()) {
+                return std::nullopt;
+            }
+            hash = node.value();
+            mask >>= start_level;
+        }
+    }
+    for (uint32_t i = start_level; i < depth_; ++i) {
 
         // Extract the node data
         NodePayload nodePayload;
-        bool success = store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted);
+        bool success = store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted, i);
         if (!success) {
             // std::cout << "No root " << hash << std::endl;
             return std::nullopt;
@@ -642,10 +703,13 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath Conten
     //           << ", leaf index: " << leaf_index << std::endl;
     fr hash = requestContext.root;
     // std::cout << "Getting sibling path for root: " << hash << std::endl;
+    uint32_t start_level = read_upper_siblings(leaf_index, requestContext, path, hash);
+    path_index -= start_level;
+    mask >>= start_level;
 
-    for (uint32_t level = 0; level < depth_ - subtree_depth; ++level) {
+    for (uint32_t level = start_level; level < depth_ - subtree_depth; ++level) {
         NodePayload nodePayload;
-        store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted);
+        store_->get_node_by_hash(hash, nodePayload, tx, requestContext.includeUncommitted, level);
         bool is_right = static_cast<bool>(leaf_index & mask);
         // std::cout << "Level: " << level << ", mask: " << mask << ", is right: " << is_right << ", parent: " << hash
         //           << ", left has value: " << nodePayload.left.has_value()
@@ -668,6 +732,89 @@ ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath Conten
     return path;
 }
 
+template <typename Store, typename HashingPolicy>
+uint32_t ContentAddressedAppendOnlyTree<Store, HashingPolicy>::read_upper_siblings(const index_t& leaf_index,
+                                                                                 const RequestContext& requestContext,
+                                                                                 OptionalSiblingPath& path,
+                                                                                 fr& hash) const
+{
+    if (!requestContext.upperNodes) {
+        return 0;
+    }
+    const BlockUpperNodesPayload& upperNodes = *requestContext.upperNodes;
+    uint32_t levels = std::min({ upperNodes.num_levels(), depth_ - 1, static_cast<uint32_t>(path.size()) });
+    for (uint32_t level = 1; level <= levels; ++level) {
+        index_t index_at_level = leaf_index >> (depth_ - level);
+        path[path.size() - level] = upperNodes.get_node(level, index_at_level ^ 1);
+    }
+    if (levels > 0) {
+        // As in a traversal, the node on the path below an empty node is the empty node at that level
+        hash = upperNodes.get_node(levels, leaf_index >> (depth_ - levels)).value_or(zero_hashes_[levels]);
+    }
+    return levels;
+}
+
+template <typename Store, typename HashingPolicy>
+std::vector<typename ContentAddressedAppendOnlyTree<Store, HashingPolicy>::OptionalSiblingPath>
+ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(
+    const std::vector<index_t>& leaf_indices, const RequestContext& requestContext, ReadTransaction& tx) const
+{
+    std::vector<OptionalSiblingPath> paths(leaf_indices.size(), OptionalSiblingPath(depth_));
+    // The node on the path of each leaf at the current level, starting from the root
+    std::vector<fr> hashes(leaf_indices.size(), requestContext.root);
+    std::vector<std::optional<NodePayload>> payloads;
+    uint32_t start_level = 0;
+    for (size_t i = 0; i < leaf_indices.size(); ++i) {
+        start_level = read_upper_siblings(leaf_indices[i], requestContext, paths[i], hashes[i]);
+    }
+    index_t mask = (index_t(1) << (depth_ - 1)) >> start_level;
+    for (uint32_t level = start_level; level < depth_; ++level) {
+        store_->get_nodes_by_hash(hashes, payloads, tx, requestContext.includeUncommitted, level);
+        for (size_t i = 0; i < leaf_indices.size(); ++i) {
+            // A node that can't be found is treated as empty, as in get_subtree_sibling_path_internal
+            NodePayload nodePayload = payloads[i].value_or(NodePayload{});
+            bool is_right = static_cast<bool>(leaf_indices[i] & mask);
+            std::optional<fr> sibling = is_right ? nodePayload.left : nodePayload.right;
+            std::optional<fr> child = is_right ? nodePayload.right : nodePayload.left;
+            hashes[i] = child.has_value() ? child.value() : zero_hashes_[level + 1];
+            paths[i][depth_ - 1 - level] = sibling;
+        }
+        mask >>= 1;
+    }
+    return paths;
+}
+
+template <typename Store, typename HashingPolicy>
+std::vector<std::optional<SiblingPathAndIndex>> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::
+    find_leaf_sibling_paths_internal(const std::vector<typename Store::LeafType>& leaves,
+                                     const RequestContext& requestContext,
+                                     ReadTransaction& tx) const
+{
+    std::vector<std::optional<index_t>> leaf_indices = store_->find_leaf_indices_from(leaves, 0, requestContext, tx);
+    std::vector<index_t> found_indices;
+    for (const auto& leaf_index : leaf_indices) {
+        if (leaf_index.has_value()) {
+            found_indices.push_back(leaf_index.value());
+        }
+    }
+    std::vector<OptionalSiblingPath> optional_paths = get_sibling_paths_internal(found_indices, requestContext, tx);
+
+    std::vector<std::optional<SiblingPathAndIndex>> leaf_paths;
+    leaf_paths.reserve(leaves.size());
+    size_t found = 0;
+    for (const auto& leaf_index : leaf_indices) {
+        if (!leaf_index.has_value()) {
+            leaf_paths.emplace_back(std::nullopt);
+            continue;
+        }
+        SiblingPathAndIndex sibling_path_and_index;
+        sibling_path_and_index.path = optional_sibling_path_to_full_sibling_path(optional_paths[found++]);
+        sibling_path_and_index.index = leaf_index.value();
+        leaf_paths.emplace_back(sibling_path_and_index);
+    }
+    return leaf_paths;
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_leaf(const index_t& leaf_index,
                                                                     bool includeUncommitted,
@@ -727,6 +874,7 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::get_leaf(const index_
                 requestContext.blockNumber = blockNumber;
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.root = blockData.root;
+                requestContext.upperNodes = store_->get_block_upper_nodes(blockNumber, *tx);
                 std::optional<fr> leaf_hash = find_leaf_hash(leaf_index, requestContext, *tx, false);
                 response.success = leaf_hash.has_value();
                 if (response.success) {
@@ -770,17 +918,13 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_indices_fro
     auto job = [=, this]() -> void {
         execute_and_report<FindLeafIndexResponse>(
             [=, this](TypedResponse<FindLeafIndexResponse>& response) {
-                response.inner.leaf_indices.reserve(leaves.size());
                 ReadTransactionPtr tx = store_->create_read_transaction();
 
                 RequestContext requestContext;
                 requestContext.includeUncommitted = includeUncommitted;
 
-                for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index =
-                        store_->find_leaf_index_from(leaf, start_index, requestContext, *tx);
-                    response.inner.leaf_indices.emplace_back(leaf_index);
-                }
+                response.inner.leaf_indices =
+                    store_->find_leaf_indices_from(leaves, start_index, requestContext, *tx);
             },
             on_completion);
     };
@@ -798,7 +942,6 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_indices_fro
     auto job = [=, this]() -> void {
         execute_and_report<FindLeafIndexResponse>(
             [=, this](TypedResponse<FindLeafIndexResponse>& response) {
-                response.inner.leaf_indices.reserve(leaves.size());
                 if (blockNumber == 0) {
                     throw std::runtime_error("Unable to find leaf index for block number 0");
                 }
@@ -817,11 +960,8 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_indices_fro
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.maxIndex = blockData.size;
 
-                for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index =
-                        store_->find_leaf_index_from(leaf, start_index, requestContext, *tx);
-                    response.inner.leaf_indices.emplace_back(leaf_index);
-                }
+                response.inner.leaf_indices =
+                    store_->find_leaf_indices_from(leaves, start_index, requestContext, *tx);
             },
             on_completion);
     };
@@ -837,26 +977,13 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_pat
     auto job = [=, this]() -> void {
         execute_and_report<FindLeafPathResponse>(
             [=, this](TypedResponse<FindLeafPathResponse>& response) {
-                response.inner.leaf_paths.reserve(leaves.size());
                 ReadTransactionPtr tx = store_->create_read_transaction();
 
                 RequestContext requestContext;
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.root = store_->get_current_root(*tx, includeUncommitted);
 
-                for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index = store_->find_leaf_index_from(leaf, 0, requestContext, *tx);
-                    if (!leaf_index.has_value()) {
-                        response.inner.leaf_paths.emplace_back(std::nullopt);
-                        continue;
-                    }
-                    OptionalSiblingPath optional_path =
-                        get_subtree_sibling_path_internal(leaf_index.value(), 0, requestContext, *tx);
-                    SiblingPathAndIndex sibling_path_and_index;
-                    sibling_path_and_index.path = optional_sibling_path_to_full_sibling_path(optional_path);
-                    sibling_path_and_index.index = leaf_index.value();
-                    response.inner.leaf_paths.emplace_back(sibling_path_and_index);
-                }
+                response.inner.leaf_paths = find_leaf_sibling_paths_internal(leaves, requestContext, *tx);
             },
             on_completion);
     };
@@ -873,7 +1000,6 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_pat
     auto job = [=, this]() -> void {
         execute_and_report<FindLeafPathResponse>(
             [=, this](TypedResponse<FindLeafPathResponse>& response) {
-                response.inner.leaf_paths.reserve(leaves.size());
                 if (blockNumber == 0) {
                     throw std::runtime_error("Unable to find leaf index for block number 0");
                 }
@@ -889,20 +1015,9 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::find_leaf_sibling_pat
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.maxIndex = blockData.size;
                 requestContext.root = blockData.root;
+                requestContext.upperNodes = store_->get_block_upper_nodes(blockNumber, *tx);
 
-                for (const auto& leaf : leaves) {
-                    std::optional<index_t> leaf_index = store_->find_leaf_index_from(leaf, 0, requestContext, *tx);
-                    if (!leaf_index.has_value()) {
-                        response.inner.leaf_paths.emplace_back(std::nullopt);
-                        continue;
-                    }
-                    OptionalSiblingPath optional_path =
-                        get_subtree_sibling_path_internal(leaf_index.value(), 0, requestContext, *tx);
-                    SiblingPathAndIndex sibling_path_and_index;
-                    sibling_path_and_index.path = optional_sibling_path_to_full_sibling_path(optional_path);
-                    sibling_path_and_index.index = leaf_index.value();
-                    response.inner.leaf_paths.emplace_back(sibling_path_and_index);
-                }
+                response.inner.leaf_paths = find_leaf_sibling_paths_internal(leaves, requestContext, *tx);
             },
             on_completion);
     };
@@ -951,6 +1066,34 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit(const CommitCa
     workers_->enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::prepare_commit(const EmptyResponseCallback& on_completion)
+{
+    auto job = [=, this]() { execute_and_report([=, this]() { store_->prepare_commit_block(); }, on_completion); };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::commit_prepared(bool deferSync,
+                                                                           const CommitCallback& on_completion)
+{
+    auto job = [=, this]() {
+        execute_and_report<CommitResponse>(
+            [=, this](TypedResponse<CommitResponse>& response) {
+                store_->commit_prepared_block(response.inner.meta, response.inner.stats, deferSync);
+            },
+            on_completion);
+    };
+    workers_->enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::sync_commit(const EmptyResponseCallback& on_completion)
+{
+    auto job = [=, this]() { execute_and_report([=, this]() { store_->sync_persisted_data(); }, on_completion); };
+    workers_->enqueue(job);
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::rollback(const RollbackCallback& on_completion)
 {
@@ -1141,24 +1284,19 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     }
 
     // Hash the values as a sub tree and insert them
-    while (number_to_insert > 1) {
-        number_to_insert >>= 1;
+    std::vector<std::vector<fr>> subtree_levels = hash_subtree(hashes_local);
+    const std::vector<fr>* below = &hashes_local;
+    for (const std::vector<fr>& current : subtree_levels) {
         index >>= 1;
         --level;
-        // std::cout << "To INSERT " << number_to_insert << std::endl;
-        for (uint32_t i = 0; i < number_to_insert; ++i) {
-            fr left = hashes_local[i * 2];
-            fr right = hashes_local[i * 2 + 1];
-            hashes_local[i] = HashingPolicy::hash_pair(left, right);
-            // std::cout << "Left: " << left << ", right: " << right << ", parent: " << hashes_local[i] << std::endl;
-            store_->put_node_by_hash(hashes_local[i], { .left = left, .right = right, .ref = 1 });
-            store_->put_cached_node_by_index(level, index + i, hashes_local[i]);
-            // std::cout << "Writing node hash " << hashes_local[i] << " level " << level << " index " << index + i
-            //           << std::endl;
+        for (index_t i = 0; i < current.size(); ++i) {
+            store_->put_node_by_hash(current[i], { .left = (*below)[i * 2], .right = (*below)[i * 2 + 1], .ref = 1 });
+            store_->put_cached_node_by_index(level, index + i, current[i]);
         }
+        below = &current;
     }
 
-    fr new_hash = hashes_local[0];
+    fr new_hash = below->front();
 
     // std::cout << "LEVEL: " << level << " hash " << new_hash << std::endl;
     RequestContext requestContext;
@@ -1201,4 +1339,47 @@ void ContentAddressedAppendOnlyTree<Store, HashingPolicy>::add_batch_internal(
     store_->put_meta(meta);
 }
 
+/**
+ * @brief Hashes a power of two number of leaves up to the root of their sub tree
+ *
+ * @details The leaves are split into a power of two number of contiguous ranges, one per task, and each task hashes
+ * the sub tree of its range level by level. The few levels above the ranges are then hashed by the calling thread.
+ * Nothing is written to the store here as it is not safe to write to from multiple threads.
+ *
+ * @return The levels of the sub tree above the leaves, from the level above the leaves up to the root
+ */
+template <typename Store, typename HashingPolicy>
+std::vector<std::vector<fr>> ContentAddressedAppendOnlyTree<Store, HashingPolicy>::hash_subtree(
+    const std::vector<fr>& leaves) const
+{
+    std::vector<std::vector<fr>> levels;
+    for (size_t level_size = leaves.size() >> 1; level_size > 0; level_size >>= 1) {
+        levels.emplace_back(level_size);
+    }
+
+    size_t num_tasks = 1;
+    while (num_tasks * 2 <= workers_->num_threads() + 1 &&
+           leaves.size() / (num_tasks * 2) >= MIN_LEAVES_PER_HASHING_TASK) {
+        num_tasks *= 2;
+    }
+    // The number of levels each task hashes before its range is reduced to a single node
+    const size_t task_depth = numeric::get_msb(leaves.size() / num_tasks);
+
+    auto hash_level_range = [&](size_t level, size_t start, size_t end) {
+        const std::vector<fr>& below = level == 0 ? leaves : levels[level - 1];
+        HashingPolicy::hash_pairs(std::span(below).subspan(start * 2, (end - start) * 2),
+                                  std::span(levels[level]).subspan(start, end - start));
+    };
+    workers_parallel_for(*workers_, num_tasks, [&](size_t task) {
+        for (size_t level = 0; level < task_depth; ++level) {
+            const size_t task_size = levels[level].size() / num_tasks;
+            hash_level_range(level, task * task_size, (task + 1) * task_size);
+        }
+    });
+    for (size_t level = task_depth; level < levels.size(); ++level) {
+        hash_level_range(level, 0, levels[level].size());
+    }
+    return levels;
+}
+
 } // namespace bb::crypto::merkle_tree
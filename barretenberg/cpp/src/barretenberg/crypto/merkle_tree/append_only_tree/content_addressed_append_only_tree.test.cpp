@@ -772,6 +772,39 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_multiple_values_in_a
     check_sibling_path_by_value(tree, VALUES[4 - 1], memdb.get_sibling_path(4 - 1), 4 - 1);
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_add_large_batches_with_multiple_workers)
+{
+    constexpr size_t depth = 12;
+    std::string name = random_string();
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    // The sub trees of large batches are hashed across the workers
+    ThreadPoolPtr pool = make_thread_pool(8);
+    TreeType tree(std::move(store), pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Start unaligned so that the batches are split into sub trees of varying sizes
+    std::vector<fr> values(3 + 1000 + 1024);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = fr::random_element();
+        memdb.update_element(i, values[i]);
+    }
+    add_values(tree, std::vector<fr>(values.begin(), values.begin() + 3));
+    add_values(tree, std::vector<fr>(values.begin() + 3, values.begin() + 1003));
+    check_size(tree, 1003);
+    add_values(tree, std::vector<fr>(values.begin() + 1003, values.end()));
+    check_size(tree, values.size());
+    check_root(tree, memdb.root());
+    for (index_t i : { 0UL, 3UL, 517UL, 1002UL, 1003UL, 2026UL }) {
+        check_sibling_path(tree, i, memdb.get_sibling_path(i));
+        check_sibling_path_by_value(tree, values[i], memdb.get_sibling_path(i), i);
+    }
+
+    commit_tree(tree);
+    check_root(tree, memdb.root(), false);
+    check_sibling_path(tree, 1500, memdb.get_sibling_path(1500), false);
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_pad_with_zero_leaves)
 {
     constexpr size_t depth = 10;
@@ -1246,6 +1279,107 @@ TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_create_images_at_histori
     commit_tree(treeAtBlock2, false);
 }
 
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, forks_share_persisted_upper_nodes)
+{
+    constexpr size_t depth = 20;
+    std::string name = random_string();
+    ThreadPoolPtr pool = make_thread_pool(1);
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    TreeType tree(std::move(store), pool);
+
+    std::vector<fr> values{ 30, 10, 20, 40, 15, 18, 26, 2 };
+    add_values(tree, values);
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(i, values[i]);
+    }
+    commit_tree(tree);
+
+    // All of the leaves are beneath a single node at each of the shared levels
+    EXPECT_EQ(db->get_node_cache().size(), static_cast<size_t>(Store::SHARED_NODE_LEVELS));
+
+    std::unique_ptr<Store> forkStore = std::make_unique<Store>(name, depth, 1, db);
+    TreeType fork(std::move(forkStore), pool);
+    check_root(fork, memdb.root());
+    check_sibling_path(fork, 3, memdb.get_sibling_path(3), false, true);
+    check_sibling_path(fork, 6, memdb.get_sibling_path(6), true, true);
+    EXPECT_EQ(db->get_node_cache().size(), static_cast<size_t>(Store::SHARED_NODE_LEVELS));
+
+    // Changes made in the fork are not shared
+    add_values(fork, { 42 });
+    memdb.update_element(values.size(), 42);
+    check_sibling_path(fork, 3, memdb.get_sibling_path(3), true, true);
+    EXPECT_EQ(db->get_node_cache().size(), static_cast<size_t>(Store::SHARED_NODE_LEVELS));
+
+    // The nodes are removed along with the block
+    unwind_block(tree, 1);
+    EXPECT_EQ(db->get_node_cache().size(), 0UL);
+}
+
+TEST_F(PersistedContentAddressedAppendOnlyTreeTest, historic_reads_use_stored_upper_nodes)
+{
+    constexpr size_t depth = 10;
+    constexpr uint32_t upperNodeLevels = 4;
+    std::string name = random_string();
+    ThreadPoolPtr pool = make_thread_pool(1);
+    LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+    db->set_upper_node_levels(upperNodeLevels);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::unique_ptr<Store> store = std::make_unique<Store>(name, depth, db);
+    TreeType tree(std::move(store), pool);
+
+    // Blocks of varying size, leaving parts of the stored levels empty
+    std::vector<size_t> blockSizes{ 3, 37, 100 };
+    std::vector<std::vector<fr_sibling_path>> blockPaths;
+    std::vector<fr> values;
+    for (size_t blockSize : blockSizes) {
+        for (size_t i = 0; i < blockSize; ++i) {
+            values.emplace_back(values.size() + 1);
+            memdb.update_element(values.size() - 1, values.back());
+        }
+        add_values(tree, std::vector<fr>(values.end() - static_cast<std::ptrdiff_t>(blockSize), values.end()));
+        commit_tree(tree);
+
+        std::vector<fr_sibling_path> paths;
+        for (index_t i = 0; i <= values.size(); ++i) {
+            paths.push_back(memdb.get_sibling_path(i));
+        }
+        blockPaths.push_back(paths);
+    }
+
+    size_t blockEnd = 0;
+    for (block_number_t blockNumber = 1; blockNumber <= blockSizes.size(); ++blockNumber) {
+        LMDBReadTransaction::Ptr tx = db->create_read_transaction();
+        BlockUpperNodesPayload upperNodes;
+        EXPECT_TRUE(db->read_block_upper_nodes(blockNumber, upperNodes, *tx));
+        EXPECT_EQ(upperNodes.num_levels(), upperNodeLevels);
+
+        blockEnd += blockSizes[blockNumber - 1];
+        const std::vector<fr_sibling_path>& paths = blockPaths[blockNumber - 1];
+        for (index_t i = 0; i < paths.size(); ++i) {
+            check_historic_sibling_path(tree, i, paths[i], blockNumber);
+        }
+        for (index_t i = 0; i < blockEnd; ++i) {
+            check_historic_leaf(tree, blockNumber, values[i], i, true);
+            check_historic_sibling_path_by_value(tree, values[i], paths[i], i, blockNumber);
+        }
+        check_historic_leaf(tree, blockNumber, fr::zero(), blockEnd, false);
+    }
+
+    // The stored nodes are removed along with the block
+    finalize_block(tree, 2);
+    remove_historic_block(tree, 1);
+    unwind_block(tree, 3);
+    LMDBReadTransaction::Ptr tx = db->create_read_transaction();
+    BlockUpperNodesPayload upperNodes;
+    EXPECT_FALSE(db->read_block_upper_nodes(1, upperNodes, *tx));
+    EXPECT_TRUE(db->read_block_upper_nodes(2, upperNodes, *tx));
+    EXPECT_FALSE(db->read_block_upper_nodes(3, upperNodes, *tx));
+}
+
 TEST_F(PersistedContentAddressedAppendOnlyTreeTest, can_remove_historic_block_data)
 {
     constexpr size_t depth = 10;
@@ -14,6 +14,8 @@
 #include "barretenberg/numeric/bitop/pow.hpp"
 #include "barretenberg/stdlib/hash/pedersen/pedersen.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
+#include <array>
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -23,6 +25,13 @@ struct PedersenHashPolicy {
 
     static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
 
+    static void hash_pairs(std::span<const fr> children, std::span<fr> parents)
+    {
+        for (size_t i = 0; i < parents.size(); ++i) {
+            parents[i] = hash_pair(children[i * 2], children[i * 2 + 1]);
+        }
+    }
+
     static fr zero_hash() { return fr::zero(); }
 };
 
@@ -32,7 +41,18 @@ struct Poseidon2HashPolicy {
         return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash(inputs);
     }
 
-    static fr hash_pair(const fr& lhs, const fr& rhs) { return hash(std::vector<fr>({ lhs, rhs })); }
+    // Called for every node of a tree, so the inputs are absorbed from the stack rather than a vector
+    static fr hash_pair(const fr& lhs, const fr& rhs)
+    {
+        const std::array<fr, 2> inputs{ lhs, rhs };
+        return bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::Sponge::hash_internal(inputs);
+    }
+
+    // Hashes the consecutive pairs of children into their parents, with batched permutations
+    static void hash_pairs(std::span<const fr> children, std::span<fr> parents)
+    {
+        bb::crypto::Poseidon2<bb::crypto::Poseidon2Bn254ScalarFieldParams>::hash_batch(children, 2, parents);
+    }
 
     static fr zero_hash() { return fr::zero(); }
 };
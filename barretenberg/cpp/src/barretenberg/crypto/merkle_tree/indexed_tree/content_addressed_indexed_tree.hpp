@@ -37,6 +37,7 @@
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/crypto/merkle_tree/workers_parallel_for.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
@@ -228,6 +229,20 @@ class ContentAddressedIndexedTree : public ContentAddressedAppendOnlyTree<Store,
     void generate_insertions(const std::shared_ptr<std::vector<std::pair<LeafValueType, index_t>>>& values_to_be_sorted,
                              const InsertionGenerationCallback& completion);
 
+    struct LowLeafLookup {
+        index_t low_leaf_index = 0;
+        bool is_already_present = false;
+        // The low leaf as it was before any of the batch was inserted
+        IndexedLeafValueType low_leaf;
+        // Set if the low leaf could not be retrieved, reported once the value is reached in sorted order
+        std::optional<std::string> error;
+    };
+    std::vector<LowLeafLookup> find_low_leaves(const std::vector<std::pair<LeafValueType, index_t>>& sorted_values,
+                                               const TreeMeta& meta) const;
+
+    // Below this many values per worker, finding low leaves is not worth spreading across the workers
+    static constexpr size_t MIN_VALUES_PER_LOW_LEAF_TASK = 16;
+
     struct InsertionUpdates {
         // On insertion, we always update a low leaf. If it's creating a new leaf, we need to update the pointer to
         // point to the new one, if it's an update to an existing leaf, we need to change its payload.
@@ -413,6 +428,7 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::get_leaf(const index_t&
                 requestContext.blockNumber = blockNumber;
                 requestContext.includeUncommitted = includeUncommitted;
                 requestContext.root = blockData.root;
+                requestContext.upperNodes = store_->get_block_upper_nodes(blockNumber, *tx);
                 std::optional<fr> leaf_hash = find_leaf_hash(index, requestContext, *tx, false);
                 if (!leaf_hash.has_value()) {
                     response.success = false;
@@ -932,153 +948,188 @@ void ContentAddressedIndexedTree<Store, HashingPolicy>::generate_insertions(
             // std::cout << "Generating insertions " << std::endl;
 
             // Now that we have the sorted values we need to identify the leaves that need updating.
-            // This is performed sequentially and is stored in this 'leaf_update' struct
+            // The low leaves are found in parallel, then the updates are chained together sequentially and stored in
+            // this 'leaf_update' struct
             response.inner.highest_index = 0;
             response.inner.low_leaf_updates = std::make_shared<std::vector<LeafUpdate>>();
             response.inner.low_leaf_updates->reserve(values.size());
             response.inner.leaves_to_append =
                 std::make_shared<std::vector<IndexedLeafValueType>>(values.size(), IndexedLeafValueType::empty());
             index_t num_leaves_to_be_inserted = values.size();
-            std::set<uint256_t> unique_values;
 
-            {
-                ReadTransactionPtr tx = store_->create_read_transaction();
-                TreeMeta meta;
-                store_->get_meta(meta);
-                RequestContext requestContext;
-                requestContext.includeUncommitted = true;
-                //  Ensure that the tree is not going to be overfilled
-                index_t new_total_size = num_leaves_to_be_inserted + meta.size;
-                if (new_total_size > max_size_) {
-                    throw std::runtime_error(format("Unable to insert values into tree ",
-                                                    meta.name,
-                                                    " new size: ",
-                                                    new_total_size,
-                                                    " max size: ",
-                                                    max_size_));
+            TreeMeta meta;
+            store_->get_meta(meta);
+            //  Ensure that the tree is not going to be overfilled
+            index_t new_total_size = num_leaves_to_be_inserted + meta.size;
+            if (new_total_size > max_size_) {
+                throw std::runtime_error(format("Unable to insert values into tree ",
+                                                meta.name,
+                                                " new size: ",
+                                                new_total_size,
+                                                " max size: ",
+                                                max_size_));
+            }
+
+            // The values are inserted in descending order, so none of the leaves inserted by this batch can be the
+            // low leaf of a later value. Every value's low leaf can therefore be found against the tree as it was
+            // before the batch, which is done across the workers
+            std::vector<LowLeafLookup> lookups = find_low_leaves(values, meta);
+
+            // Values sharing a low leaf are chained through it, each one taking the low leaf as updated by the last
+            std::unordered_map<index_t, IndexedLeafValueType> updated_low_leaves;
+            std::optional<uint256_t> previous_key;
+            for (size_t i = 0; i < values.size(); ++i) {
+                std::pair<LeafValueType, size_t>& value_pair = values[i];
+                size_t index_into_appended_leaves = value_pair.second;
+                index_t index_of_new_leaf = static_cast<index_t>(index_into_appended_leaves) + meta.size;
+                if (value_pair.first.is_empty()) {
+                    continue;
                 }
-                for (size_t i = 0; i < values.size(); ++i) {
-                    std::pair<LeafValueType, size_t>& value_pair = values[i];
-                    size_t index_into_appended_leaves = value_pair.second;
-                    index_t index_of_new_leaf = static_cast<index_t>(index_into_appended_leaves) + meta.size;
-                    if (value_pair.first.is_empty()) {
-                        continue;
-                    }
-                    fr value = value_pair.first.get_key();
-                    auto it = unique_values.insert(value);
-                    if (!it.second) {
-                        throw std::runtime_error(format(
-                            "Duplicate key not allowed in same batch, key value: ", value, ", tree: ", meta.name));
-                    }
+                fr value = value_pair.first.get_key();
+                // Equal keys are adjacent once sorted
+                if (previous_key == uint256_t(value)) {
+                    throw std::runtime_error(
+                        format("Duplicate key not allowed in same batch, key value: ", value, ", tree: ", meta.name));
+                }
+                previous_key = uint256_t(value);
 
-                    // This gives us the leaf that need updating
-                    index_t low_leaf_index = 0;
-                    bool is_already_present = false;
-
-                    requestContext.root = store_->get_current_root(*tx, true);
-                    std::tie(is_already_present, low_leaf_index) =
-                        store_->find_low_value(value_pair.first.get_key(), requestContext, *tx);
-                    // std::cout << "Found low leaf index " << low_leaf_index << std::endl;
-
-                    // Try and retrieve the leaf pre-image from the cache first.
-                    // If unsuccessful, derive from the tree and hash based lookup
-                    std::optional<IndexedLeafValueType> optional_low_leaf =
-                        store_->get_cached_leaf_by_index(low_leaf_index);
-                    IndexedLeafValueType low_leaf;
-
-                    if (optional_low_leaf.has_value()) {
-                        low_leaf = optional_low_leaf.value();
-                        // std::cout << "Found cached low leaf at index: " << low_leaf_index << " : " << low_leaf
-                        //           << std::endl;
-                    } else {
-                        // std::cout << "Looking for leaf at index " << low_leaf_index << std::endl;
-                        std::optional<fr> low_leaf_hash = find_leaf_hash(low_leaf_index, requestContext, *tx, true);
-
-                        if (!low_leaf_hash.has_value()) {
-                            // std::cout << "Failed to find low leaf" << std::endl;
-                            throw std::runtime_error(format("Unable to insert values into tree ",
-                                                            meta.name,
-                                                            ", failed to find low leaf at index ",
-                                                            low_leaf_index,
-                                                            ", current size: ",
-                                                            meta.size));
-                        }
-                        // std::cout << "Low leaf hash " << low_leaf_hash.value() << std::endl;
-
-                        std::optional<IndexedLeafValueType> low_leaf_option =
-                            store_->get_leaf_by_hash(low_leaf_hash.value(), *tx, true);
-
-                        if (!low_leaf_option.has_value()) {
-                            // std::cout << "No pre-image" << std::endl;
-                            throw std::runtime_error(format("Unable to insert values into tree ",
-                                                            meta.name,
-                                                            " failed to get leaf pre-image by hash for index ",
-                                                            low_leaf_index));
-                        }
-                        // std::cout << "Low leaf pre-image " << low_leaf_option.value() << std::endl;
-                        low_leaf = low_leaf_option.value();
-                    }
+                const LowLeafLookup& lookup = lookups[i];
+                if (lookup.error.has_value()) {
+                    throw std::runtime_error(lookup.error.value());
+                }
+                index_t low_leaf_index = lookup.low_leaf_index;
+                auto updated = updated_low_leaves.find(low_leaf_index);
+                IndexedLeafValueType low_leaf = updated == updated_low_leaves.end() ? lookup.low_leaf : updated->second;
+
+                LeafUpdate low_update = {
+                    .leaf_index = low_leaf_index,
+                    .updated_leaf = IndexedLeafValueType::empty(),
+                    .original_leaf = low_leaf,
+                };
 
-                    LeafUpdate low_update = {
-                        .leaf_index = low_leaf_index,
-                        .updated_leaf = IndexedLeafValueType::empty(),
-                        .original_leaf = low_leaf,
-                    };
-
-                    // Capture the index and original value of the 'low' leaf
-
-                    if (!is_already_present) {
-                        // Update the current leaf to point it to the new leaf
-                        IndexedLeafValueType new_leaf =
-                            IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
-
-                        low_leaf.nextIndex = index_of_new_leaf;
-                        low_leaf.nextKey = value;
-                        store_->set_leaf_key_at_index(index_of_new_leaf, new_leaf);
-
-                        // std::cout << "NEW LEAf TO BE INSERTED at index: " << index_of_new_leaf << " : " << new_leaf
-                        //           << std::endl;
-
-                        // std::cout << "Low leaf found at index " << low_leaf_index << " index of new leaf "
-                        //           << index_of_new_leaf << std::endl;
-
-                        store_->put_cached_leaf_by_index(low_leaf_index, low_leaf);
-                        // leaves_pre[low_leaf_index] = low_leaf;
-                        low_update.updated_leaf = low_leaf;
-
-                        // Update the set of leaves to append
-                        (*response.inner.leaves_to_append)[index_into_appended_leaves] = new_leaf;
-                    } else if (IndexedLeafValueType::is_updateable()) {
-                        // Update the current leaf's value, don't change it's link
-                        IndexedLeafValueType replacement_leaf =
-                            IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
-                        // IndexedLeafValueType empty_leaf = IndexedLeafValueType::empty();
-                        //  don't update the index for this empty leaf
-                        // std::cout << "Low leaf updated at index " << low_leaf_index << " index of new leaf "
-                        //           << index_of_new_leaf << std::endl;
-                        // store_->set_leaf_key_at_index(index_of_new_leaf, empty_leaf);
-                        store_->put_cached_leaf_by_index(low_leaf_index, replacement_leaf);
-                        low_update.updated_leaf = replacement_leaf;
-                        // The set of appended leaves already has an empty leaf in the slot at index
-                        // 'index_into_appended_leaves'
-                    } else {
-                        throw std::runtime_error(format("Unable to insert values into tree ",
-                                                        meta.name,
-                                                        " leaf type ",
-                                                        IndexedLeafValueType::name(),
-                                                        " is not updateable and ",
-                                                        value_pair.first.get_key(),
-                                                        " is already present"));
-                    }
-                    response.inner.highest_index = std::max(response.inner.highest_index, low_leaf_index);
+                // Capture the index and original value of the 'low' leaf
+
+                if (!lookup.is_already_present) {
+                    // Update the current leaf to point it to the new leaf
+                    IndexedLeafValueType new_leaf =
+                        IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
+
+                    low_leaf.nextIndex = index_of_new_leaf;
+                    low_leaf.nextKey = value;
+                    store_->set_leaf_key_at_index(index_of_new_leaf, new_leaf);
+
+                    store_->put_cached_leaf_by_index(low_leaf_index, low_leaf);
+                    updated_low_leaves[low_leaf_index] = low_leaf;
+                    low_update.updated_leaf = low_leaf;
 
-                    response.inner.low_leaf_updates->push_back(low_update);
+                    // Update the set of leaves to append
+                    (*response.inner.leaves_to_append)[index_into_appended_leaves] = new_leaf;
+                } else if (IndexedLeafValueType::is_updateable()) {
+                    // Update the current leaf's value, don't change it's link
+                    IndexedLeafValueType replacement_leaf =
+                        IndexedLeafValueType(value_pair.first, low_leaf.nextIndex, low_leaf.nextKey);
+                    store_->put_cached_leaf_by_index(low_leaf_index, replacement_leaf);
+                    updated_low_leaves[low_leaf_index] = replacement_leaf;
+                    low_update.updated_leaf = replacement_leaf;
+                    // The set of appended leaves already has an empty leaf in the slot at index
+                    // 'index_into_appended_leaves'
+                } else {
+                    throw std::runtime_error(format("Unable to insert values into tree ",
+                                                    meta.name,
+                                                    " leaf type ",
+                                                    IndexedLeafValueType::name(),
+                                                    " is not updateable and ",
+                                                    value_pair.first.get_key(),
+                                                    " is already present"));
                 }
+                response.inner.highest_index = std::max(response.inner.highest_index, low_leaf_index);
+
+                response.inner.low_leaf_updates->push_back(low_update);
             }
         },
         completion);
 }
 
+template <typename Store, typename HashingPolicy>
+std::vector<typename ContentAddressedIndexedTree<Store, HashingPolicy>::LowLeafLookup> ContentAddressedIndexedTree<
+    Store,
+    HashingPolicy>::find_low_leaves(const std::vector<std::pair<LeafValueType, index_t>>& sorted_values,
+                                    const TreeMeta& meta) const
+{
+    std::vector<LowLeafLookup> lookups(sorted_values.size());
+    // Each task looks up a contiguous range of the sorted values, i.e. a range of the key space
+    const size_t num_tasks = std::clamp(
+        sorted_values.size() / MIN_VALUES_PER_LOW_LEAF_TASK, static_cast<size_t>(1), workers_->num_threads() + 1);
+    const size_t task_size = (sorted_values.size() + num_tasks - 1) / num_tasks;
+
+    workers_parallel_for(*workers_, num_tasks, [&](size_t task) {
+        const size_t start = task * task_size;
+        const size_t end = std::min(start + task_size, sorted_values.size());
+        if (start >= end) {
+            return;
+        }
+        size_t i = start;
+        // Any failure is recorded against the value being looked up and the rest of the range is abandoned, the
+        // values before it will be reported first if they have failed too
+        try {
+            ReadTransactionPtr tx = store_->create_read_transaction();
+            RequestContext requestContext;
+            requestContext.includeUncommitted = true;
+            requestContext.root = store_->get_current_root(*tx, true);
+            const LowLeafLookup* previous = nullptr;
+            for (; i < end; ++i) {
+                if (sorted_values[i].first.is_empty()) {
+                    continue;
+                }
+                LowLeafLookup& lookup = lookups[i];
+                std::tie(lookup.is_already_present, lookup.low_leaf_index) =
+                    store_->find_low_value(sorted_values[i].first.get_key(), requestContext, *tx);
+
+                // Values sharing a low leaf are adjacent, so the low leaf only needs retrieving once per range
+                if (previous != nullptr && previous->low_leaf_index == lookup.low_leaf_index) {
+                    lookup.low_leaf = previous->low_leaf;
+                    previous = &lookup;
+                    continue;
+                }
+                previous = &lookup;
+
+                // Try and retrieve the leaf pre-image from the cache first.
+                // If unsuccessful, derive from the tree and hash based lookup
+                std::optional<IndexedLeafValueType> optional_low_leaf =
+                    store_->get_cached_leaf_by_index(lookup.low_leaf_index);
+                if (optional_low_leaf.has_value()) {
+                    lookup.low_leaf = optional_low_leaf.value();
+                    continue;
+                }
+                std::optional<fr> low_leaf_hash = find_leaf_hash(lookup.low_leaf_index, requestContext, *tx, true);
+
+                if (!low_leaf_hash.has_value()) {
+                    throw std::runtime_error(format("Unable to insert values into tree ",
+                                                    meta.name,
+                                                    ", failed to find low leaf at index ",
+                                                    lookup.low_leaf_index,
+                                                    ", current size: ",
+                                                    meta.size));
+                }
+
+                std::optional<IndexedLeafValueType> low_leaf_option =
+                    store_->get_leaf_by_hash(low_leaf_hash.value(), *tx, true);
+
+                if (!low_leaf_option.has_value()) {
+                    throw std::runtime_error(format("Unable to insert values into tree ",
+                                                    meta.name,
+                                                    " failed to get leaf pre-image by hash for index ",
+                                                    lookup.low_leaf_index));
+                }
+                lookup.low_leaf = low_leaf_option.value();
+            }
+        } catch (std::exception& e) {
+            lookups[i].error = e.what();
+        }
+    });
+    return lookups;
+}
+
 template <typename Store, typename HashingPolicy>
 void ContentAddressedIndexedTree<Store, HashingPolicy>::update_leaf_and_hash_to_root(
     const index_t& leaf_index,
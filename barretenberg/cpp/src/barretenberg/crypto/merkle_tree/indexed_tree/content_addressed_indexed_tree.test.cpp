@@ -21,6 +21,7 @@
 #include <future>
 #include <memory>
 #include <optional>
+#include <set>
 #include <stdexcept>
 #include <vector>
 
@@ -300,6 +301,23 @@ void add_values_sequentially(TypeOfTree& tree, const std::vector<LeafValueType>&
     signal.wait_for_level();
 }
 
+template <typename LeafValueType, typename TypeOfTree>
+AddIndexedDataResponse<LeafValueType> add_values_with_witness(TypeOfTree& tree,
+                                                              const std::vector<LeafValueType>& values)
+{
+    AddIndexedDataResponse<LeafValueType> result;
+    Signal signal;
+    auto completion = [&](const TypedResponse<AddIndexedDataResponse<LeafValueType>>& response) -> void {
+        EXPECT_EQ(response.success, true);
+        result = response.inner;
+        signal.signal_level();
+    };
+
+    tree.add_or_update_values(values, completion);
+    signal.wait_for_level();
+    return result;
+}
+
 template <typename LeafValueType, typename TypeOfTree>
 void block_sync_values(TypeOfTree& tree, const std::vector<LeafValueType>& values, bool expectedSuccess = true)
 {
@@ -876,6 +894,61 @@ TEST_F(PersistedContentAddressedIndexedTreeTest, test_compare_batch_inserts_diff
     }
 }
 
+TEST_F(PersistedContentAddressedIndexedTreeTest, batch_insert_witnesses_are_independent_of_thread_pool_size)
+{
+    const uint32_t batch_size = 256;
+    constexpr uint32_t depth = 20;
+    auto& random_engine = numeric::get_randomness();
+
+    std::vector<std::unique_ptr<PublicDataTreeType>> trees;
+    for (uint32_t num_threads : { 1U, 4U, 16U }) {
+        std::string name = random_string();
+        LMDBTreeStore::SharedPtr db = std::make_shared<LMDBTreeStore>(_directory, name, _mapSize, _maxReaders);
+        std::unique_ptr<PublicDataStore> store = std::make_unique<PublicDataStore>(name, depth, db);
+        trees.push_back(std::make_unique<PublicDataTreeType>(std::move(store), make_thread_pool(num_threads), 2));
+    }
+
+    for (uint32_t round = 0; round < 6; round++) {
+        // Slots are drawn from a small range so that many values share a low leaf and some update existing leaves
+        std::set<uint32_t> slots;
+        std::vector<PublicDataLeafValue> values;
+        while (values.size() < batch_size) {
+            if (values.size() % 8 == 0) {
+                values.emplace_back(fr::zero(), fr::zero());
+                continue;
+            }
+            uint32_t slot = 2 + (random_engine.get_random_uint32() % 2048);
+            if (slots.insert(slot).second) {
+                values.emplace_back(fr(slot), fr(random_engine.get_random_uint256()));
+            }
+        }
+
+        AddIndexedDataResponse<PublicDataLeafValue> expected = add_values_with_witness(*trees[0], values);
+        for (size_t i = 1; i < trees.size(); i++) {
+            AddIndexedDataResponse<PublicDataLeafValue> response = add_values_with_witness(*trees[i], values);
+            EXPECT_EQ(response.subtree_path, expected.subtree_path);
+            EXPECT_EQ(*response.sorted_leaves, *expected.sorted_leaves);
+            ASSERT_EQ(response.low_leaf_witness_data->size(), expected.low_leaf_witness_data->size());
+            for (size_t j = 0; j < expected.low_leaf_witness_data->size(); j++) {
+                const LeafUpdateWitnessData<PublicDataLeafValue>& witness = (*response.low_leaf_witness_data)[j];
+                const LeafUpdateWitnessData<PublicDataLeafValue>& expected_witness =
+                    (*expected.low_leaf_witness_data)[j];
+                EXPECT_EQ(witness.leaf, expected_witness.leaf);
+                EXPECT_EQ(witness.index, expected_witness.index);
+                EXPECT_EQ(witness.path, expected_witness.path);
+            }
+            EXPECT_EQ(get_root(*trees[i]), get_root(*trees[0]));
+        }
+
+        // Alternate between finding low leaves in the committed and uncommitted state
+        if (round % 2 == 1) {
+            for (const auto& tree : trees) {
+                commit_tree(*tree);
+            }
+        }
+    }
+}
+
 TEST_F(PersistedContentAddressedIndexedTreeTest, reports_an_error_if_batch_contains_duplicate)
 {
     index_t current_size = 2;
@@ -55,7 +55,7 @@ int index_key_cmp(const MDB_val* a, const MDB_val* b)
 }
 
 LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders)
-    : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 5)
+    : LMDBStoreBase(directory, mapSizeKb, maxNumReaders, 6)
     , _name(std::move(name))
 {
 
@@ -93,6 +93,13 @@ LMDBTreeStore::LMDBTreeStore(std::string directory, std::string name, uint64_t m
             _environment, *tx, _name + BLOCK_INDICES_DB, false, false, false, index_key_cmp);
         tx->commit();
     }
+
+    {
+        LMDBDatabaseCreationTransaction::Ptr tx = create_db_transaction();
+        _blockUpperNodesDatabase = std::make_unique<LMDBDatabase>(
+            _environment, *tx, _name + BLOCK_UPPER_NODES_DB, false, false, false, index_key_cmp);
+        tx->commit();
+    }
 }
 
 const std::string& LMDBTreeStore::get_name() const
@@ -111,15 +118,36 @@ void LMDBTreeStore::get_stats(TreeDBStats& stats, ReadTransaction& tx)
     stats.blockIndicesDBStats = _indexToBlockDatabase->get_stats(tx);
 }
 
-void LMDBTreeStore::write_block_data(const block_number_t& blockNumber,
-                                     const BlockPayload& blockData,
-                                     LMDBTreeStore::WriteTransaction& tx)
+std::vector<const LMDBDatabase*> LMDBTreeStore::get_databases() const
+{
+    return { _blockDatabase.get(),
+             _nodeDatabase.get(),
+             _leafKeyToIndexDatabase.get(),
+             _leafHashToPreImageDatabase.get(),
+             _indexToBlockDatabase.get(),
+             _blockUpperNodesDatabase.get() };
+}
+
+SnapshotStats LMDBTreeStore::export_snapshot(const std::string& dstPath,
+                                             const SnapshotOptions& options,
+                                             ReadTransaction& tx) const
+{
+    return lmdblib::export_snapshot(get_databases(), tx, dstPath, options);
+}
+
+void LMDBTreeStore::import_snapshot(const std::string& srcPath)
+{
+    lmdblib::import_snapshot(get_databases(), srcPath, [this]() { return create_write_transaction(); });
+}
+
+template <typename TxType>
+void LMDBTreeStore::write_block_data(const block_number_t& blockNumber, const BlockPayload& blockData, TxType& tx)
 {
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, blockData);
     std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
     BlockMetaKeyType key(blockNumber);
-    tx.put_value<BlockMetaKeyType>(key, encoded, *_blockDatabase);
+    tx.template put_value<BlockMetaKeyType>(key, encoded, *_blockDatabase);
 }
 
 void LMDBTreeStore::delete_block_data(const block_number_t& blockNumber, LMDBTreeStore::WriteTransaction& tx)
@@ -141,15 +169,45 @@ bool LMDBTreeStore::read_block_data(const block_number_t& blockNumber,
     return success;
 }
 
-void LMDBTreeStore::write_block_index_data(const block_number_t& blockNumber,
-                                           const index_t& sizeAtBlock,
-                                           WriteTransaction& tx)
+template <typename TxType>
+void LMDBTreeStore::write_block_upper_nodes(const block_number_t& blockNumber,
+                                            const BlockUpperNodesPayload& upperNodes,
+                                            TxType& tx)
+{
+    msgpack::sbuffer buffer;
+    msgpack::pack(buffer, upperNodes);
+    std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+    BlockMetaKeyType key(blockNumber);
+    tx.template put_value<BlockMetaKeyType>(key, encoded, *_blockUpperNodesDatabase);
+}
+
+bool LMDBTreeStore::read_block_upper_nodes(const block_number_t& blockNumber,
+                                           BlockUpperNodesPayload& upperNodes,
+                                           LMDBTreeStore::ReadTransaction& tx)
+{
+    BlockMetaKeyType key(blockNumber);
+    std::vector<uint8_t> data;
+    bool success = tx.get_value<BlockMetaKeyType>(key, data, *_blockUpperNodesDatabase);
+    if (success) {
+        msgpack::unpack((const char*)data.data(), data.size()).get().convert(upperNodes);
+    }
+    return success;
+}
+
+void LMDBTreeStore::delete_block_upper_nodes(const block_number_t& blockNumber, LMDBTreeStore::WriteTransaction& tx)
+{
+    BlockMetaKeyType key(blockNumber);
+    tx.delete_value<BlockMetaKeyType>(key, *_blockUpperNodesDatabase);
+}
+
+template <typename TxType>
+void LMDBTreeStore::write_block_index_data(const block_number_t& blockNumber, const index_t& sizeAtBlock, TxType& tx)
 {
     // There can be multiple block numbers aganst the same index (zero size blocks)
     LeafIndexKeyType key(sizeAtBlock);
     std::vector<uint8_t> data;
     // Read the block index payload
-    bool success = tx.get_value<LeafIndexKeyType>(key, data, *_indexToBlockDatabase);
+    bool success = tx.template get_value<LeafIndexKeyType>(key, data, *_indexToBlockDatabase);
     BlockIndexPayload payload;
     if (success) {
         msgpack::unpack((const char*)data.data(), data.size()).get().convert(payload);
@@ -161,7 +219,7 @@ void LMDBTreeStore::write_block_index_data(const block_number_t& blockNumber,
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, payload);
     std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
-    tx.put_value<BlockMetaKeyType>(key, encoded, *_indexToBlockDatabase);
+    tx.template put_value<BlockMetaKeyType>(key, encoded, *_indexToBlockDatabase);
 }
 
 bool LMDBTreeStore::find_block_for_index(const index_t& index, block_number_t& blockNumber, ReadTransaction& tx)
@@ -214,13 +272,13 @@ void LMDBTreeStore::delete_block_index(const index_t& sizeAtBlock,
     tx.put_value<BlockMetaKeyType>(key, encoded, *_indexToBlockDatabase);
 }
 
-void LMDBTreeStore::write_meta_data(const TreeMeta& metaData, LMDBTreeStore::WriteTransaction& tx)
+template <typename TxType> void LMDBTreeStore::write_meta_data(const TreeMeta& metaData, TxType& tx)
 {
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, metaData);
     std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
     MetaKeyType key(0);
-    tx.put_value<MetaKeyType>(key, encoded, *_blockDatabase);
+    tx.template put_value<MetaKeyType>(key, encoded, *_blockDatabase);
 }
 
 bool LMDBTreeStore::read_meta_data(TreeMeta& metaData, LMDBTreeStore::ReadTransaction& tx)
@@ -234,11 +292,12 @@ bool LMDBTreeStore::read_meta_data(TreeMeta& metaData, LMDBTreeStore::ReadTransa
     return success;
 }
 
-void LMDBTreeStore::write_leaf_index(const fr& leafValue, const index_t& index, LMDBTreeStore::WriteTransaction& tx)
+template <typename TxType>
+void LMDBTreeStore::write_leaf_index(const fr& leafValue, const index_t& index, TxType& tx)
 {
     FrKeyType key(leafValue);
     // std::cout << "Writing leaf indices by key " << key << std::endl;
-    tx.put_value<FrKeyType>(key, index, *_leafKeyToIndexDatabase);
+    tx.template put_value<FrKeyType>(key, index, *_leafKeyToIndexDatabase);
 }
 
 void LMDBTreeStore::delete_leaf_index(const fr& leafValue, LMDBTreeStore::WriteTransaction& tx)
@@ -248,7 +307,7 @@ void LMDBTreeStore::delete_leaf_index(const fr& leafValue, LMDBTreeStore::WriteT
     tx.delete_value(key, *_leafKeyToIndexDatabase);
 }
 
-void LMDBTreeStore::increment_node_reference_count(const fr& nodeHash, WriteTransaction& tx)
+template <typename TxType> void LMDBTreeStore::increment_node_reference_count(const fr& nodeHash, TxType& tx)
 {
     NodePayload nodePayload;
     bool success = get_node_data(nodeHash, nodePayload, tx);
@@ -260,9 +319,8 @@ void LMDBTreeStore::increment_node_reference_count(const fr& nodeHash, WriteTran
     write_node(nodeHash, nodePayload, tx);
 }
 
-void LMDBTreeStore::set_or_increment_node_reference_count(const fr& nodeHash,
-                                                          NodePayload& nodeData,
-                                                          WriteTransaction& tx)
+template <typename TxType>
+void LMDBTreeStore::set_or_increment_node_reference_count(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
 {
     // Set to zero here and enrich from DB if present
     nodeData.ref = 0;
@@ -282,6 +340,7 @@ void LMDBTreeStore::decrement_node_reference_count(const fr& nodeHash, NodePaylo
     if (--nodeData.ref == 0) {
         // std::cout << "Deleting node at " << nodeHash << std::endl;
         tx.delete_value(nodeHash, *_nodeDatabase);
+        _nodeCache.erase(nodeHash);
         return;
     }
     // std::cout << "Updating node at " << nodeHash << " ref is now " << nodeData.ref << std::endl;
@@ -313,6 +372,23 @@ fr LMDBTreeStore::find_low_leaf(const fr& leafValue,
     return key;
 }
 
+void LMDBTreeStore::read_leaf_indices(const std::vector<fr>& leafValues,
+                                      std::vector<std::optional<index_t>>& leafIndices,
+                                      ReadTransaction& tx)
+{
+    std::vector<FrKeyType> keys(leafValues.begin(), leafValues.end());
+    std::vector<std::optional<std::vector<uint8_t>>> data;
+    tx.get_values(keys, data, *_leafKeyToIndexDatabase);
+    leafIndices.assign(leafValues.size(), std::nullopt);
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i].has_value()) {
+            index_t leafIndex = 0;
+            deserialise_key(data[i]->data(), leafIndex);
+            leafIndices[i] = leafIndex;
+        }
+    }
+}
+
 bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx)
 {
     FrKeyType key(nodeHash);
@@ -324,13 +400,51 @@ bool LMDBTreeStore::read_node(const fr& nodeHash, NodePayload& nodeData, ReadTra
     return success;
 }
 
-void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx)
+void LMDBTreeStore::read_nodes(const std::vector<fr>& nodeHashes,
+                               std::vector<std::optional<NodePayload>>& nodes,
+                               ReadTransaction& tx)
+{
+    std::vector<FrKeyType> keys(nodeHashes.begin(), nodeHashes.end());
+    std::vector<std::optional<std::vector<uint8_t>>> data;
+    tx.get_values(keys, data, *_nodeDatabase);
+    nodes.assign(nodeHashes.size(), std::nullopt);
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i].has_value()) {
+            NodePayload nodeData;
+            msgpack::unpack((const char*)data[i]->data(), data[i]->size()).get().convert(nodeData);
+            nodes[i] = nodeData;
+        }
+    }
+}
+
+template <typename TxType>
+void LMDBTreeStore::write_node(const fr& nodeHash, const NodePayload& nodeData, TxType& tx)
 {
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, nodeData);
     std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
     FrKeyType key(nodeHash);
-    tx.put_value<FrKeyType>(key, encoded, *_nodeDatabase);
+    tx.template put_value<FrKeyType>(key, encoded, *_nodeDatabase);
 }
 
+// The writes of a block commit are either made directly in a write transaction or prepared in a write batch
+template void LMDBTreeStore::write_block_data(const block_number_t&, const BlockPayload&, WriteTransaction&);
+template void LMDBTreeStore::write_block_data(const block_number_t&, const BlockPayload&, WriteBatch&);
+template void LMDBTreeStore::write_block_upper_nodes(const block_number_t&,
+                                                     const BlockUpperNodesPayload&,
+                                                     WriteTransaction&);
+template void LMDBTreeStore::write_block_upper_nodes(const block_number_t&, const BlockUpperNodesPayload&, WriteBatch&);
+template void LMDBTreeStore::write_block_index_data(const block_number_t&, const index_t&, WriteTransaction&);
+template void LMDBTreeStore::write_block_index_data(const block_number_t&, const index_t&, WriteBatch&);
+template void LMDBTreeStore::write_meta_data(const TreeMeta&, WriteTransaction&);
+template void LMDBTreeStore::write_meta_data(const TreeMeta&, WriteBatch&);
+template void LMDBTreeStore::write_leaf_index(const fr&, const index_t&, WriteTransaction&);
+template void LMDBTreeStore::write_leaf_index(const fr&, const index_t&, WriteBatch&);
+template void LMDBTreeStore::write_node(const fr&, const NodePayload&, WriteTransaction&);
+template void LMDBTreeStore::write_node(const fr&, const NodePayload&, WriteBatch&);
+template void LMDBTreeStore::increment_node_reference_count(const fr&, WriteTransaction&);
+template void LMDBTreeStore::increment_node_reference_count(const fr&, WriteBatch&);
+template void LMDBTreeStore::set_or_increment_node_reference_count(const fr&, NodePayload&, WriteTransaction&);
+template void LMDBTreeStore::set_or_increment_node_reference_count(const fr&, NodePayload&, WriteBatch&);
+
 } // namespace bb::crypto::merkle_tree
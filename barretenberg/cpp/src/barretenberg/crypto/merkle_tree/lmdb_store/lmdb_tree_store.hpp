@@ -8,17 +8,21 @@
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/serialize.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/persisted_node_cache.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/lmdblib/lmdb_database.hpp"
 #include "barretenberg/lmdblib/lmdb_environment.hpp"
 #include "barretenberg/lmdblib/lmdb_read_transaction.hpp"
+#include "barretenberg/lmdblib/lmdb_snapshot.hpp"
 #include "barretenberg/lmdblib/lmdb_store_base.hpp"
+#include "barretenberg/lmdblib/lmdb_write_batch.hpp"
 #include "barretenberg/lmdblib/lmdb_write_transaction.hpp"
 #include "barretenberg/serialize/msgpack_impl.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include "lmdb.h"
+#include <atomic>
 #include <cstdint>
 #include <optional>
 #include <ostream>
@@ -66,6 +70,65 @@ struct NodePayload {
     }
 };
 
+/**
+ * @brief The hashes of the upper levels of a tree at a block, so that a historical read can start below them instead of
+ * walking down from the block's root one node at a time
+ *
+ * @details Levels 1 to num_levels() are held level by level in index order as 32 byte hashes. Each level holds the
+ * nodes up to its last non-empty node, nodes after those and nodes held as zero are empty.
+ */
+struct BlockUpperNodesPayload {
+    std::vector<index_t> levelSizes;
+    std::vector<uint8_t> hashes;
+
+    MSGPACK_FIELDS(levelSizes, hashes)
+
+    bool operator==(const BlockUpperNodesPayload& other) const
+    {
+        return levelSizes == other.levelSizes && hashes == other.hashes;
+    }
+
+    uint32_t num_levels() const { return static_cast<uint32_t>(levelSizes.size()); }
+
+    /**
+     * @brief Appends the next level down, trailing empty nodes are dropped
+     */
+    void add_level(const std::vector<std::optional<fr>>& nodes)
+    {
+        size_t size = nodes.size();
+        while (size > 0 && !nodes[size - 1].has_value()) {
+            --size;
+        }
+        size_t offset = hashes.size();
+        hashes.resize(offset + (size * sizeof(fr)), 0);
+        for (size_t i = 0; i < size; ++i) {
+            if (nodes[i].has_value()) {
+                fr::serialize_to_buffer(nodes[i].value(), &hashes[offset + (i * sizeof(fr))]);
+            }
+        }
+        levelSizes.push_back(size);
+    }
+
+    /**
+     * @brief Returns the node at the given index of the given level, level 1 being the children of the root
+     */
+    std::optional<fr> get_node(uint32_t level, const index_t& index) const
+    {
+        size_t offset = 0;
+        for (uint32_t i = 1; i < level; ++i) {
+            offset += levelSizes[i - 1];
+        }
+        if (index >= levelSizes[level - 1]) {
+            return std::nullopt;
+        }
+        fr node = fr::serialize_from_buffer(&hashes[(offset + index) * sizeof(fr)]);
+        if (node.is_zero()) {
+            return std::nullopt;
+        }
+        return node;
+    }
+};
+
 struct BlockIndexPayload {
     std::vector<block_number_t> blockNumbers;
 
@@ -170,6 +233,8 @@ class LMDBTreeStore : public LMDBStoreBase {
     using SharedPtr = std::shared_ptr<LMDBTreeStore>;
     using ReadTransaction = LMDBReadTransaction;
     using WriteTransaction = LMDBWriteTransaction;
+    using WriteBatch = LMDBWriteBatch;
+    using NodeCache = PersistedNodeCache<NodePayload>;
     LMDBTreeStore(std::string directory, std::string name, uint64_t mapSizeKb, uint64_t maxNumReaders);
     LMDBTreeStore(const LMDBTreeStore& other) = delete;
     LMDBTreeStore(LMDBTreeStore&& other) = delete;
@@ -181,46 +246,102 @@ class LMDBTreeStore : public LMDBStoreBase {
 
     void get_stats(TreeDBStats& stats, ReadTransaction& tx);
 
-    void write_block_data(const block_number_t& blockNumber, const BlockPayload& blockData, WriteTransaction& tx);
+    /**
+     * @brief Streams the tree's data, as seen by the given read transaction, to a snapshot directory
+     */
+    SnapshotStats export_snapshot(const std::string& dstPath,
+                                  const SnapshotOptions& options,
+                                  ReadTransaction& tx) const;
+
+    /**
+     * @brief Loads a snapshot into the tree, which must not have been written to since it was created
+     */
+    void import_snapshot(const std::string& srcPath);
+
+    template <typename TxType>
+    void write_block_data(const block_number_t& blockNumber, const BlockPayload& blockData, TxType& tx);
 
     bool read_block_data(const block_number_t& blockNumber, BlockPayload& blockData, ReadTransaction& tx);
 
     void delete_block_data(const block_number_t& blockNumber, WriteTransaction& tx);
 
-    void write_block_index_data(const block_number_t& blockNumber, const index_t& sizeAtBlock, WriteTransaction& tx);
+    template <typename TxType>
+    void write_block_upper_nodes(const block_number_t& blockNumber,
+                                 const BlockUpperNodesPayload& upperNodes,
+                                 TxType& tx);
+
+    bool read_block_upper_nodes(const block_number_t& blockNumber,
+                                BlockUpperNodesPayload& upperNodes,
+                                ReadTransaction& tx);
+
+    void delete_block_upper_nodes(const block_number_t& blockNumber, WriteTransaction& tx);
+
+    /**
+     * @brief Sets how many levels below the root are stored for each block committed from now on, 0 to store none.
+     * Storing n levels costs up to 2^(n+1) hashes per block and saves up to n node reads per historical read.
+     */
+    void set_upper_node_levels(uint32_t levels) { _upperNodeLevels = levels; }
+
+    uint32_t get_upper_node_levels() const { return _upperNodeLevels; }
+
+    template <typename TxType>
+    void write_block_index_data(const block_number_t& blockNumber, const index_t& sizeAtBlock, TxType& tx);
 
     // index here is 0 based
     bool find_block_for_index(const index_t& index, block_number_t& blockNumber, ReadTransaction& tx);
 
     void delete_block_index(const index_t& sizeAtBlock, const block_number_t& blockNumber, WriteTransaction& tx);
 
-    void write_meta_data(const TreeMeta& metaData, WriteTransaction& tx);
+    template <typename TxType> void write_meta_data(const TreeMeta& metaData, TxType& tx);
 
     bool read_meta_data(TreeMeta& metaData, ReadTransaction& tx);
 
     template <typename TxType> bool read_leaf_index(const fr& leafValue, index_t& leafIndex, TxType& tx);
 
+    /**
+     * @brief Reads the indices of many leaf keys with a single sorted cursor scan, leafIndices[i] is the index of
+     * leafValues[i] or nullopt if it is not present
+     */
+    void read_leaf_indices(const std::vector<fr>& leafValues,
+                           std::vector<std::optional<index_t>>& leafIndices,
+                           ReadTransaction& tx);
+
     fr find_low_leaf(const fr& leafValue, index_t& index, const std::optional<index_t>& sizeLimit, ReadTransaction& tx);
 
-    void write_leaf_index(const fr& leafValue, const index_t& leafIndex, WriteTransaction& tx);
+    template <typename TxType> void write_leaf_index(const fr& leafValue, const index_t& leafIndex, TxType& tx);
 
     void delete_leaf_index(const fr& leafValue, WriteTransaction& tx);
 
     bool read_node(const fr& nodeHash, NodePayload& nodeData, ReadTransaction& tx);
 
-    void write_node(const fr& nodeHash, const NodePayload& nodeData, WriteTransaction& tx);
+    /**
+     * @brief Reads many nodes with a single sorted cursor scan, nodes[i] is the node of nodeHashes[i] or nullopt if it
+     * is not present
+     */
+    void read_nodes(const std::vector<fr>& nodeHashes,
+                    std::vector<std::optional<NodePayload>>& nodes,
+                    ReadTransaction& tx);
 
-    void increment_node_reference_count(const fr& nodeHash, WriteTransaction& tx);
+    /**
+     * @brief Returns the cache of persisted nodes shared by all users of this store, nodes deleted from the store are
+     * removed from it
+     */
+    NodeCache& get_node_cache() { return _nodeCache; }
 
-    void set_or_increment_node_reference_count(const fr& nodeHash, NodePayload& nodeData, WriteTransaction& tx);
+    template <typename TxType> void write_node(const fr& nodeHash, const NodePayload& nodeData, TxType& tx);
+
+    template <typename TxType> void increment_node_reference_count(const fr& nodeHash, TxType& tx);
+
+    template <typename TxType>
+    void set_or_increment_node_reference_count(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
 
     void decrement_node_reference_count(const fr& nodeHash, NodePayload& nodeData, WriteTransaction& tx);
 
     template <typename LeafType, typename TxType>
     bool read_leaf_by_hash(const fr& leafHash, LeafType& leafData, TxType& tx);
 
-    template <typename LeafType>
-    void write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx);
+    template <typename LeafType, typename TxType>
+    void write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, TxType& tx);
 
     void delete_leaf_by_hash(const fr& leafHash, WriteTransaction& tx);
 
@@ -245,8 +366,13 @@ class LMDBTreeStore : public LMDBStoreBase {
     LMDBDatabase::Ptr _leafKeyToIndexDatabase;
     LMDBDatabase::Ptr _leafHashToPreImageDatabase;
     LMDBDatabase::Ptr _indexToBlockDatabase;
+    LMDBDatabase::Ptr _blockUpperNodesDatabase;
+    NodeCache _nodeCache;
+    std::atomic<uint32_t> _upperNodeLevels = 0;
 
     template <typename TxType> bool get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx);
+
+    std::vector<const LMDBDatabase*> get_databases() const;
 };
 
 template <typename TxType> bool LMDBTreeStore::read_leaf_index(const fr& leafValue, index_t& leafIndex, TxType& tx)
@@ -267,14 +393,14 @@ bool LMDBTreeStore::read_leaf_by_hash(const fr& leafHash, LeafType& leafData, Tx
     return success;
 }
 
-template <typename LeafType>
-void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, WriteTransaction& tx)
+template <typename LeafType, typename TxType>
+void LMDBTreeStore::write_leaf_by_hash(const fr& leafHash, const LeafType& leafData, TxType& tx)
 {
     msgpack::sbuffer buffer;
     msgpack::pack(buffer, leafData);
     std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
     FrKeyType key(leafHash);
-    tx.put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
+    tx.template put_value<FrKeyType>(key, encoded, *_leafHashToPreImageDatabase);
 }
 
 template <typename TxType> bool LMDBTreeStore::get_node_data(const fr& nodeHash, NodePayload& nodeData, TxType& tx)
@@ -631,3 +631,67 @@ TEST_F(LMDBTreeStoreTest, reports_physical_file_size)
         }
     }
 }
+
+TEST_F(LMDBTreeStoreTest, can_export_and_import_snapshots)
+{
+    std::filesystem::path directory = _directory;
+    std::filesystem::create_directories(directory / "source");
+    LMDBTreeStore store(directory / "source", "DB1", _mapSize, _maxReaders);
+    auto write_leaves = [&](uint64_t from, uint64_t to) {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (uint64_t i = from; i < to; i++) {
+            store.write_leaf_index(bb::fr(i), i, *transaction);
+        }
+        auto blockNumber = static_cast<block_number_t>(to);
+        BlockPayload blockData{ .size = to, .blockNumber = blockNumber, .root = bb::fr(to) };
+        store.write_block_data(blockNumber, blockData, *transaction);
+        transaction->commit();
+    };
+    auto check_store = [&](LMDBTreeStore& restored, uint64_t numLeaves) {
+        LMDBReadTransaction::Ptr transaction = restored.create_read_transaction();
+        for (uint64_t i = 0; i < numLeaves; i++) {
+            index_t index = 0;
+            EXPECT_TRUE(restored.read_leaf_index(bb::fr(i), index, *transaction));
+            EXPECT_EQ(index, i);
+        }
+        index_t index = 0;
+        EXPECT_FALSE(restored.read_leaf_index(bb::fr(numLeaves), index, *transaction));
+        BlockPayload blockData;
+        EXPECT_TRUE(restored.read_block_data(static_cast<block_number_t>(numLeaves), blockData, *transaction));
+        EXPECT_EQ(blockData.root, bb::fr(numLeaves));
+    };
+
+    SnapshotOptions options;
+    options.chunkSize = 4096;
+    write_leaves(0, 2000);
+    SnapshotStats fullStats;
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        fullStats = store.export_snapshot(directory / "full", options, *transaction);
+    }
+    EXPECT_EQ(fullStats.chunksReused, 0UL);
+
+    // The delta only holds the chunks that changed
+    write_leaves(2000, 2010);
+    options.baseSnapshotPath = (directory / "full").string();
+    SnapshotStats deltaStats;
+    {
+        LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+        deltaStats = store.export_snapshot(directory / "delta", options, *transaction);
+    }
+    EXPECT_GT(deltaStats.chunksReused, 0UL);
+    EXPECT_LT(deltaStats.bytesWritten, fullStats.bytesWritten / 2);
+
+    std::filesystem::create_directories(directory / "restored_full");
+    LMDBTreeStore restoredFull(directory / "restored_full", "DB1", _mapSize, _maxReaders);
+    restoredFull.import_snapshot(directory / "full");
+    check_store(restoredFull, 2000);
+
+    std::filesystem::create_directories(directory / "restored_delta");
+    LMDBTreeStore restoredDelta(directory / "restored_delta", "DB1", _mapSize, _maxReaders);
+    restoredDelta.import_snapshot(directory / "delta");
+    check_store(restoredDelta, 2010);
+
+    // Snapshots can only be imported into an empty store
+    EXPECT_THROW(restoredFull.import_snapshot(directory / "delta"), std::runtime_error);
+}
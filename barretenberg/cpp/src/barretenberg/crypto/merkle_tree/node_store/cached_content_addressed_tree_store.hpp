@@ -18,6 +18,7 @@
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "msgpack/assert.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <exception>
 #include <iostream>
@@ -43,6 +44,9 @@ namespace bb::crypto::merkle_tree {
  */
 template <typename LeafValueType> class ContentAddressedCachedTreeStore {
   public:
+    // Persisted nodes above this level are shared between the tree and its forks
+    static constexpr uint32_t SHARED_NODE_LEVELS = 16;
+
     using PersistedStoreType = LMDBTreeStore;
     using LeafType = LeafValueType;
     using IndexedLeafValueType = IndexedLeaf<LeafValueType>;
@@ -50,6 +54,7 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
     using WriteTransaction = typename PersistedStoreType::WriteTransaction;
     using ReadTransactionPtr = std::unique_ptr<ReadTransaction>;
     using WriteTransactionPtr = std::unique_ptr<WriteTransaction>;
+    using WriteBatch = typename PersistedStoreType::WriteBatch;
 
     ContentAddressedCachedTreeStore(std::string name, uint32_t levels, PersistedStoreType::SharedPtr dataStore);
     ContentAddressedCachedTreeStore(std::string name,
@@ -95,11 +100,24 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     /**
      * @brief Returns the data at the given node coordinates if available. Reads from uncommitted state if requested.
+     * Persisted nodes in the upper levels are served from the node cache shared with all forks of the tree, the
+     * reference count of a node read this way may be out of date.
      */
     bool get_node_by_hash(const fr& nodeHash,
                           NodePayload& payload,
                           ReadTransaction& transaction,
-                          bool includeUncommitted) const;
+                          bool includeUncommitted,
+                          uint32_t level) const;
+
+    /**
+     * @brief Returns the nodes of many hashes at the same level, as get_node_by_hash. The nodes not found in any cache
+     * are read from the store in a single batch.
+     */
+    void get_nodes_by_hash(const std::vector<fr>& nodeHashes,
+                           std::vector<std::optional<NodePayload>>& payloads,
+                           ReadTransaction& transaction,
+                           bool includeUncommitted,
+                           uint32_t level) const;
 
     /**
      * @brief Writes the provided data at the given node coordinates. Only writes to uncommitted data.
@@ -131,6 +149,12 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
      */
     bool get_block_data(const block_number_t& blockNumber, BlockPayload& blockData, ReadTransaction& tx) const;
 
+    /**
+     * @brief Returns the upper levels of the tree stored for the given block, or nullptr if none were stored
+     */
+    std::shared_ptr<const BlockUpperNodesPayload> get_block_upper_nodes(const block_number_t& blockNumber,
+                                                                        ReadTransaction& tx) const;
+
     /**
      * @brief Finds the index of the given leaf value in the tree if available. Includes uncommitted data if requested.
      */
@@ -146,11 +170,38 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
                                                 const RequestContext& requestContext,
                                                 ReadTransaction& tx) const;
 
+    /**
+     * @brief Finds the indices of many leaf values, as find_leaf_index_from. The values not found in uncommitted data
+     * are read from the store in a single batch.
+     */
+    std::vector<std::optional<index_t>> find_leaf_indices_from(const std::vector<LeafValueType>& leaves,
+                                                               const index_t& start_index,
+                                                               const RequestContext& requestContext,
+                                                               ReadTransaction& tx) const;
+
     /**
      * @brief Commits the uncommitted data to the underlying store
      */
     void commit_block(TreeMeta& finalMeta, TreeDBStats& dbStats);
 
+    /**
+     * @brief Serialises the uncommitted data into a write batch, to be written by commit_prepared_block
+     * @details Nothing is written to the underlying store. The batch is resolved against the persisted state, so the
+     * tree must not be modified or committed in between the two calls.
+     */
+    void prepare_commit_block();
+
+    /**
+     * @brief Writes the batch of the last prepare_commit_block to the underlying store
+     * @param deferSync Whether to leave the commit to be made durable by a later sync_persisted_data
+     */
+    void commit_prepared_block(TreeMeta& finalMeta, TreeDBStats& dbStats, bool deferSync = false);
+
+    /**
+     * @brief Flushes any commits made with a deferred sync to disk
+     */
+    void sync_persisted_data() { dataStore_->sync(); }
+
     /**
      * @brief Commits the initial state of uncommitted data to the underlying store
      */
@@ -212,6 +263,16 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     Cache cache_;
 
+    struct PreparedBlockCommit {
+        WriteBatch batch;
+        TreeMeta meta;
+
+        explicit PreparedBlockCommit(ReadTransaction& tx)
+            : batch(tx)
+        {}
+    };
+    std::unique_ptr<PreparedBlockCommit> preparedCommit_;
+
     void initialize();
 
     void initialize_from_block(const block_number_t& blockNumber);
@@ -220,9 +281,9 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void enrich_meta_from_fork_constant_data(TreeMeta& m) const;
 
-    void persist_meta(TreeMeta& m, WriteTransaction& tx);
+    template <typename TxType> void persist_meta(TreeMeta& m, TxType& tx);
 
-    void persist_node(const std::optional<fr>& optional_hash, uint32_t level, WriteTransaction& tx);
+    template <typename TxType> void persist_node(const std::optional<fr>& optional_hash, uint32_t level, TxType& tx);
 
     void remove_node(const std::optional<fr>& optional_hash,
                      uint32_t level,
@@ -239,7 +300,11 @@ template <typename LeafValueType> class ContentAddressedCachedTreeStore {
 
     void persist_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
-    void persist_leaf_indices(WriteTransaction& tx);
+    template <typename TxType> void persist_leaf_indices(TxType& tx);
+
+    void share_upper_nodes(const fr& root);
+
+    BlockUpperNodesPayload read_upper_nodes(const fr& root, uint32_t levels, ReadTransaction& tx) const;
 
     void delete_block_for_index(const block_number_t& blockNumber, const index_t& index, WriteTransaction& tx);
 
@@ -503,6 +568,55 @@ std::optional<index_t> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf
     return std::nullopt;
 }
 
+template <typename LeafValueType>
+std::vector<std::optional<index_t>> ContentAddressedCachedTreeStore<LeafValueType>::find_leaf_indices_from(
+    const std::vector<LeafValueType>& leaves,
+    const index_t& start_index,
+    const RequestContext& requestContext,
+    ReadTransaction& tx) const
+{
+    std::vector<std::optional<index_t>> indices(leaves.size());
+    // The keys that need to be read from the store and the positions of their leaves
+    std::vector<fr> keys;
+    std::vector<size_t> positions;
+    {
+        // Accessing the cache under a lock
+        std::unique_lock lock(mtx_, std::defer_lock);
+        if (requestContext.includeUncommitted) {
+            lock.lock();
+        }
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            fr key = preimage_to_key(leaves[i]);
+            if (requestContext.includeUncommitted) {
+                std::optional<index_t> cached = cache_.get_leaf_key_index(key);
+                if (cached.has_value()) {
+                    // A cached value is returned regardless, as in find_leaf_index_from
+                    if (cached.value() >= start_index) {
+                        indices[i] = cached;
+                    }
+                    continue;
+                }
+            }
+            keys.push_back(key);
+            positions.push_back(i);
+        }
+    }
+    if (keys.empty()) {
+        return indices;
+    }
+
+    std::vector<std::optional<index_t>> committed;
+    dataStore_->read_leaf_indices(keys, committed, tx);
+    // We must constrain the search to only the data committed from our perspective, see find_leaf_index_from
+    index_t sizeLimit = constrain_tree_size_to_only_committed(requestContext, tx);
+    for (size_t i = 0; i < committed.size(); ++i) {
+        if (committed[i].has_value() && committed[i].value() >= start_index && committed[i].value() < sizeLimit) {
+            indices[positions[i]] = committed[i];
+        }
+    }
+    return indices;
+}
+
 template <typename LeafValueType>
 void ContentAddressedCachedTreeStore<LeafValueType>::put_node_by_hash(const fr& nodeHash, const NodePayload& payload)
 {
@@ -515,7 +629,8 @@ template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr& nodeHash,
                                                                       NodePayload& payload,
                                                                       ReadTransaction& transaction,
-                                                                      bool includeUncommitted) const
+                                                                      bool includeUncommitted,
+                                                                      uint32_t level) const
 {
     if (includeUncommitted) {
         // Accessing nodes_ under a lock
@@ -524,7 +639,67 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_node_by_hash(const fr&
             return true;
         }
     }
-    return dataStore_->read_node(nodeHash, payload, transaction);
+    if (level >= SHARED_NODE_LEVELS) {
+        return dataStore_->read_node(nodeHash, payload, transaction);
+    }
+    // Nodes are content addressed, so any persisted node is valid for every block and fork that references it
+    auto& nodeCache = dataStore_->get_node_cache();
+    if (nodeCache.get(nodeHash, payload)) {
+        return true;
+    }
+    if (!dataStore_->read_node(nodeHash, payload, transaction)) {
+        return false;
+    }
+    nodeCache.put(nodeHash, payload);
+    return true;
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::get_nodes_by_hash(
+    const std::vector<fr>& nodeHashes,
+    std::vector<std::optional<NodePayload>>& payloads,
+    ReadTransaction& transaction,
+    bool includeUncommitted,
+    uint32_t level) const
+{
+    payloads.assign(nodeHashes.size(), std::nullopt);
+    const bool shared = level < SHARED_NODE_LEVELS;
+    auto& nodeCache = dataStore_->get_node_cache();
+    // The hashes that need to be read from the store and the positions of their nodes
+    std::vector<fr> hashes;
+    std::vector<size_t> positions;
+    for (size_t i = 0; i < nodeHashes.size(); ++i) {
+        NodePayload payload;
+        if (includeUncommitted) {
+            // Accessing nodes_ under a lock
+            std::unique_lock lock(mtx_);
+            if (cache_.get_node(nodeHashes[i], payload)) {
+                payloads[i] = payload;
+                continue;
+            }
+        }
+        if (shared && nodeCache.get(nodeHashes[i], payload)) {
+            payloads[i] = payload;
+            continue;
+        }
+        hashes.push_back(nodeHashes[i]);
+        positions.push_back(i);
+    }
+    if (hashes.empty()) {
+        return;
+    }
+
+    std::vector<std::optional<NodePayload>> persisted;
+    dataStore_->read_nodes(hashes, persisted, transaction);
+    for (size_t i = 0; i < persisted.size(); ++i) {
+        if (!persisted[i].has_value()) {
+            continue;
+        }
+        if (shared) {
+            nodeCache.put(hashes[i], persisted[i].value());
+        }
+        payloads[positions[i]] = std::move(persisted[i]);
+    }
 }
 
 template <typename LeafValueType>
@@ -593,6 +768,44 @@ bool ContentAddressedCachedTreeStore<LeafValueType>::get_block_data(const block_
     return dataStore_->read_block_data(blockNumber, blockData, tx);
 }
 
+template <typename LeafValueType>
+std::shared_ptr<const BlockUpperNodesPayload> ContentAddressedCachedTreeStore<LeafValueType>::get_block_upper_nodes(
+    const block_number_t& blockNumber, ReadTransaction& tx) const
+{
+    auto upperNodes = std::make_shared<BlockUpperNodesPayload>();
+    if (!dataStore_->read_block_upper_nodes(blockNumber, *upperNodes, tx)) {
+        return nullptr;
+    }
+    return upperNodes;
+}
+
+template <typename LeafValueType>
+BlockUpperNodesPayload ContentAddressedCachedTreeStore<LeafValueType>::read_upper_nodes(const fr& root,
+                                                                                       uint32_t levels,
+                                                                                       ReadTransaction& tx) const
+{
+    // Walk down level by level from the root, recording the children exactly as a traversal would find them
+    BlockUpperNodesPayload upperNodes;
+    std::vector<std::optional<fr>> nodes{ root };
+    for (uint32_t level = 0; level < levels; ++level) {
+        std::vector<std::optional<fr>> children;
+        children.reserve(nodes.size() * 2);
+        for (const auto& node : nodes) {
+            NodePayload payload;
+            if (node.has_value() && get_node_by_hash(node.value(), payload, tx, true, level)) {
+                children.push_back(payload.left);
+                children.push_back(payload.right);
+            } else {
+                children.insert(children.end(), 2, std::nullopt);
+            }
+        }
+        upperNodes.add_level(children);
+        nodes = std::move(children);
+        nodes.resize(upperNodes.levelSizes.back());
+    }
+    return upperNodes;
+}
+
 template <typename LeafValueType>
 bool ContentAddressedCachedTreeStore<LeafValueType>::read_persisted_meta(TreeMeta& m, ReadTransaction& tx) const
 {
@@ -637,9 +850,10 @@ fr ContentAddressedCachedTreeStore<LeafValueType>::get_current_root(ReadTransact
 // are in progress, hence no data synchronisation is used.
 
 template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(WriteTransaction& tx)
+template <typename TxType>
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_leaf_indices(TxType& tx)
 {
-    const std::map<uint256_t, index_t>& indices = cache_.get_indices();
+    const auto& indices = cache_.get_indices();
     for (const auto& idx : indices) {
         FrKeyType key = idx.first;
         dataStore_->write_leaf_index(key, idx.second, tx);
@@ -692,11 +906,16 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
     get_meta(meta);
     NodePayload rootPayload;
     dataPresent = cache_.get_node(meta.root, rootPayload);
+    std::optional<BlockUpperNodesPayload> upperNodes;
+    uint32_t upperNodeLevels = std::min(dataStore_->get_upper_node_levels(), forkConstantData_.depth_ - 1);
+    if (upperNodeLevels > 0 && meta.size > 0) {
+        ReadTransactionPtr readTx = create_read_transaction();
+        upperNodes = read_upper_nodes(meta.root, upperNodeLevels, *readTx);
+    }
     {
         WriteTransactionPtr tx = create_write_transaction();
         try {
             if (dataPresent) {
-                // std::cout << "Persisting data for block " << uncommittedMeta.unfinalizedBlockHeight + 1 << std::endl;
                 // Persist the leaf indices
                 persist_leaf_indices(*tx);
             }
@@ -713,9 +932,11 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
             if (meta.oldestHistoricBlock == 0) {
                 meta.oldestHistoricBlock = 1;
             }
-            // std::cout << "New root " << uncommittedMeta.root << std::endl;
             BlockPayload block{ .size = meta.size, .blockNumber = meta.unfinalizedBlockHeight, .root = meta.root };
             dataStore_->write_block_data(meta.unfinalizedBlockHeight, block, *tx);
+            if (upperNodes.has_value()) {
+                dataStore_->write_block_upper_nodes(meta.unfinalizedBlockHeight, upperNodes.value(), *tx);
+            }
             dataStore_->write_block_index_data(block.blockNumber, block.size, *tx);
 
             meta.committedSize = meta.size;
@@ -728,6 +949,92 @@ void ContentAddressedCachedTreeStore<LeafValueType>::commit_block(TreeMeta& fina
         }
     }
     finalMeta = meta;
+    share_upper_nodes(finalMeta.root);
+
+    // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
+    rollback();
+
+    extract_db_stats(dbStats);
+}
+
+template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::prepare_commit_block()
+{
+    bool dataPresent = false;
+    TreeMeta meta;
+
+    // We don't allow commits using images/forks
+    if (forkConstantData_.initialized_from_block_.has_value()) {
+        throw std::runtime_error("Committing a fork is forbidden");
+    }
+    get_meta(meta);
+    NodePayload rootPayload;
+    dataPresent = cache_.get_node(meta.root, rootPayload);
+    // The batch reads through to this transaction for data persisted by previous blocks
+    ReadTransactionPtr tx = create_read_transaction();
+    auto prepared = std::make_unique<PreparedBlockCommit>(*tx);
+    try {
+        if (dataPresent) {
+            // Persist the leaf indices
+            persist_leaf_indices(prepared->batch);
+        }
+        // If we are commiting a block, we need to persist the root, since the new block "references" this root
+        // However, if the root is the empty root we can't persist it, since it's not a real node and doesn't have
+        // nodes beneath it. We coujld store a 'dummy' node to represent it but then we have to work around the
+        // absence of a real tree elsewhere. So, if the tree is completely empty we do not store any node data, the
+        // only issue is this needs to be recognised when we unwind or remove historic blocks i.e. there will be no
+        // node date to remove for these blocks
+        if (dataPresent || meta.size > 0) {
+            persist_node(std::optional<fr>(meta.root), 0, prepared->batch);
+        }
+        ++meta.unfinalizedBlockHeight;
+        if (meta.oldestHistoricBlock == 0) {
+            meta.oldestHistoricBlock = 1;
+        }
+        BlockPayload block{ .size = meta.size, .blockNumber = meta.unfinalizedBlockHeight, .root = meta.root };
+        dataStore_->write_block_data(meta.unfinalizedBlockHeight, block, prepared->batch);
+        uint32_t upperNodeLevels = std::min(dataStore_->get_upper_node_levels(), forkConstantData_.depth_ - 1);
+        if (upperNodeLevels > 0 && meta.size > 0) {
+            dataStore_->write_block_upper_nodes(
+                meta.unfinalizedBlockHeight, read_upper_nodes(meta.root, upperNodeLevels, *tx), prepared->batch);
+        }
+        dataStore_->write_block_index_data(block.blockNumber, block.size, prepared->batch);
+
+        meta.committedSize = meta.size;
+        persist_meta(meta, prepared->batch);
+    } catch (std::exception& e) {
+        throw std::runtime_error(
+            format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
+    }
+    prepared->meta = meta;
+    preparedCommit_ = std::move(prepared);
+}
+
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::commit_prepared_block(TreeMeta& finalMeta,
+                                                                           TreeDBStats& dbStats,
+                                                                           bool deferSync)
+{
+    if (!preparedCommit_) {
+        throw std::runtime_error(format("No prepared commit for tree: ", forkConstantData_.name_));
+    }
+    std::unique_ptr<PreparedBlockCommit> prepared = std::move(preparedCommit_);
+    {
+        WriteTransactionPtr tx = create_write_transaction();
+        try {
+            prepared->batch.apply(*tx);
+            if (deferSync) {
+                tx->commit_deferring_sync();
+            } else {
+                tx->commit();
+            }
+        } catch (std::exception& e) {
+            tx->try_abort();
+            throw std::runtime_error(
+                format("Unable to commit data to tree: ", forkConstantData_.name_, " Error: ", e.what()));
+        }
+    }
+    finalMeta = prepared->meta;
+    share_upper_nodes(finalMeta.root);
 
     // rolling back destroys all cache stores and also refreshes the cached meta_ from persisted state
     rollback();
@@ -755,9 +1062,10 @@ void ContentAddressedCachedTreeStore<LeafValueType>::extract_db_stats(TreeDBStat
 }
 
 template <typename LeafValueType>
+template <typename TxType>
 void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::optional<fr>& optional_hash,
                                                                   uint32_t level,
-                                                                  WriteTransaction& tx)
+                                                                  TxType& tx)
 {
     struct StackObject {
         std::optional<fr> opHash;
@@ -807,7 +1115,8 @@ void ContentAddressedCachedTreeStore<LeafValueType>::persist_node(const std::opt
 
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::rollback()
 {
-    // Extract the committed meta data and destroy the cache
+    // Extract the committed meta data and destroy the cache, along with any commit prepared from it
+    preparedCommit_.reset();
     cache_.reset(forkConstantData_.depth_);
     {
         ReadTransactionPtr tx = create_read_transaction();
@@ -818,7 +1127,8 @@ template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValue
 }
 
 template <typename LeafValueType>
-void ContentAddressedCachedTreeStore<LeafValueType>::persist_meta(TreeMeta& m, WriteTransaction& tx)
+template <typename TxType>
+void ContentAddressedCachedTreeStore<LeafValueType>::persist_meta(TreeMeta& m, TxType& tx)
 {
     dataStore_->write_meta_data(m, tx);
 }
@@ -970,6 +1280,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::unwind_block(const block_nu
             }
             // remove the block from the block data table
             dataStore_->delete_block_data(blockNumber, *writeTx);
+            dataStore_->delete_block_upper_nodes(blockNumber, *writeTx);
             dataStore_->delete_block_index(blockData.size, blockData.blockNumber, *writeTx);
             uncommittedMeta.unfinalizedBlockHeight = previousBlockData.blockNumber;
             uncommittedMeta.size = previousBlockData.size;
@@ -1060,6 +1371,7 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_historical_block(con
             }
             // remove the block's entry in the block table
             dataStore_->delete_block_data(blockNumber, *writeTx);
+            dataStore_->delete_block_upper_nodes(blockNumber, *writeTx);
             // increment the oldest historical block number as committed data
             committedMeta.oldestHistoricBlock++;
             persist_meta(committedMeta, *writeTx);
@@ -1166,6 +1478,37 @@ void ContentAddressedCachedTreeStore<LeafValueType>::remove_node(const std::opti
     }
 }
 
+template <typename LeafValueType>
+void ContentAddressedCachedTreeStore<LeafValueType>::share_upper_nodes(const fr& root)
+{
+    // Forks of the block just committed will read down from its root, so we share the upper nodes it changed rather
+    // than have every fork read them back from the store
+    struct StackObject {
+        fr hash;
+        uint32_t lvl;
+    };
+    std::vector<StackObject> stack;
+    stack.push_back({ .hash = root, .lvl = 0 });
+    auto& nodeCache = dataStore_->get_node_cache();
+
+    while (!stack.empty()) {
+        StackObject so = stack.back();
+        stack.pop_back();
+
+        NodePayload nodeData;
+        if (so.lvl >= SHARED_NODE_LEVELS || !cache_.get_node(so.hash, nodeData)) {
+            continue;
+        }
+        nodeCache.put(so.hash, nodeData);
+        if (nodeData.left.has_value()) {
+            stack.push_back({ .hash = nodeData.left.value(), .lvl = so.lvl + 1 });
+        }
+        if (nodeData.right.has_value()) {
+            stack.push_back({ .hash = nodeData.right.value(), .lvl = so.lvl + 1 });
+        }
+    }
+}
+
 template <typename LeafValueType> void ContentAddressedCachedTreeStore<LeafValueType>::initialize()
 {
     // Read the persisted meta data, if the name or depth of the tree is not consistent with what was provided during
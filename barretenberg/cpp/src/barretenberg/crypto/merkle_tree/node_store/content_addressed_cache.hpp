@@ -6,8 +6,10 @@
 
 #pragma once
 #include "./tree_meta.hpp"
+#include "barretenberg/common/ankerl_dense.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/ordered_flat_map.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
@@ -28,6 +30,17 @@
 
 namespace bb::crypto::merkle_tree {
 
+/**
+ * @brief Hashes node and leaf hashes, which are already uniformly distributed, by taking their lowest limb
+ */
+struct FrHash {
+    uint64_t operator()(const fr& value) const noexcept { return value.reduce_once().data[0]; }
+};
+
+// Open addressing maps storing their entries contiguously, rather than a node allocation per entry
+template <typename Key, typename Value> using FlatMap = ::ankerl::unordered_dense::map<Key, Value>;
+template <typename Value> using FlatFrMap = ::ankerl::unordered_dense::map<fr, Value, FrHash>;
+
 // Stores all of the penidng updates to a mekle tree indexed for optimal retrieval
 // Also stores a journal of inverse changes to the cache, enabling checkpoints and
 // and subsequent commit/revert operations
@@ -76,7 +89,8 @@ template <typename LeafValueType> class ContentAddressedCache {
     std::optional<fr> get_node_by_index(uint32_t level, const index_t& index) const;
     void put_node_by_index(uint32_t level, const index_t& index, const fr& node);
 
-    const std::map<uint256_t, index_t>& get_indices() const { return indices_; }
+    using Indices = OrderedFlatMap<uint256_t, index_t>;
+    const Indices& get_indices() const { return indices_; }
 
     bool is_equivalent_to(const ContentAddressedCache& other) const;
 
@@ -87,35 +101,35 @@ template <typename LeafValueType> class ContentAddressedCache {
         // Captures the cache's node hashes at the time of checkpoint. If the node does not exist in the cache, the
         // optional will == nullopt
         // TODO (PhilWindle): Consider where a more optimal approach is a single unordered map, instead of 1 per level
-        std::vector<std::unordered_map<index_t, std::optional<fr>>> nodes_by_index_;
+        std::vector<FlatMap<index_t, std::optional<fr>>> nodes_by_index_;
         // Captures the cache's leaf pre-images at the time of checkpoint. Again, if the leaf does not exist in the
         // cache, the optional will == nullopt
-        std::unordered_map<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
+        FlatMap<index_t, std::optional<IndexedLeafValueType>> leaf_pre_image_by_index_;
         // Captures the addition of new leaf keys into the indices_ cache
         std::vector<uint256_t> new_leaf_keys_;
 
         Journal(TreeMeta meta)
             : meta_(std::move(meta))
-            , nodes_by_index_(meta_.depth + 1, std::unordered_map<index_t, std::optional<fr>>())
+            , nodes_by_index_(meta_.depth + 1, FlatMap<index_t, std::optional<fr>>())
         {}
     };
     // This is a mapping between the node hash and it's payload (children and ref count) for every node in the tree,
     // including leaves. As indexed trees are updated, this will end up containing many nodes that are not part of the
     // final tree so they need to be omitted from what is committed.
-    std::unordered_map<fr, NodePayload> nodes_;
+    FlatFrMap<NodePayload> nodes_;
 
     // This is a store mapping the leaf key (e.g. slot for public data or nullifier value for nullifier tree) to the
     // index in the tree
-    std::map<uint256_t, index_t> indices_;
+    Indices indices_;
 
     // This is a mapping from leaf hash to leaf pre-image. This will contain entries that need to be omitted when
     // commiting updates
-    std::unordered_map<fr, IndexedLeafValueType> leaves_;
+    FlatFrMap<IndexedLeafValueType> leaves_;
     TreeMeta meta_;
 
     // The following stores are not persisted, just cached until commit
-    std::vector<std::unordered_map<index_t, fr>> nodes_by_index_;
-    std::unordered_map<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
+    std::vector<FlatMap<index_t, fr>> nodes_by_index_;
+    FlatMap<index_t, IndexedLeafValueType> leaf_pre_image_by_index_;
 
     // The currently active journals
     std::vector<Journal> journals_;
@@ -242,11 +256,11 @@ template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::rev
 }
 template <typename LeafValueType> void ContentAddressedCache<LeafValueType>::reset(uint32_t depth)
 {
-    nodes_ = std::unordered_map<fr, NodePayload>();
-    indices_ = std::map<uint256_t, index_t>();
-    leaves_ = std::unordered_map<fr, IndexedLeafValueType>();
-    nodes_by_index_ = std::vector<std::unordered_map<index_t, fr>>(depth + 1, std::unordered_map<index_t, fr>());
-    leaf_pre_image_by_index_ = std::unordered_map<index_t, IndexedLeafValueType>();
+    nodes_ = FlatFrMap<NodePayload>();
+    indices_ = Indices();
+    leaves_ = FlatFrMap<IndexedLeafValueType>();
+    nodes_by_index_ = std::vector<FlatMap<index_t, fr>>(depth + 1, FlatMap<index_t, fr>());
+    leaf_pre_image_by_index_ = FlatMap<index_t, IndexedLeafValueType>();
     journals_ = std::vector<Journal>();
 }
 
@@ -306,38 +320,27 @@ std::pair<bool, index_t> ContentAddressedCache<LeafValueType>::find_low_value(co
         return std::make_pair(new_leaf_key == retrieved_value, db_index);
     }
     // At this stage, we have been asked to include uncommitted and the value was not exactly found in the db
-    auto it = indices_.lower_bound(new_leaf_key);
-    if (it == indices_.end()) {
-        // there is no element >= the requested value.
-        // decrement the iterator to get the value preceeding the requested value
-        --it;
-        // we need to return the larger of the db value or the cached value
-
-        return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    const typename Indices::Entry* floor = indices_.find_floor(new_leaf_key);
+    if (floor == nullptr) {
+        // No cached value <= the requested value, return the db index
+        return std::make_pair(false, db_index);
     }
-
-    if (it->first == new_leaf_key) {
-        // the value is already present and the iterator points to it
-        return std::make_pair(true, it->second);
+    if (floor->first == new_leaf_key) {
+        // the value is already present
+        return std::make_pair(true, floor->second);
     }
-    // the iterator points to the element immediately larger than the requested value
+    // floor is the cached value immediately lower than the requested value
     // We need to return the highest value from
-    // 1. The next lowest cached value, if there is one
+    // 1. The next lowest cached value
     // 2. The value retrieved from the db
-    if (it == indices_.begin()) {
-        // No cached lower value, return the db index
-        return std::make_pair(false, db_index);
-    }
-    --it;
-    //  it now points to the value less than that requested
-    return std::make_pair(false, it->first > retrieved_value ? it->second : db_index);
+    return std::make_pair(false, floor->first > retrieved_value ? floor->second : db_index);
 }
 
 template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_preimage_by_hash(const fr& leaf_hash,
                                                                      IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<fr, IndexedLeafValueType>::const_iterator it = leaves_.find(leaf_hash);
+    auto it = leaves_.find(leaf_hash);
     if (it != leaves_.end()) {
         leaf_pre_image = it->second;
         return true;
@@ -356,8 +359,7 @@ template <typename LeafValueType>
 bool ContentAddressedCache<LeafValueType>::get_leaf_by_index(const index_t& index,
                                                              IndexedLeafValueType& leaf_pre_image) const
 {
-    typename std::unordered_map<index_t, IndexedLeafValueType>::const_iterator it =
-        leaf_pre_image_by_index_.find(index);
+    auto it = leaf_pre_image_by_index_.find(index);
     if (it != leaf_pre_image_by_index_.end()) {
         leaf_pre_image = it->second;
         return true;
@@ -397,8 +399,8 @@ template <typename LeafValueType>
 void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t& index, const fr& leaf_key)
 {
     uint256_t key = uint256_t(leaf_key);
-    auto result = indices_.insert({ key, index });
-    if (result.second && !journals_.empty()) {
+    bool inserted = indices_.insert(key, index);
+    if (inserted && !journals_.empty()) {
         // The insertion took place, if we have a current journal then we need to add to the newly inserted leaf keys
         Journal& journal = journals_.back();
         journal.new_leaf_keys_.emplace_back(key);
@@ -408,11 +410,7 @@ void ContentAddressedCache<LeafValueType>::update_leaf_key_index(const index_t&
 template <typename LeafValueType>
 std::optional<index_t> ContentAddressedCache<LeafValueType>::get_leaf_key_index(const fr& leaf_key) const
 {
-    auto it = indices_.find(uint256_t(leaf_key));
-    if (it == indices_.end()) {
-        return std::nullopt;
-    }
-    return it->second;
+    return indices_.find(uint256_t(leaf_key));
 }
 
 template <typename LeafValueType>
@@ -0,0 +1,194 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief An ordered map stored as a sorted sequence of contiguous chunks, i.e. a two level B+ tree
+ *
+ * @details Entries are held by value in sorted vectors of at most MaxChunkSize entries, with the first key of every
+ * chunk held separately so that locating a chunk is a binary search over contiguous memory. Inserting or erasing only
+ * moves entries within one chunk, full chunks are split in two and empty chunks are removed. Compared to std::map this
+ * does no allocation per entry and range queries touch a couple of cache lines rather than a chain of tree nodes.
+ * Like std::map::insert, inserting an existing key leaves its value unchanged. Any modification invalidates iterators
+ * and pointers to entries.
+ */
+template <typename Key, typename Value, size_t MaxChunkSize = 256> class OrderedFlatMap {
+  public:
+    using Entry = std::pair<Key, Value>;
+
+    class const_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const Entry*;
+        using reference = const Entry&;
+
+        const_iterator() = default;
+        const_iterator(const std::vector<std::vector<Entry>>* chunks, size_t chunk, size_t position)
+            : chunks_(chunks)
+            , chunk_(chunk)
+            , position_(position)
+        {}
+
+        reference operator*() const { return (*chunks_)[chunk_][position_]; }
+        pointer operator->() const { return &(*chunks_)[chunk_][position_]; }
+
+        const_iterator& operator++()
+        {
+            if (++position_ == (*chunks_)[chunk_].size()) {
+                ++chunk_;
+                position_ = 0;
+            }
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            const_iterator previous = *this;
+            ++(*this);
+            return previous;
+        }
+
+        bool operator==(const const_iterator& other) const
+        {
+            return chunk_ == other.chunk_ && position_ == other.position_;
+        }
+
+      private:
+        const std::vector<std::vector<Entry>>* chunks_ = nullptr;
+        size_t chunk_ = 0;
+        size_t position_ = 0;
+    };
+
+    OrderedFlatMap() = default;
+
+    const_iterator begin() const { return const_iterator(&chunks_, 0, 0); }
+    const_iterator end() const { return const_iterator(&chunks_, chunks_.size(), 0); }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /**
+     * @brief Inserts the entry if the key is not already present, returns whether it was inserted
+     */
+    bool insert(const Key& key, const Value& value)
+    {
+        if (chunks_.empty()) {
+            chunks_.emplace_back().emplace_back(key, value);
+            first_keys_.push_back(key);
+            size_ = 1;
+            return true;
+        }
+        const size_t chunk_index = find_chunk(key);
+        std::vector<Entry>& chunk = chunks_[chunk_index];
+        auto it = std::lower_bound(chunk.begin(), chunk.end(), key, compare_key);
+        if (it != chunk.end() && it->first == key) {
+            return false;
+        }
+        chunk.emplace(it, key, value);
+        first_keys_[chunk_index] = chunk.front().first;
+        ++size_;
+        if (chunk.size() > MaxChunkSize) {
+            split_chunk(chunk_index);
+        }
+        return true;
+    }
+
+    /**
+     * @brief Removes the entry with the given key, returns whether there was one
+     */
+    bool erase(const Key& key)
+    {
+        if (chunks_.empty()) {
+            return false;
+        }
+        const size_t chunk_index = find_chunk(key);
+        std::vector<Entry>& chunk = chunks_[chunk_index];
+        auto it = std::lower_bound(chunk.begin(), chunk.end(), key, compare_key);
+        if (it == chunk.end() || it->first != key) {
+            return false;
+        }
+        chunk.erase(it);
+        --size_;
+        if (chunk.empty()) {
+            chunks_.erase(chunks_.begin() + static_cast<std::ptrdiff_t>(chunk_index));
+            first_keys_.erase(first_keys_.begin() + static_cast<std::ptrdiff_t>(chunk_index));
+        } else {
+            first_keys_[chunk_index] = chunk.front().first;
+        }
+        return true;
+    }
+
+    std::optional<Value> find(const Key& key) const
+    {
+        const Entry* entry = find_floor(key);
+        if (entry == nullptr || entry->first != key) {
+            return std::nullopt;
+        }
+        return entry->second;
+    }
+
+    /**
+     * @brief Returns the entry with the largest key not greater than the given key, or nullptr if there is none
+     */
+    const Entry* find_floor(const Key& key) const
+    {
+        if (chunks_.empty()) {
+            return nullptr;
+        }
+        const std::vector<Entry>& chunk = chunks_[find_chunk(key)];
+        auto it = std::upper_bound(
+            chunk.begin(), chunk.end(), key, [](const Key& k, const Entry& entry) { return k < entry.first; });
+        // Only the first chunk can have no entry not greater than the key
+        if (it == chunk.begin()) {
+            return nullptr;
+        }
+        return &*std::prev(it);
+    }
+
+    bool operator==(const OrderedFlatMap& other) const
+    {
+        // The chunk boundaries depend on the order of insertion, so compare the entries
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+
+  private:
+    std::vector<std::vector<Entry>> chunks_;
+    std::vector<Key> first_keys_;
+    size_t size_ = 0;
+
+    static bool compare_key(const Entry& entry, const Key& key) { return entry.first < key; }
+
+    // The last chunk starting with a key not greater than the given key, or the first chunk if there is none
+    size_t find_chunk(const Key& key) const
+    {
+        auto it = std::upper_bound(first_keys_.begin(), first_keys_.end(), key);
+        return it == first_keys_.begin() ? 0 : static_cast<size_t>(std::distance(first_keys_.begin(), it)) - 1;
+    }
+
+    void split_chunk(size_t chunk_index)
+    {
+        std::vector<Entry>& chunk = chunks_[chunk_index];
+        const auto middle = chunk.begin() + static_cast<std::ptrdiff_t>(chunk.size() / 2);
+        std::vector<Entry> upper(std::make_move_iterator(middle), std::make_move_iterator(chunk.end()));
+        chunk.erase(middle, chunk.end());
+        const auto position = static_cast<std::ptrdiff_t>(chunk_index) + 1;
+        first_keys_.insert(first_keys_.begin() + position, upper.front().first);
+        chunks_.insert(chunks_.begin() + position, std::move(upper));
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
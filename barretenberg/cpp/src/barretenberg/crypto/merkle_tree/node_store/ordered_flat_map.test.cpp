@@ -0,0 +1,62 @@
+#include "barretenberg/crypto/merkle_tree/node_store/ordered_flat_map.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <cstdint>
+#include <map>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+TEST(OrderedFlatMapTest, matches_std_map)
+{
+    // Small chunks so that chunks are frequently split and removed
+    OrderedFlatMap<uint256_t, uint64_t, 4> map;
+    std::map<uint256_t, uint64_t> expected;
+    for (uint64_t i = 0; i < 2000; ++i) {
+        const uint256_t key = engine.get_random_uint64() % 256;
+        if (engine.get_random_uint8() % 3 == 0) {
+            EXPECT_EQ(map.erase(key), expected.erase(key) == 1);
+        } else {
+            EXPECT_EQ(map.insert(key, i), expected.insert({ key, i }).second);
+        }
+        EXPECT_EQ(map.size(), expected.size());
+
+        const uint256_t query = engine.get_random_uint64() % 257;
+        auto it = expected.upper_bound(query);
+        const auto* floor = map.find_floor(query);
+        if (it == expected.begin()) {
+            EXPECT_EQ(floor, nullptr);
+        } else {
+            --it;
+            ASSERT_NE(floor, nullptr);
+            EXPECT_EQ(floor->first, it->first);
+            EXPECT_EQ(floor->second, it->second);
+        }
+        auto found = expected.find(query);
+        EXPECT_EQ(map.find(query), found == expected.end() ? std::nullopt : std::optional<uint64_t>(found->second));
+    }
+    EXPECT_TRUE(std::equal(map.begin(), map.end(), expected.begin(), expected.end(), [](const auto& a, const auto& b) {
+        return a.first == b.first && a.second == b.second;
+    }));
+}
+
+TEST(OrderedFlatMapTest, equality_is_independent_of_insertion_order)
+{
+    OrderedFlatMap<uint256_t, uint64_t, 4> ascending;
+    OrderedFlatMap<uint256_t, uint64_t, 4> descending;
+    for (uint64_t i = 0; i < 20; ++i) {
+        ascending.insert(i, i);
+        descending.insert(19 - i, 19 - i);
+    }
+    EXPECT_EQ(ascending, descending);
+    descending.erase(7);
+    EXPECT_NE(ascending, descending);
+    descending.insert(7, 8);
+    EXPECT_NE(ascending, descending);
+}
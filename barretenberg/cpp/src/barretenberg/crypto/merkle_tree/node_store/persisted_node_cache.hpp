@@ -0,0 +1,84 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <cstddef>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A bounded, thread safe cache of nodes read from a persisted tree, shared by the tree and all of its forks
+ *
+ * @details Nodes are content addressed, so a node read at any block is valid for every root that references it and
+ * the cache never needs to be copied or versioned when forking. Each fork's uncommitted nodes live in its own cache
+ * and shadow this one. The cache is bounded by keeping two generations of at most capacity nodes each, once the
+ * current generation is full it replaces the previous one. Lookups only take a shared lock, so nodes are not
+ * promoted between generations, a node still in use after being dropped is simply read from the store again.
+ */
+template <typename NodeType> class PersistedNodeCache {
+  public:
+    static constexpr size_t DEFAULT_CAPACITY = 1UL << 16;
+
+    explicit PersistedNodeCache(size_t capacity = DEFAULT_CAPACITY)
+        : capacity_(capacity)
+    {}
+    PersistedNodeCache(const PersistedNodeCache& other) = delete;
+    PersistedNodeCache(PersistedNodeCache&& other) = delete;
+    PersistedNodeCache& operator=(const PersistedNodeCache& other) = delete;
+    PersistedNodeCache& operator=(PersistedNodeCache&& other) = delete;
+    ~PersistedNodeCache() = default;
+
+    bool get(const fr& nodeHash, NodeType& node) const
+    {
+        std::shared_lock lock(mtx_);
+        for (const auto* nodes : { &current_, &previous_ }) {
+            auto it = nodes->find(nodeHash);
+            if (it != nodes->end()) {
+                node = it->second;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void put(const fr& nodeHash, const NodeType& node)
+    {
+        std::unique_lock lock(mtx_);
+        if (current_.size() >= capacity_) {
+            previous_ = std::move(current_);
+            current_ = std::unordered_map<fr, NodeType>();
+        }
+        current_.insert_or_assign(nodeHash, node);
+    }
+
+    /**
+     * @brief Removes a node deleted from the store
+     */
+    void erase(const fr& nodeHash)
+    {
+        std::unique_lock lock(mtx_);
+        current_.erase(nodeHash);
+        previous_.erase(nodeHash);
+    }
+
+    size_t size() const
+    {
+        std::shared_lock lock(mtx_);
+        return current_.size() + previous_.size();
+    }
+
+  private:
+    size_t capacity_;
+    mutable std::shared_mutex mtx_;
+    std::unordered_map<fr, NodeType> current_;
+    std::unordered_map<fr, NodeType> previous_;
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,54 @@
+#include "barretenberg/crypto/merkle_tree/node_store/persisted_node_cache.hpp"
+#include "barretenberg/common/test.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_tree_store.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <cstdint>
+#include <vector>
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+using CacheType = PersistedNodeCache<NodePayload>;
+
+TEST(PersistedNodeCacheTest, can_get_and_erase_nodes)
+{
+    CacheType cache;
+    fr hash = fr::random_element();
+    NodePayload node{ .left = fr::random_element(), .right = std::nullopt, .ref = 1 };
+    NodePayload retrieved;
+    EXPECT_FALSE(cache.get(hash, retrieved));
+
+    cache.put(hash, node);
+    EXPECT_TRUE(cache.get(hash, retrieved));
+    EXPECT_EQ(retrieved, node);
+
+    cache.erase(hash);
+    EXPECT_FALSE(cache.get(hash, retrieved));
+    EXPECT_EQ(cache.size(), 0UL);
+}
+
+TEST(PersistedNodeCacheTest, keeps_two_generations_of_nodes)
+{
+    constexpr size_t capacity = 4;
+    CacheType cache(capacity);
+    std::vector<fr> hashes;
+    for (size_t i = 0; i < 3 * capacity; ++i) {
+        hashes.push_back(fr::random_element());
+        cache.put(hashes.back(), NodePayload{ .left = hashes.back(), .right = std::nullopt, .ref = i });
+        EXPECT_LE(cache.size(), 2 * capacity);
+    }
+
+    // The first generation has been dropped, the last two are retained
+    NodePayload retrieved;
+    for (size_t i = 0; i < hashes.size(); ++i) {
+        EXPECT_EQ(cache.get(hashes[i], retrieved), i >= capacity);
+    }
+    EXPECT_TRUE(cache.get(hashes.back(), retrieved));
+    EXPECT_EQ(retrieved.ref, hashes.size() - 1);
+
+    // Erasing covers both generations
+    cache.erase(hashes[capacity]);
+    cache.erase(hashes.back());
+    EXPECT_FALSE(cache.get(hashes[capacity], retrieved));
+    EXPECT_FALSE(cache.get(hashes.back(), retrieved));
+}
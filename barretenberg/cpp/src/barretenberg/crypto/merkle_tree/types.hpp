@@ -10,6 +10,7 @@
 #include "barretenberg/lmdblib/types.hpp"
 #include "lmdb.h"
 #include <cstdint>
+#include <memory>
 #include <optional>
 namespace bb::crypto::merkle_tree {
 
@@ -22,11 +23,15 @@ using BlockMetaKeyType = uint64_t;
 using FrKeyType = uint256_t;
 using MetaKeyType = uint8_t;
 
+struct BlockUpperNodesPayload;
+
 struct RequestContext {
     bool includeUncommitted;
     std::optional<block_number_t> blockNumber;
     bb::fr root;
     std::optional<index_t> maxIndex;
+    // The upper levels of the tree at blockNumber, if they were stored
+    std::shared_ptr<const BlockUpperNodesPayload> upperNodes;
 };
 
 template <typename LeafType> fr preimage_to_key(const LeafType& leaf)
@@ -64,6 +69,7 @@ const std::string NODES_DB = "nodes";
 const std::string LEAF_PREIMAGES_DB = "leaf preimages";
 const std::string LEAF_INDICES_DB = "leaf indices";
 const std::string BLOCK_INDICES_DB = "block indices";
+const std::string BLOCK_UPPER_NODES_DB = "block upper nodes";
 
 struct TreeDBStats {
     uint64_t mapSize;
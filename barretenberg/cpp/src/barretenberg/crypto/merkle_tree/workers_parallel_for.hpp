@@ -0,0 +1,60 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/common/thread_pool.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief Runs func(0), ..., func(num_tasks - 1) on the workers of a tree and the calling thread
+ *
+ * @details The trees call this from jobs already running on their pool, so waiting for the pool to drain would
+ * deadlock. Instead the calling thread claims tasks itself alongside any workers that pick up the enqueued helpers,
+ * and only waits for tasks that have been claimed. When every worker is busy the caller simply runs all the tasks.
+ * Helpers that start after all tasks have been claimed return without touching func.
+ */
+inline void workers_parallel_for(ThreadPool& workers, size_t num_tasks, const std::function<void(size_t)>& func)
+{
+    if (num_tasks == 0) {
+        return;
+    }
+    if (num_tasks == 1) {
+        func(0);
+        return;
+    }
+    struct State {
+        std::atomic<size_t> next_task = 0;
+        std::atomic<size_t> completed_tasks = 0;
+    };
+    // Outlives this call, as helpers may be dequeued after we return
+    auto state = std::make_shared<State>();
+    const std::function<void(size_t)>* func_ptr = &func;
+    auto run_tasks = [state, func_ptr, num_tasks]() {
+        for (size_t task = state->next_task++; task < num_tasks; task = state->next_task++) {
+            (*func_ptr)(task);
+            if (++state->completed_tasks == num_tasks) {
+                state->completed_tasks.notify_all();
+            }
+        }
+    };
+    const size_t num_helpers = std::min(num_tasks - 1, workers.num_threads());
+    for (size_t i = 0; i < num_helpers; ++i) {
+        workers.enqueue(run_tasks);
+    }
+    run_tasks();
+    for (size_t completed = state->completed_tasks.load(); completed < num_tasks;
+         completed = state->completed_tasks.load()) {
+        state->completed_tasks.wait(completed);
+    }
+}
+
+} // namespace bb::crypto::merkle_tree
@@ -16,5 +16,14 @@ typename Poseidon2<Params>::FF Poseidon2<Params>::hash(const std::vector<typenam
     return Sponge::hash_internal(input);
 }
 
+/**
+ * @brief Hashes a batch of inputs of the same length, given concatenated, into one output per input
+ */
+template <typename Params>
+void Poseidon2<Params>::hash_batch(std::span<const FF> inputs, size_t input_length, std::span<FF> outputs)
+{
+    Sponge::hash_internal_batch(inputs, input_length, outputs);
+}
+
 template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
 } // namespace bb::crypto
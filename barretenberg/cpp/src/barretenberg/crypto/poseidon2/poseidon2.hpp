@@ -23,6 +23,11 @@ template <typename Params> class Poseidon2 {
      * @brief Hashes a vector of field elements
      */
     static FF hash(const std::vector<FF>& input);
+
+    /**
+     * @brief Hashes a batch of inputs of the same length, given concatenated, into one output per input
+     */
+    static void hash_batch(std::span<const FF> inputs, size_t input_length, std::span<FF> outputs);
 };
 
 extern template class Poseidon2<Poseidon2Bn254ScalarFieldParams>;
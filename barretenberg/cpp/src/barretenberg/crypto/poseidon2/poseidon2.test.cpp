@@ -45,3 +45,23 @@ TEST(Poseidon2, HashConsistencyCheck)
 
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2, HashBatchMatchesHash)
+{
+    using Poseidon2 = crypto::Poseidon2<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Covers inputs absorbed in zero, one and several blocks, and more inputs than are hashed side by side
+    for (size_t input_length : { 0UL, 1UL, 2UL, 3UL, 4UL, 7UL }) {
+        const size_t num_inputs = 70;
+        std::vector<fr> inputs(num_inputs * input_length);
+        for (auto& element : inputs) {
+            element = fr::random_element(&engine);
+        }
+        std::vector<fr> outputs(num_inputs);
+        Poseidon2::hash_batch(inputs, input_length, outputs);
+        for (size_t i = 0; i < num_inputs; ++i) {
+            const auto begin = inputs.begin() + static_cast<std::ptrdiff_t>(i * input_length);
+            const std::vector<fr> input(begin, begin + static_cast<std::ptrdiff_t>(input_length));
+            EXPECT_EQ(outputs[i], Poseidon2::hash(input)) << "input length " << input_length << ", input " << i;
+        }
+    }
+}
@@ -13,6 +13,7 @@
 #include <array>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace bb::crypto {
 
@@ -166,5 +167,81 @@ template <typename Params> class Poseidon2Permutation {
         }
         return current_state;
     }
+
+    // Number of states permuted in lock step by permutation_batch
+    static constexpr size_t BATCH_LANES = 4;
+
+    /**
+     * @brief Applies the permutation to each of a batch of independent states, in place
+     * @details A single permutation is a long chain of dependent field multiplications, most of it the s-box of the
+     * partial rounds. Permuting BATCH_LANES states in lock step interleaves independent multiplications so that they
+     * can be pipelined. The result is identical to calling permutation() on each state.
+     */
+    static void permutation_batch(std::span<State> states)
+    {
+        size_t i = 0;
+        for (; i + BATCH_LANES <= states.size(); i += BATCH_LANES) {
+            permutation_lanes(states.subspan(i).template first<BATCH_LANES>());
+        }
+        for (; i < states.size(); ++i) {
+            states[i] = permutation(states[i]);
+        }
+    }
+
+  private:
+    static void apply_single_sbox_lanes(std::array<FF*, BATCH_LANES> inputs)
+    {
+        std::array<FF, BATCH_LANES> squares;
+        for (size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            squares[lane] = inputs[lane]->sqr();
+        }
+        for (size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            squares[lane].self_sqr();
+        }
+        for (size_t lane = 0; lane < BATCH_LANES; ++lane) {
+            *inputs[lane] *= squares[lane];
+        }
+    }
+
+    static void external_round_lanes(std::span<State, BATCH_LANES> states, const RoundConstants& rc)
+    {
+        for (auto& state : states) {
+            add_round_constants(state, rc);
+        }
+        for (size_t i = 0; i < t; ++i) {
+            apply_single_sbox_lanes({ &states[0][i], &states[1][i], &states[2][i], &states[3][i] });
+        }
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+    }
+
+    static void permutation_lanes(std::span<State, BATCH_LANES> states)
+    {
+        static_assert(BATCH_LANES == 4);
+        for (auto& state : states) {
+            matrix_multiplication_external(state);
+        }
+
+        constexpr size_t rounds_f_beginning = rounds_f / 2;
+        for (size_t i = 0; i < rounds_f_beginning; ++i) {
+            external_round_lanes(states, round_constants[i]);
+        }
+
+        const size_t p_end = rounds_f_beginning + rounds_p;
+        for (size_t i = rounds_f_beginning; i < p_end; ++i) {
+            for (auto& state : states) {
+                state[0] += round_constants[i][0];
+            }
+            apply_single_sbox_lanes({ &states[0][0], &states[1][0], &states[2][0], &states[3][0] });
+            for (auto& state : states) {
+                matrix_multiplication_internal(state);
+            }
+        }
+
+        for (size_t i = p_end; i < NUM_ROUNDS; ++i) {
+            external_round_lanes(states, round_constants[i]);
+        }
+    }
 };
 } // namespace bb::crypto
@@ -59,3 +59,24 @@ TEST(Poseidon2Permutation, ConsistencyCheck)
     };
     EXPECT_EQ(result, expected);
 }
+
+TEST(Poseidon2Permutation, BatchMatchesPermutation)
+{
+    using Permutation = crypto::Poseidon2Permutation<crypto::Poseidon2Bn254ScalarFieldParams>;
+    // Whole groups of lanes followed by a remainder
+    std::vector<Permutation::State> states(2 * Permutation::BATCH_LANES + 3);
+    for (auto& state : states) {
+        for (auto& element : state) {
+            element = fr::random_element(&engine);
+        }
+    }
+    states[0] = crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_INPUT;
+    std::vector<Permutation::State> expected;
+    for (const auto& state : states) {
+        expected.push_back(Permutation::permutation(state));
+    }
+
+    Permutation::permutation_batch(states);
+    EXPECT_EQ(states, expected);
+    EXPECT_EQ(states[0], crypto::Poseidon2Bn254ScalarFieldParams::TEST_VECTOR_OUTPUT);
+}
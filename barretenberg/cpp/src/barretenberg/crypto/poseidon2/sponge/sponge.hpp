@@ -6,11 +6,13 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <span>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
 namespace bb::crypto {
@@ -159,5 +161,46 @@ template <typename FF, size_t rate, size_t capacity, size_t t, typename Permutat
 
     static FF hash_internal(std::span<const FF> input) { return hash_internal<1>(input)[0]; }
     static FF hash_internal(std::span<const FF> input, FF iv) { return hash_internal<1>(input, iv)[0]; }
+
+    /**
+     * @brief Hash a batch of independent inputs of the same length, equivalent to hash_internal on each of them
+     * @details The sponges of up to HASH_BATCH_SIZE inputs are run side by side, so that each absorbed block is
+     * permuted with one call to Permutation::permutation_batch.
+     *
+     * @param inputs The inputs, concatenated
+     * @param in_len The length of each input
+     * @param outputs Receives the hash of each input
+     */
+    static void hash_internal_batch(std::span<const FF> inputs, size_t in_len, std::span<FF> outputs)
+    {
+        BB_ASSERT_EQ(inputs.size(), in_len * outputs.size());
+        constexpr size_t HASH_BATCH_SIZE = 64;
+        const FF iv = static_cast<uint256_t>(in_len) << 64;
+        std::array<std::array<FF, t>, HASH_BATCH_SIZE> states;
+        for (size_t start = 0; start < outputs.size(); start += HASH_BATCH_SIZE) {
+            const auto batch_states = std::span(states).first(std::min(HASH_BATCH_SIZE, outputs.size() - start));
+            for (auto& state : batch_states) {
+                state.fill(0);
+                state[rate] = iv;
+            }
+            // Absorb rate elements per permutation, zero padding the last block. As in perform_duplex, an empty input
+            // is still permuted once.
+            size_t num_absorbed = 0;
+            do {
+                const size_t block_size = std::min(rate, in_len - num_absorbed);
+                for (size_t j = 0; j < batch_states.size(); ++j) {
+                    const size_t offset = (start + j) * in_len + num_absorbed;
+                    for (size_t i = 0; i < block_size; ++i) {
+                        batch_states[j][i] += inputs[offset + i];
+                    }
+                }
+                Permutation::permutation_batch(batch_states);
+                num_absorbed += block_size;
+            } while (num_absorbed < in_len);
+            for (size_t j = 0; j < batch_states.size(); ++j) {
+                outputs[start + j] = batch_states[j][0];
+            }
+        }
+    }
 };
 } // namespace bb::crypto
@@ -9,6 +9,7 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/dsl/acir_format/civc_recursion_constraints.hpp"
 #include "barretenberg/dsl/acir_format/ecdsa_constraints.hpp"
@@ -29,7 +30,10 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <memory>
+#include <span>
+#include <vector>
 
 namespace acir_format {
 
@@ -84,179 +88,258 @@ template <typename Builder> struct HonkRecursionConstraintsOutput {
     }
 };
 
+namespace {
+/**
+ * @brief The logic, range, black box and memory block constraints, in the order build_constraints adds them
+ * @details None of these constraints depend on each other, so they can be constructed in turn on the builder or in
+ * parallel on sub-builders, see build_independent_constraints_in_parallel.
+ */
+template <typename Builder> struct IndependentConstraints {
+    std::vector<std::function<void(Builder&)>> create;
+    // The opcodes each constraint was created from, its gates are shared evenly between them when counting gates
+    std::vector<std::span<const size_t>> opcode_indices;
+};
+
 template <typename Builder>
-void build_constraints(Builder& builder, AcirProgram& program, const ProgramMetadata& metadata)
+IndependentConstraints<Builder> collect_independent_constraints(AcirFormat& constraint_system,
+                                                                bool has_valid_witness_assignments)
 {
-    using PairingPoints = stdlib::recursion::PairingPoints<Builder>;
-    bool has_valid_witness_assignments = !program.witness.empty();
-    bool collect_gates_per_opcode = metadata.collect_gates_per_opcode;
-    AcirFormat& constraint_system = program.constraints;
-
-    if (collect_gates_per_opcode) {
-        constraint_system.gates_per_opcode.resize(constraint_system.num_acir_opcodes, 0);
-    }
-
-    GateCounter gate_counter{ &builder, collect_gates_per_opcode };
-
-    // Add arithmetic gates
-    for (size_t i = 0; i < constraint_system.poly_triple_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.poly_triple_constraints.at(i);
-        builder.create_poly_gate(constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.poly_triple_constraints.at(i));
-    }
-
-    for (size_t i = 0; i < constraint_system.quad_constraints.size(); ++i) {
-        const auto& constraint = constraint_system.quad_constraints.at(i);
-        builder.create_big_mul_gate(constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.quad_constraints.at(i));
-    }
-    // Oversize gates are a vector of mul_quad gates.
-    for (size_t i = 0; i < constraint_system.big_quad_constraints.size(); ++i) {
-        auto& big_constraint = constraint_system.big_quad_constraints.at(i);
-        fr next_w4_wire_value = fr(0);
-        // Define the 4th wire of these mul_quad gates, which is implicitly used by the previous gate.
-        for (size_t j = 0; j < big_constraint.size() - 1; ++j) {
-            if (j == 0) {
-                next_w4_wire_value = builder.get_variable(big_constraint[0].d);
-            } else {
-                uint32_t next_w4_wire = builder.add_variable(next_w4_wire_value);
-                big_constraint[j].d = next_w4_wire;
-                big_constraint[j].d_scaling = fr(-1);
-            }
-            builder.create_big_mul_add_gate(big_constraint[j], true);
-            next_w4_wire_value = builder.get_variable(big_constraint[j].a) * builder.get_variable(big_constraint[j].b) *
-                                     big_constraint[j].mul_scaling +
-                                 builder.get_variable(big_constraint[j].a) * big_constraint[j].a_scaling +
-                                 builder.get_variable(big_constraint[j].b) * big_constraint[j].b_scaling +
-                                 builder.get_variable(big_constraint[j].c) * big_constraint[j].c_scaling +
-                                 next_w4_wire_value * big_constraint[j].d_scaling + big_constraint[j].const_scaling;
-            next_w4_wire_value = -next_w4_wire_value;
-        }
-        uint32_t next_w4_wire = builder.add_variable(next_w4_wire_value);
-        big_constraint.back().d = next_w4_wire;
-        big_constraint.back().d_scaling = fr(-1);
-        builder.create_big_mul_add_gate(big_constraint.back(), false);
-    }
+    IndependentConstraints<Builder> constraints;
+    const auto& indices = constraint_system.original_opcode_indices;
 
     // Add logic constraint
     for (size_t i = 0; i < constraint_system.logic_constraints.size(); ++i) {
         const auto& constraint = constraint_system.logic_constraints.at(i);
-        create_logic_gate(
-            builder, constraint.a, constraint.b, constraint.result, constraint.num_bits, constraint.is_xor_gate);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.logic_constraints.at(i));
+        constraints.create.emplace_back([&constraint](Builder& builder) {
+            create_logic_gate(
+                builder, constraint.a, constraint.b, constraint.result, constraint.num_bits, constraint.is_xor_gate);
+        });
+        constraints.opcode_indices.emplace_back(&indices.logic_constraints.at(i), 1);
     }
 
     // Add range constraint
-    // preprocessing: remove range constraints if they are implied by memory operations
-    for (auto const& index_range : constraint_system.index_range) {
-        if (constraint_system.minimal_range[index_range.first] == index_range.second) {
-            constraint_system.minimal_range.erase(index_range.first);
-        }
-    }
     for (size_t i = 0; i < constraint_system.range_constraints.size(); ++i) {
         const auto& constraint = constraint_system.range_constraints.at(i);
-        uint32_t range = constraint.num_bits;
         if (constraint_system.minimal_range.contains(constraint.witness)) {
-            range = constraint_system.minimal_range[constraint.witness];
-            builder.create_range_constraint(constraint.witness, range, "");
-            gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                    constraint_system.original_opcode_indices.range_constraints.at(i));
+            const uint32_t witness = constraint.witness;
+            const uint32_t range = constraint_system.minimal_range[witness];
+            constraints.create.emplace_back(
+                [witness, range](Builder& builder) { builder.create_range_constraint(witness, range, ""); });
+            constraints.opcode_indices.emplace_back(&indices.range_constraints.at(i), 1);
             // no need to add more range constraints for this witness.
-            constraint_system.minimal_range.erase(constraint.witness);
+            constraint_system.minimal_range.erase(witness);
         }
     }
 
     // Add aes128 constraints
     for (size_t i = 0; i < constraint_system.aes128_constraints.size(); ++i) {
         const auto& constraint = constraint_system.aes128_constraints.at(i);
-        create_aes128_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.aes128_constraints.at(i));
+        constraints.create.emplace_back(
+            [&constraint](Builder& builder) { create_aes128_constraints(builder, constraint); });
+        constraints.opcode_indices.emplace_back(&indices.aes128_constraints.at(i), 1);
     }
 
     // Add sha256 constraints
     for (size_t i = 0; i < constraint_system.sha256_compression.size(); ++i) {
-        const auto& constraint = constraint_system.sha256_compression[i];
-        create_sha256_compression_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.sha256_compression[i]);
+        const auto& constraint = constraint_system.sha256_compression.at(i);
+        constraints.create.emplace_back(
+            [&constraint](Builder& builder) { create_sha256_compression_constraints(builder, constraint); });
+        constraints.opcode_indices.emplace_back(&indices.sha256_compression.at(i), 1);
     }
 
     // Add ECDSA k1 constraints
     for (size_t i = 0; i < constraint_system.ecdsa_k1_constraints.size(); ++i) {
         const auto& constraint = constraint_system.ecdsa_k1_constraints.at(i);
-        create_ecdsa_verify_constraints<stdlib::secp256k1<Builder>>(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.ecdsa_k1_constraints.at(i));
+        constraints.create.emplace_back([&constraint, has_valid_witness_assignments](Builder& builder) {
+            create_ecdsa_verify_constraints<stdlib::secp256k1<Builder>>(
+                builder, constraint, has_valid_witness_assignments);
+        });
+        constraints.opcode_indices.emplace_back(&indices.ecdsa_k1_constraints.at(i), 1);
     }
 
     // Add ECDSA r1 constraints
     for (size_t i = 0; i < constraint_system.ecdsa_r1_constraints.size(); ++i) {
         const auto& constraint = constraint_system.ecdsa_r1_constraints.at(i);
-        create_ecdsa_verify_constraints<stdlib::secp256r1<Builder>>(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.ecdsa_r1_constraints.at(i));
+        constraints.create.emplace_back([&constraint, has_valid_witness_assignments](Builder& builder) {
+            create_ecdsa_verify_constraints<stdlib::secp256r1<Builder>>(
+                builder, constraint, has_valid_witness_assignments);
+        });
+        constraints.opcode_indices.emplace_back(&indices.ecdsa_r1_constraints.at(i), 1);
     }
 
     // Add blake2s constraints
     for (size_t i = 0; i < constraint_system.blake2s_constraints.size(); ++i) {
         const auto& constraint = constraint_system.blake2s_constraints.at(i);
-        create_blake2s_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake2s_constraints.at(i));
+        constraints.create.emplace_back(
+            [&constraint](Builder& builder) { create_blake2s_constraints(builder, constraint); });
+        constraints.opcode_indices.emplace_back(&indices.blake2s_constraints.at(i), 1);
     }
 
     // Add blake3 constraints
     for (size_t i = 0; i < constraint_system.blake3_constraints.size(); ++i) {
         const auto& constraint = constraint_system.blake3_constraints.at(i);
-        create_blake3_constraints(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.blake3_constraints.at(i));
+        constraints.create.emplace_back(
+            [&constraint](Builder& builder) { create_blake3_constraints(builder, constraint); });
+        constraints.opcode_indices.emplace_back(&indices.blake3_constraints.at(i), 1);
     }
 
     // Add keccak permutations
     for (size_t i = 0; i < constraint_system.keccak_permutations.size(); ++i) {
-        const auto& constraint = constraint_system.keccak_permutations[i];
-        create_keccak_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.keccak_permutations[i]);
+        const auto& constraint = constraint_system.keccak_permutations.at(i);
+        constraints.create.emplace_back(
+            [&constraint](Builder& builder) { create_keccak_permutations(builder, constraint); });
+        constraints.opcode_indices.emplace_back(&indices.keccak_permutations.at(i), 1);
     }
 
     for (size_t i = 0; i < constraint_system.poseidon2_constraints.size(); ++i) {
         const auto& constraint = constraint_system.poseidon2_constraints.at(i);
-        create_poseidon2_permutations(builder, constraint);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.poseidon2_constraints.at(i));
+        constraints.create.emplace_back(
+            [&constraint](Builder& builder) { create_poseidon2_permutations(builder, constraint); });
+        constraints.opcode_indices.emplace_back(&indices.poseidon2_constraints.at(i), 1);
     }
 
     // Add multi scalar mul constraints
     for (size_t i = 0; i < constraint_system.multi_scalar_mul_constraints.size(); ++i) {
         const auto& constraint = constraint_system.multi_scalar_mul_constraints.at(i);
-        create_multi_scalar_mul_constraint(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.multi_scalar_mul_constraints.at(i));
+        constraints.create.emplace_back([&constraint, has_valid_witness_assignments](Builder& builder) {
+            create_multi_scalar_mul_constraint(builder, constraint, has_valid_witness_assignments);
+        });
+        constraints.opcode_indices.emplace_back(&indices.multi_scalar_mul_constraints.at(i), 1);
     }
 
     // Add ec add constraints
     for (size_t i = 0; i < constraint_system.ec_add_constraints.size(); ++i) {
         const auto& constraint = constraint_system.ec_add_constraints.at(i);
-        create_ec_add_constraint(builder, constraint, has_valid_witness_assignments);
-        gate_counter.track_diff(constraint_system.gates_per_opcode,
-                                constraint_system.original_opcode_indices.ec_add_constraints.at(i));
+        constraints.create.emplace_back([&constraint, has_valid_witness_assignments](Builder& builder) {
+            create_ec_add_constraint(builder, constraint, has_valid_witness_assignments);
+        });
+        constraints.opcode_indices.emplace_back(&indices.ec_add_constraints.at(i), 1);
     }
 
     // Add block constraints
     for (size_t i = 0; i < constraint_system.block_constraints.size(); ++i) {
         const auto& constraint = constraint_system.block_constraints.at(i);
-        create_block_constraints(builder, constraint, has_valid_witness_assignments);
-        if (collect_gates_per_opcode) {
-            size_t avg_gates_per_opcode =
-                gate_counter.compute_diff() / constraint_system.original_opcode_indices.block_constraints.at(i).size();
-            for (size_t opcode_index : constraint_system.original_opcode_indices.block_constraints.at(i)) {
-                constraint_system.gates_per_opcode[opcode_index] = avg_gates_per_opcode;
+        constraints.create.emplace_back([&constraint, has_valid_witness_assignments](Builder& builder) {
+            create_block_constraints(builder, constraint, has_valid_witness_assignments);
+        });
+        constraints.opcode_indices.emplace_back(indices.block_constraints.at(i));
+    }
+
+    return constraints;
+}
+
+/**
+ * @brief Construct the independent constraints on sub-builders in parallel
+ * @details The constraints are split, in the order in which they were collected, into num_tasks contiguous ranges.
+ * Each range is constructed on its own sub-builder and the sub-builders are merged back in order, so the circuit does
+ * not depend on the number of threads. It does differ from the sequentially constructed circuit, e.g. constants and
+ * range lists are duplicated across sub-builders.
+ */
+void build_independent_constraints_in_parallel(UltraCircuitBuilder& builder,
+                                               const std::vector<std::function<void(UltraCircuitBuilder&)>>& create,
+                                               size_t num_tasks)
+{
+    using Builder = UltraCircuitBuilder;
+    const size_t num_shared_variables = builder.get_num_variables();
+    std::vector<std::unique_ptr<Builder>> sub_builders(num_tasks);
+    parallel_for(num_tasks, [&](size_t task) {
+        sub_builders[task] = std::make_unique<Builder>(builder.create_sub_builder());
+        const size_t start = task * create.size() / num_tasks;
+        const size_t end = (task + 1) * create.size() / num_tasks;
+        for (size_t i = start; i < end; ++i) {
+            create[i](*sub_builders[task]);
+        }
+    });
+    for (auto& sub_builder : sub_builders) {
+        builder.merge_sub_builder(std::move(*sub_builder), num_shared_variables);
+        sub_builder.reset();
+    }
+}
+} // namespace
+
+template <typename Builder>
+void build_constraints(Builder& builder, AcirProgram& program, const ProgramMetadata& metadata)
+{
+    using PairingPoints = stdlib::recursion::PairingPoints<Builder>;
+    bool has_valid_witness_assignments = !program.witness.empty();
+    bool collect_gates_per_opcode = metadata.collect_gates_per_opcode;
+    AcirFormat& constraint_system = program.constraints;
+
+    if (collect_gates_per_opcode) {
+        constraint_system.gates_per_opcode.resize(constraint_system.num_acir_opcodes, 0);
+    }
+
+    GateCounter gate_counter{ &builder, collect_gates_per_opcode };
+
+    // Add arithmetic gates
+    for (size_t i = 0; i < constraint_system.poly_triple_constraints.size(); ++i) {
+        const auto& constraint = constraint_system.poly_triple_constraints.at(i);
+        builder.create_poly_gate(constraint);
+        gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                constraint_system.original_opcode_indices.poly_triple_constraints.at(i));
+    }
+
+    for (size_t i = 0; i < constraint_system.quad_constraints.size(); ++i) {
+        const auto& constraint = constraint_system.quad_constraints.at(i);
+        builder.create_big_mul_gate(constraint);
+        gate_counter.track_diff(constraint_system.gates_per_opcode,
+                                constraint_system.original_opcode_indices.quad_constraints.at(i));
+    }
+    // Oversize gates are a vector of mul_quad gates.
+    for (size_t i = 0; i < constraint_system.big_quad_constraints.size(); ++i) {
+        auto& big_constraint = constraint_system.big_quad_constraints.at(i);
+        fr next_w4_wire_value = fr(0);
+        // Define the 4th wire of these mul_quad gates, which is implicitly used by the previous gate.
+        for (size_t j = 0; j < big_constraint.size() - 1; ++j) {
+            if (j == 0) {
+                next_w4_wire_value = builder.get_variable(big_constraint[0].d);
+            } else {
+                uint32_t next_w4_wire = builder.add_variable(next_w4_wire_value);
+                big_constraint[j].d = next_w4_wire;
+                big_constraint[j].d_scaling = fr(-1);
+            }
+            builder.create_big_mul_add_gate(big_constraint[j], true);
+            next_w4_wire_value = builder.get_variable(big_constraint[j].a) * builder.get_variable(big_constraint[j].b) *
+                                     big_constraint[j].mul_scaling +
+                                 builder.get_variable(big_constraint[j].a) * big_constraint[j].a_scaling +
+                                 builder.get_variable(big_constraint[j].b) * big_constraint[j].b_scaling +
+                                 builder.get_variable(big_constraint[j].c) * big_constraint[j].c_scaling +
+                                 next_w4_wire_value * big_constraint[j].d_scaling + big_constraint[j].const_scaling;
+            next_w4_wire_value = -next_w4_wire_value;
+        }
+        uint32_t next_w4_wire = builder.add_variable(next_w4_wire_value);
+        big_constraint.back().d = next_w4_wire;
+        big_constraint.back().d_scaling = fr(-1);
+        builder.create_big_mul_add_gate(big_constraint.back(), false);
+    }
+
+    // preprocessing: remove range constraints if they are implied by memory operations
+    for (auto const& index_range : constraint_system.index_range) {
+        if (constraint_system.minimal_range[index_range.first] == index_range.second) {
+            constraint_system.minimal_range.erase(index_range.first);
+        }
+    }
+
+    IndependentConstraints<Builder> independent_constraints =
+        collect_independent_constraints<Builder>(constraint_system, has_valid_witness_assignments);
+    bool constructed_in_parallel = false;
+    if constexpr (std::is_same_v<Builder, UltraCircuitBuilder>) {
+        if (metadata.parallel_construction_tasks > 0 && !collect_gates_per_opcode) {
+            build_independent_constraints_in_parallel(
+                builder, independent_constraints.create, metadata.parallel_construction_tasks);
+            constructed_in_parallel = true;
+        }
+    }
+
+    if (!constructed_in_parallel) {
+        for (size_t i = 0; i < independent_constraints.create.size(); ++i) {
+            independent_constraints.create[i](builder);
+            if (collect_gates_per_opcode) {
+                const auto& opcode_indices = independent_constraints.opcode_indices[i];
+                size_t avg_gates_per_opcode = gate_counter.compute_diff() / opcode_indices.size();
+                for (size_t opcode_index : opcode_indices) {
+                    constraint_system.gates_per_opcode[opcode_index] = avg_gates_per_opcode;
+                }
             }
         }
     }
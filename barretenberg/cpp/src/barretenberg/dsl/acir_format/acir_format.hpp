@@ -219,6 +219,10 @@ struct ProgramMetadata {
                                  // 2 means we are using the UltraRollupHonk flavor
     bool collect_gates_per_opcode = false;
     size_t size_hint = 0;
+    // If non-zero, the logic, range, black box and memory block constraints of an Ultra circuit are split into this
+    // many tasks that are constructed in parallel. The circuit depends on the number of tasks (but not on the number of
+    // threads), so the verification key must be computed with the same value. Ignored when collecting gates per opcode.
+    size_t parallel_construction_tasks = 0;
 };
 
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/1161) Refactor this function
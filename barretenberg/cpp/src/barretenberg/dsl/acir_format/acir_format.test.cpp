@@ -13,6 +13,10 @@ using namespace bb;
 using namespace bb::crypto;
 using namespace acir_format;
 
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
 class AcirFormatTests : public ::testing::Test {
   protected:
     static void SetUpTestSuite() { bb::srs::init_file_crs_factory(bb::srs::bb_crs_path()); }
@@ -240,6 +244,57 @@ TEST_F(AcirFormatTests, TestCollectsGateCounts)
     EXPECT_EQ(program.constraints.gates_per_opcode, std::vector<size_t>({ 2, 1 }));
 }
 
+TEST_F(AcirFormatTests, TestParallelConstruction)
+{
+    // a ^ b = c and a & b = d for pairs of 32-bit witnesses, with a and b range constrained
+    const uint32_t num_pairs = 16;
+    AcirFormat constraint_system{
+        .varnum = 4 * num_pairs,
+        .num_acir_opcodes = 4 * num_pairs,
+        .public_inputs = {},
+        .original_opcode_indices = create_empty_original_opcode_indices(),
+    };
+    WitnessVector witness;
+    for (uint32_t i = 0; i < num_pairs; ++i) {
+        const uint32_t a = engine.get_random_uint32();
+        const uint32_t b = engine.get_random_uint32();
+        witness.insert(witness.end(), { a, b, a ^ b, a & b });
+        for (uint32_t is_xor_gate = 0; is_xor_gate < 2; ++is_xor_gate) {
+            constraint_system.logic_constraints.push_back({
+                .a = WitnessOrConstant<bb::fr>::from_index(4 * i),
+                .b = WitnessOrConstant<bb::fr>::from_index(4 * i + 1),
+                .result = 4 * i + 3 - is_xor_gate,
+                .num_bits = 32,
+                .is_xor_gate = is_xor_gate,
+            });
+        }
+        for (uint32_t j = 0; j < 2; ++j) {
+            constraint_system.range_constraints.push_back({ .witness = 4 * i + j, .num_bits = 32 });
+            constraint_system.minimal_range[4 * i + j] = 32;
+        }
+    }
+    mock_opcode_indices(constraint_system);
+
+    auto create = [&](size_t num_tasks, const WitnessVector& witness_values) {
+        AcirProgram program{ constraint_system, witness_values };
+        return create_circuit(program, { .parallel_construction_tasks = num_tasks });
+    };
+    auto sequential = create(0, witness);
+    auto parallel = create(4, witness);
+    // The circuit only depends on the number of tasks
+    EXPECT_TRUE(parallel == create(4, witness));
+    EXPECT_GT(parallel.get_num_variables(), sequential.get_num_variables());
+    EXPECT_TRUE(CircuitChecker::check(sequential));
+    EXPECT_TRUE(CircuitChecker::check(parallel));
+    EXPECT_TRUE(CircuitChecker::check(create(3, witness)));
+    // More tasks than constraints
+    EXPECT_TRUE(CircuitChecker::check(create(128, witness)));
+
+    WitnessVector bad_witness = witness;
+    bad_witness[2] += 1;
+    EXPECT_FALSE(CircuitChecker::check(create(4, bad_witness)));
+}
+
 TEST_F(AcirFormatTests, TestBigAdd)
 {
 
@@ -8,7 +8,12 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <limits>
 #include <map>
+#include <optional>
+#include <set>
+#include <string>
 #include <tuple>
 #include <utility>
 
@@ -28,18 +33,12 @@ namespace acir_format {
 using namespace bb;
 
 /**
- * @brief Deserialize `buf` either based on the first byte interpreted as a
-          Noir serialization format byte, or falling back to `bincode` if
-          the format cannot be recognized. Currently only `msgpack` format
-          is expected, or the legacy `bincode` format.
+ * @brief Whether `buf` holds msgpack data after its format marker, rather than legacy `bincode`.
  * @note Due to the lack of exception handling available to us in Wasm we can't
  *       try `bincode` format and if it fails try `msgpack`; instead we have to
  *       make a decision and commit to it.
  */
-template <typename T>
-T deserialize_any_format(std::vector<uint8_t>&& buf,
-                         std::function<T(msgpack::object const&)> decode_msgpack,
-                         std::function<T(std::vector<uint8_t>)> decode_bincode)
+bool is_msgpack_format(std::vector<uint8_t> const& buf)
 {
     // We can't rely on exceptions to try to deserialize binpack, falling back to
     // msgpack if it fails, because exceptions are (or were) not supported in Wasm
@@ -53,79 +52,105 @@ T deserialize_any_format(std::vector<uint8_t>&& buf,
     // returns true for a `bincode` encoded program, and we have to check
     // whether the value parsed is plausible.
 
-    if (!buf.empty()) {
-        // Once we remove support for legacy bincode format, we should expect to always
-        // have a format marker corresponding to acir::serialization::Format::Msgpack,
-        // but until then a match could be pure coincidence.
-        if (buf[0] == 2) {
-            // Skip the format marker to get the data.
-            const char* buffer = &reinterpret_cast<const char*>(buf.data())[1];
-            size_t size = buf.size() - 1;
-            msgpack::null_visitor probe;
-            if (msgpack::parse(buffer, size, probe)) {
-                auto oh = msgpack::unpack(buffer, size);
-                // This has to be on a separate line, see
-                // https://github.com/msgpack/msgpack-c/issues/695#issuecomment-393035172
-                auto o = oh.get();
-                // In experiments bincode data was parsed as 0.
-                // All the top level formats we look for are MAP types.
-                if (o.type == msgpack::type::MAP) {
-                    return decode_msgpack(o);
-                }
-            }
-        }
-        // `buf[0] == 1` would indicate bincode starting with a format byte,
-        // but if it's a coincidence and it fails to parse then we can't recover
-        // from it, so let's just acknowledge that for now we don't want to
-        // exercise this code path and treat the whole data as bincode.
+    // Once we remove support for legacy bincode format, we should expect to always
+    // have a format marker corresponding to acir::serialization::Format::Msgpack,
+    // but until then a match could be pure coincidence.
+    // `buf[0] == 1` would indicate bincode starting with a format byte,
+    // but if it's a coincidence and it fails to parse then we can't recover
+    // from it, so let's just acknowledge that for now we don't want to
+    // exercise this code path and treat the whole data as bincode.
+    if (buf.size() < 2 || buf[0] != 2) {
+        return false;
     }
-    return decode_bincode(std::move(buf));
+    // Skip the format marker to get the data.
+    const char* buffer = &reinterpret_cast<const char*>(buf.data())[1];
+    size_t size = buf.size() - 1;
+    msgpack::null_visitor probe;
+    if (!msgpack::parse(buffer, size, probe)) {
+        return false;
+    }
+    // In experiments bincode data was parsed as 0.
+    // All the top level formats we look for are MAP types.
+    const uint8_t tag = buf[1];
+    return (tag & 0xf0) == 0x80 || tag == 0xde || tag == 0xdf;
 }
 
 /**
- * @brief Deserializes a `Program` from bytes, trying `msgpack` or `bincode` formats.
- * @note Ignores the Brillig parts of the bytecode when using `msgpack`.
+ * @brief Reads msgpack data one value at a time
+ * @details Container headers are read directly, so that the elements of large arrays and maps (opcodes, witnesses) can
+ * be unpacked, converted and dropped one at a time instead of unpacking the whole buffer into one msgpack object tree
+ * and then converting all of it. Elements are unpacked into a single zone which is reused, so the memory needed is
+ * bounded by the largest element rather than by the buffer.
  */
-Acir::Program deserialize_program(std::vector<uint8_t>&& buf)
-{
-    return deserialize_any_format<Acir::Program>(
-        std::move(buf),
-        [](auto o) -> Acir::Program {
-            Acir::Program program;
-            try {
-                // Deserialize into a partial structure that ignores the Brillig parts,
-                // so that new opcodes can be added without breaking Barretenberg.
-                Acir::ProgramWithoutBrillig program_wob;
-                o.convert(program_wob);
-                program.functions = program_wob.functions;
-            } catch (const msgpack::type_error&) {
-                std::cerr << o << std::endl;
-                throw_or_abort("failed to convert msgpack data to Program");
-            }
-            return program;
-        },
-        &Acir::Program::bincodeDeserialize);
-}
+class MsgpackReader {
+  public:
+    MsgpackReader(const char* data, size_t size)
+        : data_(data)
+        , size_(size)
+    {}
+
+    uint32_t read_map_size() { return read_container_size(0x80, 0xde, 0xdf, "map"); }
+    uint32_t read_array_size() { return read_container_size(0x90, 0xdc, 0xdd, "array"); }
+
+    template <typename T> void read(T& value, const char* struct_name, const char* field_name)
+    {
+        zone_.clear();
+        msgpack::object o = msgpack::unpack(zone_, data_, size_, offset_);
+        try {
+            o.convert(value);
+        } catch (const msgpack::type_error&) {
+            std::cerr << o << std::endl;
+            throw_or_abort(std::string("error converting into field ") + struct_name + "::" + field_name);
+        }
+    }
 
-/**
- * @brief Deserializes a `WitnessStack` from bytes, trying `msgpack` or `bincode` formats.
- */
-Witnesses::WitnessStack deserialize_witness_stack(std::vector<uint8_t>&& buf)
-{
-    return deserialize_any_format<Witnesses::WitnessStack>(
-        std::move(buf),
-        [](auto o) {
-            Witnesses::WitnessStack witness_stack;
-            try {
-                o.convert(witness_stack);
-            } catch (const msgpack::type_error&) {
-                std::cerr << o << std::endl;
-                throw_or_abort("failed to convert msgpack data to WitnessStack");
-            }
-            return witness_stack;
-        },
-        &Witnesses::WitnessStack::bincodeDeserialize);
-}
+    std::string read_key(const char* struct_name)
+    {
+        std::string key;
+        read(key, struct_name, "<key>");
+        return key;
+    }
+
+    void skip()
+    {
+        msgpack::null_visitor visitor;
+        if (!msgpack::parse(data_, size_, offset_, visitor)) {
+            throw_or_abort("truncated msgpack data");
+        }
+    }
+
+  private:
+    const char* data_;
+    size_t size_;
+    size_t offset_ = 0;
+    msgpack::zone zone_;
+
+    uint8_t read_byte()
+    {
+        if (offset_ >= size_) {
+            throw_or_abort("truncated msgpack data");
+        }
+        return static_cast<uint8_t>(data_[offset_++]);
+    }
+
+    uint32_t read_container_size(uint8_t fix_tag, uint8_t tag_16, uint8_t tag_32, std::string const& type)
+    {
+        const uint8_t tag = read_byte();
+        if ((tag & 0xf0) == fix_tag) {
+            return static_cast<uint32_t>(tag & 0x0f);
+        }
+        if (tag != tag_16 && tag != tag_32) {
+            throw_or_abort("expected msgpack " + type);
+        }
+        // Big-endian length
+        const size_t num_bytes = tag == tag_16 ? 2 : 4;
+        uint32_t size = 0;
+        for (size_t i = 0; i < num_bytes; ++i) {
+            size = (size << 8) | read_byte();
+        }
+        return size;
+    }
+};
 
 /**
  * @brief Construct a poly_tuple for a standard width-3 arithmetic gate from its acir representation
@@ -918,19 +943,27 @@ void handle_memory_op(Acir::Opcode::MemoryOp const& mem_op, AcirFormat& af, Bloc
     block.trace.push_back(acir_mem_op);
 }
 
-AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
-{
-    AcirFormat af;
-    // `varnum` is the true number of variables, thus we add one to the index which starts at zero
-    af.varnum = circuit.current_witness_index + 1;
-    af.num_acir_opcodes = static_cast<uint32_t>(circuit.opcodes.size());
-    af.public_inputs = join({ transform::map(circuit.public_parameters.value, [](auto e) { return e.value; }),
-                              transform::map(circuit.return_values.value, [](auto e) { return e.value; }) });
-    // Map to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
-    // NOTE: We want to deterministically visit this map, so unordered_map should not be used.
-    std::map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>> block_id_to_block_constraint;
-    for (size_t i = 0; i < circuit.opcodes.size(); ++i) {
-        const auto& gate = circuit.opcodes[i];
+/**
+ * @brief Collects the constraints of a circuit one opcode at a time
+ * @details Lets the deserializers hand over each opcode as soon as it is parsed and drop it afterwards, rather than
+ * materializing the whole `Acir::Circuit` first.
+ */
+class AcirFormatBuilder {
+  public:
+    void set_current_witness_index(uint32_t current_witness_index)
+    {
+        // `varnum` is the true number of variables, thus we add one to the index which starts at zero
+        af.varnum = current_witness_index + 1;
+    }
+    void set_public_parameters(Acir::PublicInputs&& public_parameters)
+    {
+        public_parameters_ = std::move(public_parameters);
+    }
+    void set_return_values(Acir::PublicInputs&& return_values) { return_values_ = std::move(return_values); }
+
+    void add_opcode(Acir::Opcode const& opcode)
+    {
+        const size_t i = num_opcodes++;
         std::visit(
             [&](auto&& arg) {
                 using T = std::decay_t<decltype(arg)>;
@@ -951,17 +984,166 @@ AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
                     block->second.second.push_back(i);
                 }
             },
-            gate.value);
+            opcode.value);
+    }
+
+    AcirFormat finalize() &&
+    {
+        af.num_acir_opcodes = static_cast<uint32_t>(num_opcodes);
+        af.public_inputs = join({ transform::map(public_parameters_.value, [](auto e) { return e.value; }),
+                                  transform::map(return_values_.value, [](auto e) { return e.value; }) });
+        for (auto& [block_id, block] : block_id_to_block_constraint) {
+            // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
+            if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData ||
+                block.first.type == BlockType::CallData) {
+                af.block_constraints.push_back(std::move(block.first));
+                af.original_opcode_indices.block_constraints.push_back(std::move(block.second));
+            }
+        }
+        return std::move(af);
+    }
+
+  private:
+    AcirFormat af;
+    size_t num_opcodes = 0;
+    Acir::PublicInputs public_parameters_;
+    Acir::PublicInputs return_values_;
+    // Map to a pair of: BlockConstraint, and list of opcodes associated with that BlockConstraint
+    // NOTE: We want to deterministically visit this map, so unordered_map should not be used.
+    std::map<uint32_t, std::pair<BlockConstraint, std::vector<size_t>>> block_id_to_block_constraint;
+};
+
+AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit)
+{
+    AcirFormatBuilder builder;
+    builder.set_current_witness_index(circuit.current_witness_index);
+    builder.set_public_parameters(Acir::PublicInputs(circuit.public_parameters));
+    builder.set_return_values(Acir::PublicInputs(circuit.return_values));
+    for (const auto& opcode : circuit.opcodes) {
+        builder.add_opcode(opcode);
+    }
+    return std::move(builder).finalize();
+}
+
+/**
+ * @brief Streams a msgpack `Acir::Circuit` into its constraints
+ * @note Ignores the fields that do not affect the constraints (e.g. assert messages) without converting them.
+ */
+AcirFormat read_msgpack_circuit(MsgpackReader& reader)
+{
+    const char* name = "Circuit";
+    AcirFormatBuilder builder;
+    std::set<std::string> fields;
+    const uint32_t num_fields = reader.read_map_size();
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        const std::string key = reader.read_key(name);
+        fields.insert(key);
+        if (key == "current_witness_index") {
+            uint32_t current_witness_index = 0;
+            reader.read(current_witness_index, name, "current_witness_index");
+            builder.set_current_witness_index(current_witness_index);
+        } else if (key == "opcodes") {
+            const uint32_t num_opcodes = reader.read_array_size();
+            for (uint32_t j = 0; j < num_opcodes; ++j) {
+                Acir::Opcode opcode;
+                reader.read(opcode, name, "opcodes");
+                builder.add_opcode(opcode);
+            }
+        } else if (key == "public_parameters" || key == "return_values") {
+            Acir::PublicInputs inputs;
+            reader.read(inputs, name, key.c_str());
+            if (key == "public_parameters") {
+                builder.set_public_parameters(std::move(inputs));
+            } else {
+                builder.set_return_values(std::move(inputs));
+            }
+        } else {
+            reader.skip();
+        }
+    }
+    for (const auto* field : { "current_witness_index", "opcodes", "public_parameters", "return_values" }) {
+        if (!fields.contains(field)) {
+            throw_or_abort(std::string("missing field: ") + name + "::" + field);
+        }
     }
-    for (const auto& [block_id, block] : block_id_to_block_constraint) {
-        // Note: the trace will always be empty for ReturnData since it cannot be explicitly read from in noir
-        if (!block.first.trace.empty() || block.first.type == BlockType::ReturnData ||
-            block.first.type == BlockType::CallData) {
-            af.block_constraints.push_back(block.first);
-            af.original_opcode_indices.block_constraints.push_back(block.second);
+    return std::move(builder).finalize();
+}
+
+/**
+ * @brief Streams a bincode `Acir::Circuit` into its constraints, mirroring `Deserializable<Acir::Circuit>`
+ */
+AcirFormat read_bincode_circuit(serde::BincodeDeserializer& deserializer)
+{
+    deserializer.increase_container_depth();
+    AcirFormatBuilder builder;
+    builder.set_current_witness_index(serde::Deserializable<uint32_t>::deserialize(deserializer));
+    const size_t num_opcodes = deserializer.deserialize_len();
+    for (size_t i = 0; i < num_opcodes; ++i) {
+        builder.add_opcode(serde::Deserializable<Acir::Opcode>::deserialize(deserializer));
+    }
+    serde::Deserializable<Acir::ExpressionWidth>::deserialize(deserializer);
+    serde::Deserializable<std::vector<Acir::Witness>>::deserialize(deserializer);
+    builder.set_public_parameters(serde::Deserializable<Acir::PublicInputs>::deserialize(deserializer));
+    builder.set_return_values(serde::Deserializable<Acir::PublicInputs>::deserialize(deserializer));
+    serde::Deserializable<decltype(Acir::Circuit::assert_messages)>::deserialize(deserializer);
+    deserializer.decrease_container_depth();
+    return std::move(builder).finalize();
+}
+
+/**
+ * @brief Converts the first `max_functions` functions of a serialized `Acir::Program` into constraint systems
+ * @details The program is streamed: each opcode is converted into constraints as soon as it is deserialized and then
+ * dropped, so the peak memory is the bytecode plus the constraints rather than several copies of the whole program in
+ * its intermediate representations. Brillig functions are skipped without being deserialized when using `msgpack`.
+ */
+std::vector<AcirFormat> program_buf_to_acir_formats(std::vector<uint8_t>&& buf, size_t max_functions)
+{
+    std::vector<AcirFormat> constraint_systems;
+    if (is_msgpack_format(buf)) {
+        // Skip the format marker to get the data.
+        MsgpackReader reader(&reinterpret_cast<const char*>(buf.data())[1], buf.size() - 1);
+        bool has_functions = false;
+        const uint32_t num_fields = reader.read_map_size();
+        for (uint32_t i = 0; i < num_fields; ++i) {
+            if (reader.read_key("Program") != "functions") {
+                reader.skip();
+                continue;
+            }
+            has_functions = true;
+            const uint32_t num_functions = reader.read_array_size();
+            constraint_systems.reserve(std::min(static_cast<size_t>(num_functions), max_functions));
+            for (uint32_t j = 0; j < num_functions; ++j) {
+                if (constraint_systems.size() < max_functions) {
+                    constraint_systems.push_back(read_msgpack_circuit(reader));
+                } else {
+                    reader.skip();
+                }
+            }
         }
+        if (!has_functions) {
+            throw_or_abort("missing field: Program::functions");
+        }
+        return constraint_systems;
+    }
+
+    const size_t input_size = buf.size();
+    serde::BincodeDeserializer deserializer(std::move(buf));
+    deserializer.increase_container_depth();
+    const size_t num_functions = deserializer.deserialize_len();
+    constraint_systems.reserve(std::min(num_functions, max_functions));
+    for (size_t i = 0; i < num_functions; ++i) {
+        if (constraint_systems.size() == max_functions) {
+            // Bincode can't be skipped without decoding it, and nothing after this is needed
+            return constraint_systems;
+        }
+        constraint_systems.push_back(read_bincode_circuit(deserializer));
     }
-    return af;
+    serde::Deserializable<decltype(Acir::Program::unconstrained_functions)>::deserialize(deserializer);
+    deserializer.decrease_container_depth();
+    if (deserializer.get_buffer_offset() < input_size) {
+        throw_or_abort("Some input bytes were not read");
+    }
+    return constraint_systems;
 }
 
 AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
@@ -969,10 +1151,11 @@ AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/927): Move to using just
     // `program_buf_to_acir_format` once Honk fully supports all ACIR test flows For now the backend still expects
     // to work with a single ACIR function
-    auto program = deserialize_program(std::move(buf));
-    auto circuit = program.functions[0];
-
-    return circuit_serde_to_acir_format(circuit);
+    auto constraint_systems = program_buf_to_acir_formats(std::move(buf), /*max_functions=*/1);
+    if (constraint_systems.empty()) {
+        throw_or_abort("program has no functions");
+    }
+    return std::move(constraint_systems[0]);
 }
 
 /**
@@ -986,6 +1169,9 @@ AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf)
 WitnessVector witness_map_to_witness_vector(Witnesses::WitnessMap const& witness_map)
 {
     WitnessVector wv;
+    if (!witness_map.value.empty()) {
+        wv.reserve(witness_map.value.rbegin()->first.value + 1UL);
+    }
     size_t index = 0;
     for (const auto& e : witness_map.value) {
         // ACIR uses a sparse format for WitnessMap where unused witness indices may be left unassigned.
@@ -1001,39 +1187,111 @@ WitnessVector witness_map_to_witness_vector(Witnesses::WitnessMap const& witness
     return wv;
 }
 
+/**
+ * @brief Streams a msgpack `WitnessMap` into a `WitnessVector` without building the intermediate `std::map`
+ * @note As in `witness_map_to_witness_vector`, unassigned witnesses are set to zero.
+ */
+WitnessVector read_msgpack_witness_map(MsgpackReader& reader)
+{
+    WitnessVector wv;
+    const uint32_t num_witnesses = reader.read_map_size();
+    wv.reserve(num_witnesses);
+    for (uint32_t i = 0; i < num_witnesses; ++i) {
+        Witnesses::Witness witness;
+        std::string value;
+        reader.read(witness, "WitnessMap", "<key>");
+        reader.read(value, "WitnessMap", "<value>");
+        if (witness.value >= wv.size()) {
+            wv.resize(witness.value + 1UL, fr::zero());
+        }
+        wv[witness.value] = fr(uint256_t(value));
+    }
+    return wv;
+}
+
+/**
+ * @brief Streams the items of a serialized `WitnessStack`, converting those accepted by `wanted`
+ */
+WitnessVectorStack read_witness_stack(std::vector<uint8_t>&& buf, const std::function<bool(size_t, size_t)>& wanted)
+{
+    WitnessVectorStack witness_vector_stack;
+    if (!is_msgpack_format(buf)) {
+        auto witness_stack = Witnesses::WitnessStack::bincodeDeserialize(std::move(buf));
+        for (size_t i = 0; i < witness_stack.stack.size(); ++i) {
+            if (wanted(i, witness_stack.stack.size())) {
+                auto& stack_item = witness_stack.stack[i];
+                witness_vector_stack.emplace_back(stack_item.index, witness_map_to_witness_vector(stack_item.witness));
+                // Release each map once converted
+                stack_item.witness = {};
+            }
+        }
+        return witness_vector_stack;
+    }
+
+    // Skip the format marker to get the data.
+    MsgpackReader reader(&reinterpret_cast<const char*>(buf.data())[1], buf.size() - 1);
+    bool has_stack = false;
+    const uint32_t num_fields = reader.read_map_size();
+    for (uint32_t i = 0; i < num_fields; ++i) {
+        if (reader.read_key("WitnessStack") != "stack") {
+            reader.skip();
+            continue;
+        }
+        has_stack = true;
+        const uint32_t num_items = reader.read_array_size();
+        for (uint32_t j = 0; j < num_items; ++j) {
+            if (!wanted(j, num_items)) {
+                reader.skip();
+                continue;
+            }
+            const char* name = "StackItem";
+            std::optional<uint32_t> index;
+            std::optional<WitnessVector> witness;
+            const uint32_t num_item_fields = reader.read_map_size();
+            for (uint32_t k = 0; k < num_item_fields; ++k) {
+                const std::string key = reader.read_key(name);
+                if (key == "index") {
+                    index.emplace();
+                    reader.read(*index, name, "index");
+                } else if (key == "witness") {
+                    witness = read_msgpack_witness_map(reader);
+                } else {
+                    reader.skip();
+                }
+            }
+            if (!index.has_value() || !witness.has_value()) {
+                throw_or_abort(std::string("missing field: ") + name + (index.has_value() ? "::witness" : "::index"));
+            }
+            witness_vector_stack.emplace_back(*index, std::move(*witness));
+        }
+    }
+    if (!has_stack) {
+        throw_or_abort("missing field: WitnessStack::stack");
+    }
+    return witness_vector_stack;
+}
+
 WitnessVector witness_buf_to_witness_data(std::vector<uint8_t>&& buf)
 {
     // TODO(https://github.com/AztecProtocol/barretenberg/issues/927): Move to using just
     // `witness_buf_to_witness_stack` once Honk fully supports all ACIR test flows. For now the backend still
     // expects to work with the stop of the `WitnessStack`.
-    auto witness_stack = deserialize_witness_stack(std::move(buf));
-    auto w = witness_stack.stack[witness_stack.stack.size() - 1].witness;
-
-    return witness_map_to_witness_vector(w);
+    auto witness_stack =
+        read_witness_stack(std::move(buf), [](size_t index, size_t stack_size) { return index + 1 == stack_size; });
+    if (witness_stack.empty()) {
+        throw_or_abort("empty WitnessStack");
+    }
+    return std::move(witness_stack.back().second);
 }
 
 std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t>&& buf)
 {
-    auto program = deserialize_program(std::move(buf));
-
-    std::vector<AcirFormat> constraint_systems;
-    constraint_systems.reserve(program.functions.size());
-    for (auto const& function : program.functions) {
-        constraint_systems.emplace_back(circuit_serde_to_acir_format(function));
-    }
-
-    return constraint_systems;
+    return program_buf_to_acir_formats(std::move(buf), std::numeric_limits<size_t>::max());
 }
 
 WitnessVectorStack witness_buf_to_witness_stack(std::vector<uint8_t>&& buf)
 {
-    auto witness_stack = deserialize_witness_stack(std::move(buf));
-    WitnessVectorStack witness_vector_stack;
-    witness_vector_stack.reserve(witness_stack.stack.size());
-    for (auto const& stack_item : witness_stack.stack) {
-        witness_vector_stack.emplace_back(stack_item.index, witness_map_to_witness_vector(stack_item.witness));
-    }
-    return witness_vector_stack;
+    return read_witness_stack(std::move(buf), [](size_t, size_t) { return true; });
 }
 
 AcirProgramStack get_acir_program_stack(std::string const& bytecode_path, std::string const& witness_path)
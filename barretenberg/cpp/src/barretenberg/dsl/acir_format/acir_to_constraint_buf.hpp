@@ -20,8 +20,18 @@ namespace acir_format {
  */
 WitnessVector witness_buf_to_witness_data(std::vector<uint8_t>&& buf);
 
+/**
+ * @brief Converts the first function of a serialized `Acir::Program` into a constraint system.
+ * @details The bytecode is streamed: opcodes are converted one at a time and dropped once their constraints are
+ * collected, instead of deserializing the whole program first.
+ */
 AcirFormat circuit_buf_to_acir_format(std::vector<uint8_t>&& buf);
 
+/**
+ * @brief Converts an already deserialized `Acir::Circuit` into a constraint system.
+ */
+AcirFormat circuit_serde_to_acir_format(Acir::Circuit const& circuit);
+
 std::vector<AcirFormat> program_buf_to_acir_format(std::vector<uint8_t>&& buf);
 
 WitnessVectorStack witness_buf_to_witness_stack(std::vector<uint8_t>&& buf);
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "acir_to_constraint_buf.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+
+using namespace acir_format;
+
+namespace {
+
+const std::string ZERO = "0000000000000000000000000000000000000000000000000000000000000000";
+const std::string ONE = "0000000000000000000000000000000000000000000000000000000000000001";
+const std::string MINUS_ONE = "30644e72e131a029b85045b68181585d2833e84879b9709143e1f593f0000000";
+
+Acir::Expression linear(uint32_t witness)
+{
+    return { .mul_terms = {}, .linear_combinations = { { ONE, Acir::Witness{ witness } } }, .q_c = ZERO };
+}
+
+/**
+ * @brief A circuit with arithmetic and memory opcodes: w0 * w1 = w2 and w3 = [w0, w1][w4]
+ */
+Acir::Circuit create_circuit(uint32_t num_arithmetic_opcodes)
+{
+    Acir::Circuit circuit;
+    for (uint32_t i = 0; i < num_arithmetic_opcodes; ++i) {
+        Acir::Expression expr{ .mul_terms = { { ONE, Acir::Witness{ 0 }, Acir::Witness{ 1 } } },
+                               .linear_combinations = { { MINUS_ONE, Acir::Witness{ 2 } } },
+                               .q_c = ZERO };
+        circuit.opcodes.push_back(Acir::Opcode{ Acir::Opcode::AssertZero{ expr } });
+    }
+    circuit.opcodes.push_back(Acir::Opcode{ Acir::Opcode::MemoryInit{
+        .block_id = { 0 },
+        .init = { Acir::Witness{ 0 }, Acir::Witness{ 1 } },
+        .block_type = { Acir::BlockType::Memory{} },
+    } });
+    circuit.opcodes.push_back(Acir::Opcode{ Acir::Opcode::MemoryOp{
+        .block_id = { 0 },
+        .op = { .operation = { .mul_terms = {}, .linear_combinations = {}, .q_c = ZERO },
+                .index = linear(4),
+                .value = linear(3) },
+        .predicate = std::nullopt,
+    } });
+    circuit.current_witness_index = 4;
+    circuit.expression_width = Acir::ExpressionWidth{ Acir::ExpressionWidth::Unbounded{} };
+    circuit.public_parameters = Acir::PublicInputs{ { Acir::Witness{ 0 } } };
+    circuit.return_values = Acir::PublicInputs{ { Acir::Witness{ 2 } } };
+    return circuit;
+}
+
+template <typename T> std::vector<uint8_t> msgpack_serialize(const T& value)
+{
+    msgpack::sbuffer buffer;
+    // Format marker for msgpack
+    const char format = 2;
+    buffer.write(&format, 1);
+    msgpack::pack(buffer, value);
+    return { buffer.data(), buffer.data() + buffer.size() };
+}
+
+} // namespace
+
+TEST(AcirToConstraintBuf, StreamedProgramMatchesDeserializedCircuit)
+{
+    Acir::Program program;
+    program.functions = { create_circuit(10), create_circuit(3) };
+    // Skipped without being deserialized
+    program.unconstrained_functions = { Acir::BrilligBytecode{} };
+
+    for (auto bytecode : { msgpack_serialize(program), program.bincodeSerialize() }) {
+        const AcirFormat expected = circuit_serde_to_acir_format(program.functions[0]);
+        EXPECT_EQ(expected.num_acir_opcodes, 12U);
+        EXPECT_EQ(expected.block_constraints.size(), 1UL);
+        EXPECT_EQ(circuit_buf_to_acir_format(std::vector<uint8_t>(bytecode)), expected);
+
+        const std::vector<AcirFormat> functions = program_buf_to_acir_format(std::move(bytecode));
+        ASSERT_EQ(functions.size(), 2UL);
+        EXPECT_EQ(functions[0], expected);
+        EXPECT_EQ(functions[1], circuit_serde_to_acir_format(program.functions[1]));
+    }
+}
+
+TEST(AcirToConstraintBuf, StreamedWitnessMatchesWitnessMap)
+{
+    Witnesses::WitnessStack witness_stack;
+    witness_stack.stack.push_back({ .index = 1, .witness = { { { Witnesses::Witness{ 0 }, ONE } } } });
+    // Sparse, the missing witnesses are zero
+    witness_stack.stack.push_back({ .index = 0,
+                                    .witness = { { { Witnesses::Witness{ 1 }, ONE },
+                                                   { Witnesses::Witness{ 4 }, MINUS_ONE },
+                                                   { Witnesses::Witness{ 2 }, ONE } } } });
+    const WitnessVector expected{ 0, 1, 1, 0, -1 };
+
+    for (auto witness : { msgpack_serialize(witness_stack), witness_stack.bincodeSerialize() }) {
+        EXPECT_EQ(witness_buf_to_witness_data(std::vector<uint8_t>(witness)), expected);
+
+        const WitnessVectorStack stack = witness_buf_to_witness_stack(std::move(witness));
+        ASSERT_EQ(stack.size(), 2UL);
+        EXPECT_EQ(stack[0].first, 1U);
+        EXPECT_EQ(stack[0].second, WitnessVector{ 1 });
+        EXPECT_EQ(stack[1].first, 0U);
+        EXPECT_EQ(stack[1].second, expected);
+    }
+}
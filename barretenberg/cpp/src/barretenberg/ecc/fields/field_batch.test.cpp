@@ -0,0 +1,137 @@
+#include "barretenberg/ecc/curves/bn254/fq.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/ecc/curves/secp256k1/secp256k1.hpp"
+#include "barretenberg/ecc/fields/field_batch_simd.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+} // namespace
+
+template <class Field> class FieldBatchTest : public ::testing::Test {
+  public:
+    // Not a multiple of any lane width, so that the scalar tail is exercised too
+    static constexpr size_t num_elements = 203;
+
+    static std::vector<Field> random_elements()
+    {
+        std::vector<Field> result(num_elements);
+        for (auto& x : result) {
+            x = Field::random_element(&engine);
+        }
+        // Edge cases: 0, -1 and, where the coarse representation allows it, the largest value in [0, 2p)
+        result[0] = Field::zero();
+        result[1] = Field::neg_one();
+        if constexpr (field_simd::supports_batch_simd<typename Field::Params>) {
+            result[2] = Field{ Field::twice_modulus.data[0] - 1,
+                               Field::twice_modulus.data[1],
+                               Field::twice_modulus.data[2],
+                               Field::twice_modulus.data[3] };
+        }
+        return result;
+    }
+
+    /**
+     * @brief Run `test` once per ISA supported by this CPU
+     */
+    template <typename Test> static void for_each_isa(Test test)
+    {
+        const field_simd::Isa original_isa = field_simd::get_isa();
+        for (auto isa : { field_simd::Isa::Scalar, field_simd::Isa::AVX2, field_simd::Isa::AVX512IFMA }) {
+            if (!field_simd::set_isa(isa)) {
+                continue;
+            }
+            SCOPED_TRACE(field_simd::get_isa_name(isa));
+            test();
+        }
+        field_simd::set_isa(original_isa);
+    }
+};
+
+using FieldTypes = ::testing::Types<bb::fr, bb::fq, bb::secp256k1::fq>;
+TYPED_TEST_SUITE(FieldBatchTest, FieldTypes);
+
+TYPED_TEST(FieldBatchTest, AddSub)
+{
+    using Field = TypeParam;
+    const auto a = TestFixture::random_elements();
+    const auto b = TestFixture::random_elements();
+    TestFixture::for_each_isa([&]() {
+        std::vector<Field> sum(a.size());
+        std::vector<Field> difference(a.size());
+        Field::batch_add(a, b, sum);
+        Field::batch_sub(a, b, difference);
+        for (size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(sum[i], a[i] + b[i]);
+            EXPECT_EQ(difference[i], a[i] - b[i]);
+        }
+    });
+}
+
+TYPED_TEST(FieldBatchTest, MulSqr)
+{
+    using Field = TypeParam;
+    const auto a = TestFixture::random_elements();
+    const auto b = TestFixture::random_elements();
+    const Field scalar = Field::random_element(&engine);
+    TestFixture::for_each_isa([&]() {
+        std::vector<Field> product(a.size());
+        std::vector<Field> scaled(a.size());
+        std::vector<Field> square(a.size());
+        Field::batch_mul(a, b, product);
+        Field::batch_mul(a, scalar, scaled);
+        Field::batch_sqr(a, square);
+        for (size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(product[i], a[i] * b[i]);
+            EXPECT_EQ(scaled[i], a[i] * scalar);
+            EXPECT_EQ(square[i], a[i].sqr());
+        }
+    });
+}
+
+TYPED_TEST(FieldBatchTest, FmaInPlace)
+{
+    using Field = TypeParam;
+    const auto a = TestFixture::random_elements();
+    const auto b = TestFixture::random_elements();
+    const auto c = TestFixture::random_elements();
+    const Field scalar = Field::random_element(&engine);
+    TestFixture::for_each_isa([&]() {
+        // out aliases c
+        auto fma = c;
+        auto scaled_fma = c;
+        Field::batch_fma(a, b, fma, fma);
+        Field::batch_fma(a, scalar, scaled_fma, scaled_fma);
+        for (size_t i = 0; i < a.size(); ++i) {
+            EXPECT_EQ(fma[i], a[i] * b[i] + c[i]);
+            EXPECT_EQ(scaled_fma[i], a[i] * scalar + c[i]);
+        }
+    });
+}
+
+TYPED_TEST(FieldBatchTest, OutputsAreCoarselyReduced)
+{
+    using Field = TypeParam;
+    if constexpr (!field_simd::supports_batch_simd<typename Field::Params>) {
+        GTEST_SKIP() << "2p does not fit in 256 bits";
+    }
+    const auto a = TestFixture::random_elements();
+    const auto b = TestFixture::random_elements();
+    TestFixture::for_each_isa([&]() {
+        std::vector<Field> out(a.size());
+        for (auto op : { &Field::batch_add, &Field::batch_sub }) {
+            op(a, b, out);
+            for (const auto& x : out) {
+                EXPECT_LT(uint256_t(x.data[0], x.data[1], x.data[2], x.data[3]), Field::twice_modulus);
+            }
+        }
+        Field::batch_mul(a, b, out);
+        for (const auto& x : out) {
+            EXPECT_LT(uint256_t(x.data[0], x.data[1], x.data[2], x.data[3]), Field::twice_modulus);
+        }
+    });
+}
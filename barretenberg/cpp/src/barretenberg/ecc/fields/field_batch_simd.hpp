@@ -0,0 +1,612 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+
+/**
+ * @brief Multi-lane kernels behind `field::batch_add`, `batch_sub`, `batch_mul`, `batch_sqr` and `batch_fma`
+ * @details The scalar field arithmetic (field_impl_x64.hpp) operates on one element at a time using 4x64-bit limbs and
+ * mulx/adx. For bulk element-wise work we instead transpose a block of elements into a structure-of-arrays layout
+ * with small limbs, so that every SIMD lane holds one element:
+ *
+ *          AVX-512 IFMA: 8 lanes, 5 x 52-bit limbs, vpmadd52{lo,hi}uq for the 52x52-bit partial products
+ *          AVX2:         4 lanes, 9 x 29-bit limbs, vpmuludq for the 29x29-bit partial products
+ *
+ *          Both kernels compute the Montgomery product with respect to the same R = 2^256 as the scalar code (the final
+ *          reduction round uses a shortened digit), so their inputs and outputs are ordinary field elements. As for the
+ *          scalar asm path, outputs are coarsely reduced into [0, 2p).
+ *
+ *          The kernels are only used for fields with a modulus < 2^254 (i.e. the fields that use the coarse asm path),
+ *          on x86-64 when assembly is enabled. The kernel is selected at runtime via CPUID (see `get_default_isa`).
+ *          Each `batch_simd` call returns the number of leading elements it processed; the caller finishes the
+ *          remainder with scalar ops.
+ */
+
+#include "barretenberg/ecc/fields/field_declarations.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__x86_64__) && !defined(__wasm__) && (BBERG_NO_ASM == 0)
+#define BB_FIELD_SIMD 1
+#include <immintrin.h>
+#define BB_TARGET_AVX512IFMA __attribute__((target("avx512f,avx512ifma"), always_inline)) inline
+#define BB_TARGET_AVX512IFMA_NOINLINE __attribute__((target("avx512f,avx512ifma"), noinline))
+#define BB_TARGET_AVX2 __attribute__((target("avx2"), always_inline)) inline
+#define BB_TARGET_AVX2_NOINLINE __attribute__((target("avx2"), noinline))
+#endif
+
+namespace bb::field_simd {
+
+// Ordered: a machine supporting an ISA supports every ISA before it
+enum class Isa : uint8_t { Scalar = 0, AVX2 = 1, AVX512IFMA = 2 };
+
+enum class BatchOp : uint8_t {
+    Add,          // out = a + b
+    Sub,          // out = a - b
+    Mul,          // out = a * b
+    MulBroadcast, // out = a * b[0]
+    Fma,          // out = a * b + c
+    FmaBroadcast  // out = a * b[0] + c
+};
+
+inline const char* get_isa_name(const Isa isa) noexcept
+{
+    switch (isa) {
+    case Isa::AVX512IFMA:
+        return "avx512ifma";
+    case Isa::AVX2:
+        return "avx2";
+    default:
+        return "scalar";
+    }
+}
+
+/**
+ * @brief The best ISA the kernels were compiled for and the CPU supports
+ */
+inline Isa get_supported_isa() noexcept
+{
+    static const Isa supported = [] {
+#ifdef BB_FIELD_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma")) {
+            return Isa::AVX512IFMA;
+        }
+        if (__builtin_cpu_supports("avx2")) {
+            return Isa::AVX2;
+        }
+#endif
+        return Isa::Scalar;
+    }();
+    return supported;
+}
+
+/**
+ * @brief The ISA the batch operations use unless overridden with `set_isa`
+ * @details The AVX2 kernel is not selected by default: without a 52-bit multiplier it needs ~4x as many partial
+ * products as the scalar mulx code and measures ~2.5x slower per multiplication (see basics_bench `ff_batch_*`).
+ * It is kept for benchmarking and as a cross-check of the limb arithmetic.
+ */
+inline Isa get_default_isa() noexcept
+{
+    return get_supported_isa() == Isa::AVX512IFMA ? Isa::AVX512IFMA : Isa::Scalar;
+}
+
+inline std::atomic<Isa>& get_active_isa() noexcept
+{
+    static std::atomic<Isa> active_isa{ get_default_isa() };
+    return active_isa;
+}
+
+inline Isa get_isa() noexcept
+{
+    return get_active_isa().load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Restrict the batch kernels to `isa` (used by tests and benchmarks to compare implementations)
+ * @return false (and no change) if the CPU does not support `isa`
+ */
+inline bool set_isa(const Isa isa) noexcept
+{
+    if (isa > get_supported_isa()) {
+        return false;
+    }
+    get_active_isa().store(isa, std::memory_order_relaxed);
+    return true;
+}
+
+template <class Params>
+constexpr bool supports_batch_simd = (Params::modulus_3 < 0x4000000000000000ULL) &&
+                                     !(Params::modulus_1 == 0 && Params::modulus_2 == 0 && Params::modulus_3 == 0);
+
+#ifdef BB_FIELD_SIMD
+
+// GCC 12 reports the _mm512_undefined_epi32() passthrough operand inside the AVX-512 shift intrinsics as uninitialized
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+/**
+ * @brief Split a 256-bit integer (4 x 64-bit words) into NUM_LIMBS limbs of LIMB_BITS bits
+ */
+template <size_t NUM_LIMBS, size_t LIMB_BITS>
+constexpr std::array<uint64_t, NUM_LIMBS> split_into_limbs(const std::array<uint64_t, 4>& words)
+{
+    std::array<uint64_t, NUM_LIMBS> limbs{};
+    for (size_t i = 0; i < NUM_LIMBS; ++i) {
+        const size_t lo_bit = i * LIMB_BITS;
+        const size_t word = lo_bit / 64;
+        const size_t shift = lo_bit % 64;
+        uint64_t limb = words[word] >> shift;
+        if (shift + LIMB_BITS > 64 && word + 1 < 4) {
+            limb |= words[word + 1] << (64 - shift);
+        }
+        limbs[i] = limb & ((1ULL << LIMB_BITS) - 1);
+    }
+    return limbs;
+}
+
+template <class Params> constexpr std::array<uint64_t, 4> get_modulus_words()
+{
+    return { Params::modulus_0, Params::modulus_1, Params::modulus_2, Params::modulus_3 };
+}
+
+template <class Params> constexpr std::array<uint64_t, 4> get_twice_modulus_words()
+{
+    return { Params::modulus_0 << 1,
+             (Params::modulus_1 << 1) | (Params::modulus_0 >> 63),
+             (Params::modulus_2 << 1) | (Params::modulus_1 >> 63),
+             (Params::modulus_3 << 1) | (Params::modulus_2 >> 63) };
+}
+
+/**
+ * @brief 8-lane kernels using 5 x 52-bit limbs
+ */
+template <class Params> struct Avx512IfmaKernels {
+    using Vec = __m512i;
+    static constexpr size_t LANES = 8;
+    static constexpr size_t NUM_LIMBS = 5;
+    static constexpr size_t LIMB_BITS = 52;
+    static constexpr uint64_t LIMB_MASK = (1ULL << LIMB_BITS) - 1;
+    // 256 = 4 * 52 + 48: the last Montgomery reduction round uses a 48-bit digit
+    static constexpr size_t FINAL_ROUND_BITS = 256 - (NUM_LIMBS - 1) * LIMB_BITS;
+
+    static constexpr auto modulus = split_into_limbs<NUM_LIMBS, LIMB_BITS>(get_modulus_words<Params>());
+    static constexpr auto twice_modulus = split_into_limbs<NUM_LIMBS, LIMB_BITS>(get_twice_modulus_words<Params>());
+
+    BB_TARGET_AVX512IFMA static Vec broadcast(const uint64_t x) { return _mm512_set1_epi64(static_cast<long long>(x)); }
+
+    // Load 8 consecutive elements and transpose them into limb-major order
+    BB_TARGET_AVX512IFMA static void load(const uint64_t* src, Vec (&out)[NUM_LIMBS])
+    {
+        const Vec r0 = _mm512_loadu_si512(src);
+        const Vec r1 = _mm512_loadu_si512(src + 8);
+        const Vec r2 = _mm512_loadu_si512(src + 16);
+        const Vec r3 = _mm512_loadu_si512(src + 24);
+        const Vec even_words = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const Vec odd_words = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        const Vec lo_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+        const Vec hi_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+        const Vec t0 = _mm512_permutex2var_epi64(r0, even_words, r1);
+        const Vec t1 = _mm512_permutex2var_epi64(r0, odd_words, r1);
+        const Vec t2 = _mm512_permutex2var_epi64(r2, even_words, r3);
+        const Vec t3 = _mm512_permutex2var_epi64(r2, odd_words, r3);
+        const Vec d0 = _mm512_permutex2var_epi64(t0, lo_halves, t2);
+        const Vec d1 = _mm512_permutex2var_epi64(t0, hi_halves, t2);
+        const Vec d2 = _mm512_permutex2var_epi64(t1, lo_halves, t3);
+        const Vec d3 = _mm512_permutex2var_epi64(t1, hi_halves, t3);
+
+        const Vec mask = broadcast(LIMB_MASK);
+        out[0] = _mm512_and_si512(d0, mask);
+        out[1] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d0, 52), _mm512_slli_epi64(d1, 12)), mask);
+        out[2] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d1, 40), _mm512_slli_epi64(d2, 24)), mask);
+        out[3] = _mm512_and_si512(_mm512_or_si512(_mm512_srli_epi64(d2, 28), _mm512_slli_epi64(d3, 36)), mask);
+        out[4] = _mm512_srli_epi64(d3, 16);
+    }
+
+    // Inverse of `load`. Limbs must be normalized.
+    BB_TARGET_AVX512IFMA static void store(uint64_t* dest, const Vec (&in)[NUM_LIMBS])
+    {
+        const Vec d0 = _mm512_or_si512(in[0], _mm512_slli_epi64(in[1], 52));
+        const Vec d1 = _mm512_or_si512(_mm512_srli_epi64(in[1], 12), _mm512_slli_epi64(in[2], 40));
+        const Vec d2 = _mm512_or_si512(_mm512_srli_epi64(in[2], 24), _mm512_slli_epi64(in[3], 28));
+        const Vec d3 = _mm512_or_si512(_mm512_srli_epi64(in[3], 36), _mm512_slli_epi64(in[4], 16));
+
+        const Vec even_words = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+        const Vec odd_words = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+        const Vec lo_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+        const Vec hi_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+        const Vec t0 = _mm512_permutex2var_epi64(d0, lo_halves, d1);
+        const Vec t1 = _mm512_permutex2var_epi64(d2, lo_halves, d3);
+        const Vec t2 = _mm512_permutex2var_epi64(d0, hi_halves, d1);
+        const Vec t3 = _mm512_permutex2var_epi64(d2, hi_halves, d3);
+        _mm512_storeu_si512(dest, _mm512_permutex2var_epi64(t0, even_words, t1));
+        _mm512_storeu_si512(dest + 8, _mm512_permutex2var_epi64(t0, odd_words, t1));
+        _mm512_storeu_si512(dest + 16, _mm512_permutex2var_epi64(t2, even_words, t3));
+        _mm512_storeu_si512(dest + 24, _mm512_permutex2var_epi64(t2, odd_words, t3));
+    }
+
+    /**
+     * @brief r = a * b * 2^{-256} mod p, for a, b < 2p. The result is normalized and < 2p.
+     */
+    BB_TARGET_AVX512IFMA static void montgomery_mul(const Vec (&a)[NUM_LIMBS],
+                                                    const Vec (&b)[NUM_LIMBS],
+                                                    Vec (&r)[NUM_LIMBS])
+    {
+        const Vec zero = _mm512_setzero_si512();
+        const Vec mask = broadcast(LIMB_MASK);
+        // Column accumulators. Each receives < 32 terms of < 2^52, so cannot overflow
+        Vec t[2 * NUM_LIMBS];
+        for (auto& column : t) {
+            column = zero;
+        }
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[i + j] = _mm512_madd52lo_epu64(t[i + j], a[i], b[j]);
+                t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a[i], b[j]);
+            }
+        }
+
+        const Vec r_inv = broadcast(Params::r_inv & LIMB_MASK);
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            // m = -t * p^{-1} mod 2^52 (mod 2^48 in the final round). vpmadd52luq only reads the low 52 bits of t[k].
+            Vec m = _mm512_madd52lo_epu64(zero, t[k], r_inv);
+            if (k == NUM_LIMBS - 1) {
+                m = _mm512_and_si512(m, broadcast((1ULL << FINAL_ROUND_BITS) - 1));
+            }
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[k + j] = _mm512_madd52lo_epu64(t[k + j], m, broadcast(modulus[j]));
+                t[k + j + 1] = _mm512_madd52hi_epu64(t[k + j + 1], m, broadcast(modulus[j]));
+            }
+            if (k < NUM_LIMBS - 1) {
+                // The low 52 bits of t[k] are now zero
+                t[k + 1] = _mm512_add_epi64(t[k + 1], _mm512_srli_epi64(t[k], 52));
+            }
+        }
+        for (size_t k = NUM_LIMBS - 1; k < 2 * NUM_LIMBS - 1; ++k) {
+            t[k + 1] = _mm512_add_epi64(t[k + 1], _mm512_srli_epi64(t[k], 52));
+            t[k] = _mm512_and_si512(t[k], mask);
+        }
+        // The low 48 bits of t[4] are zero: shift the remaining limbs down by 48 bits
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm512_or_si512(_mm512_srli_epi64(t[NUM_LIMBS - 1 + j], FINAL_ROUND_BITS),
+                                   _mm512_slli_epi64(t[NUM_LIMBS + j], LIMB_BITS - FINAL_ROUND_BITS));
+            r[j] = _mm512_and_si512(r[j], mask);
+        }
+    }
+
+    // Propagate (signed) carries so that every limb except the most significant one is in [0, 2^52)
+    BB_TARGET_AVX512IFMA static void normalize(Vec (&a)[NUM_LIMBS])
+    {
+        const Vec mask = broadcast(LIMB_MASK);
+        for (size_t j = 0; j < NUM_LIMBS - 1; ++j) {
+            a[j + 1] = _mm512_add_epi64(a[j + 1], _mm512_srai_epi64(a[j], 52));
+            a[j] = _mm512_and_si512(a[j], mask);
+        }
+    }
+
+    // r = a + b, reduced into [0, 2p) for a, b < 2p
+    BB_TARGET_AVX512IFMA static void add(const Vec (&a)[NUM_LIMBS], const Vec (&b)[NUM_LIMBS], Vec (&r)[NUM_LIMBS])
+    {
+        Vec sum[NUM_LIMBS];
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            sum[j] = _mm512_add_epi64(a[j], b[j]);
+        }
+        normalize(sum);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm512_sub_epi64(sum[j], broadcast(twice_modulus[j]));
+        }
+        normalize(r);
+        const __mmask8 underflow = _mm512_cmplt_epi64_mask(r[NUM_LIMBS - 1], _mm512_setzero_si512());
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm512_mask_blend_epi64(underflow, r[j], sum[j]);
+        }
+    }
+
+    // r = a - b, reduced into [0, 2p) for a, b < 2p
+    BB_TARGET_AVX512IFMA static void sub(const Vec (&a)[NUM_LIMBS], const Vec (&b)[NUM_LIMBS], Vec (&r)[NUM_LIMBS])
+    {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm512_sub_epi64(a[j], b[j]);
+        }
+        normalize(r);
+        const __mmask8 underflow = _mm512_cmplt_epi64_mask(r[NUM_LIMBS - 1], _mm512_setzero_si512());
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm512_mask_add_epi64(r[j], underflow, r[j], broadcast(twice_modulus[j]));
+        }
+        normalize(r);
+    }
+
+    template <BatchOp op>
+    BB_TARGET_AVX512IFMA_NOINLINE static size_t run(
+        const uint64_t* a, const uint64_t* b, const uint64_t* c, uint64_t* out, const size_t n)
+    {
+        constexpr bool broadcast_b = (op == BatchOp::MulBroadcast || op == BatchOp::FmaBroadcast);
+        constexpr size_t WORDS_PER_BLOCK = LANES * 4;
+        Vec a_limbs[NUM_LIMBS];
+        Vec b_limbs[NUM_LIMBS];
+        Vec c_limbs[NUM_LIMBS];
+        Vec r_limbs[NUM_LIMBS];
+        if constexpr (broadcast_b) {
+            const auto b_split = split_into_limbs<NUM_LIMBS, LIMB_BITS>({ b[0], b[1], b[2], b[3] });
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                b_limbs[j] = broadcast(b_split[j]);
+            }
+        }
+        const size_t num_blocks = n / LANES;
+        for (size_t block = 0; block < num_blocks; ++block) {
+            const size_t offset = block * WORDS_PER_BLOCK;
+            load(a + offset, a_limbs);
+            if constexpr (!broadcast_b) {
+                load(b + offset, b_limbs);
+            }
+            if constexpr (op == BatchOp::Add) {
+                add(a_limbs, b_limbs, r_limbs);
+            } else if constexpr (op == BatchOp::Sub) {
+                sub(a_limbs, b_limbs, r_limbs);
+            } else if constexpr (op == BatchOp::Mul || op == BatchOp::MulBroadcast) {
+                montgomery_mul(a_limbs, b_limbs, r_limbs);
+            } else {
+                Vec product[NUM_LIMBS];
+                montgomery_mul(a_limbs, b_limbs, product);
+                load(c + offset, c_limbs);
+                add(product, c_limbs, r_limbs);
+            }
+            store(out + offset, r_limbs);
+        }
+        return num_blocks * LANES;
+    }
+};
+
+/**
+ * @brief 4-lane kernels using 9 x 29-bit limbs
+ * @details AVX2 has no 64-bit arithmetic right shift, so signed carries are propagated by biasing the limbs first.
+ */
+template <class Params> struct Avx2Kernels {
+    using Vec = __m256i;
+    static constexpr size_t LANES = 4;
+    static constexpr size_t NUM_LIMBS = 9;
+    static constexpr size_t LIMB_BITS = 29;
+    static constexpr uint64_t LIMB_MASK = (1ULL << LIMB_BITS) - 1;
+    // 256 = 8 * 29 + 24: the last Montgomery reduction round uses a 24-bit digit
+    static constexpr size_t FINAL_ROUND_BITS = 256 - (NUM_LIMBS - 1) * LIMB_BITS;
+    static constexpr uint64_t CARRY_BIAS = 1ULL << 62;
+
+    static constexpr auto modulus = split_into_limbs<NUM_LIMBS, LIMB_BITS>(get_modulus_words<Params>());
+    static constexpr auto twice_modulus = split_into_limbs<NUM_LIMBS, LIMB_BITS>(get_twice_modulus_words<Params>());
+
+    BB_TARGET_AVX2 static Vec broadcast(const uint64_t x) { return _mm256_set1_epi64x(static_cast<long long>(x)); }
+
+    // 4x4 transpose of 64-bit words (its own inverse)
+    BB_TARGET_AVX2 static void transpose(const Vec (&in)[4], Vec (&out)[4])
+    {
+        const Vec t0 = _mm256_unpacklo_epi64(in[0], in[1]);
+        const Vec t1 = _mm256_unpackhi_epi64(in[0], in[1]);
+        const Vec t2 = _mm256_unpacklo_epi64(in[2], in[3]);
+        const Vec t3 = _mm256_unpackhi_epi64(in[2], in[3]);
+        out[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+        out[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+        out[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+        out[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+    }
+
+    BB_TARGET_AVX2 static void load(const uint64_t* src, Vec (&out)[NUM_LIMBS])
+    {
+        Vec rows[4];
+        Vec d[4];
+        for (size_t i = 0; i < 4; ++i) {
+            rows[i] = _mm256_loadu_si256(reinterpret_cast<const Vec*>(src + 4 * i));
+        }
+        transpose(rows, d);
+        const Vec mask = broadcast(LIMB_MASK);
+        out[0] = _mm256_and_si256(d[0], mask);
+        out[1] = _mm256_and_si256(_mm256_srli_epi64(d[0], 29), mask);
+        out[2] = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(d[0], 58), _mm256_slli_epi64(d[1], 6)), mask);
+        out[3] = _mm256_and_si256(_mm256_srli_epi64(d[1], 23), mask);
+        out[4] = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(d[1], 52), _mm256_slli_epi64(d[2], 12)), mask);
+        out[5] = _mm256_and_si256(_mm256_srli_epi64(d[2], 17), mask);
+        out[6] = _mm256_and_si256(_mm256_or_si256(_mm256_srli_epi64(d[2], 46), _mm256_slli_epi64(d[3], 18)), mask);
+        out[7] = _mm256_and_si256(_mm256_srli_epi64(d[3], 11), mask);
+        out[8] = _mm256_srli_epi64(d[3], 40);
+    }
+
+    // Inverse of `load`. Limbs must be normalized.
+    BB_TARGET_AVX2 static void store(uint64_t* dest, const Vec (&in)[NUM_LIMBS])
+    {
+        Vec d[4];
+        Vec rows[4];
+        d[0] = _mm256_or_si256(_mm256_or_si256(in[0], _mm256_slli_epi64(in[1], 29)), _mm256_slli_epi64(in[2], 58));
+        d[1] = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi64(in[2], 6), _mm256_slli_epi64(in[3], 23)),
+                               _mm256_slli_epi64(in[4], 52));
+        d[2] = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi64(in[4], 12), _mm256_slli_epi64(in[5], 17)),
+                               _mm256_slli_epi64(in[6], 46));
+        d[3] = _mm256_or_si256(_mm256_or_si256(_mm256_srli_epi64(in[6], 18), _mm256_slli_epi64(in[7], 11)),
+                               _mm256_slli_epi64(in[8], 40));
+        transpose(d, rows);
+        for (size_t i = 0; i < 4; ++i) {
+            _mm256_storeu_si256(reinterpret_cast<Vec*>(dest + 4 * i), rows[i]);
+        }
+    }
+
+    /**
+     * @brief r = a * b * 2^{-256} mod p, for a, b < 2p. The result is normalized and < 2p.
+     */
+    BB_TARGET_AVX2 static void montgomery_mul(const Vec (&a)[NUM_LIMBS],
+                                              const Vec (&b)[NUM_LIMBS],
+                                              Vec (&r)[NUM_LIMBS])
+    {
+        const Vec mask = broadcast(LIMB_MASK);
+        // Column accumulators. Each receives < 20 terms of < 2^58, so cannot overflow
+        Vec t[2 * NUM_LIMBS];
+        for (auto& column : t) {
+            column = _mm256_setzero_si256();
+        }
+        for (size_t i = 0; i < NUM_LIMBS; ++i) {
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[i + j] = _mm256_add_epi64(t[i + j], _mm256_mul_epu32(a[i], b[j]));
+            }
+        }
+
+        const Vec r_inv = broadcast(Params::r_inv & LIMB_MASK);
+        for (size_t k = 0; k < NUM_LIMBS; ++k) {
+            const uint64_t digit_mask = (k == NUM_LIMBS - 1) ? (1ULL << FINAL_ROUND_BITS) - 1 : LIMB_MASK;
+            // m = -t * p^{-1} mod 2^29 (mod 2^24 in the final round)
+            const Vec m =
+                _mm256_and_si256(_mm256_mul_epu32(_mm256_and_si256(t[k], mask), r_inv), broadcast(digit_mask));
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                t[k + j] = _mm256_add_epi64(t[k + j], _mm256_mul_epu32(m, broadcast(modulus[j])));
+            }
+            if (k < NUM_LIMBS - 1) {
+                // The low 29 bits of t[k] are now zero
+                t[k + 1] = _mm256_add_epi64(t[k + 1], _mm256_srli_epi64(t[k], 29));
+            }
+        }
+        for (size_t k = NUM_LIMBS - 1; k < 2 * NUM_LIMBS - 1; ++k) {
+            t[k + 1] = _mm256_add_epi64(t[k + 1], _mm256_srli_epi64(t[k], 29));
+            t[k] = _mm256_and_si256(t[k], mask);
+        }
+        // The low 24 bits of t[8] are zero: shift the remaining limbs down by 24 bits
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm256_or_si256(_mm256_srli_epi64(t[NUM_LIMBS - 1 + j], FINAL_ROUND_BITS),
+                                   _mm256_slli_epi64(t[NUM_LIMBS + j], LIMB_BITS - FINAL_ROUND_BITS));
+            r[j] = _mm256_and_si256(r[j], mask);
+        }
+    }
+
+    // Propagate (signed) carries so that every limb except the most significant one is in [0, 2^29).
+    // Biasing by 2^62 turns the logical shift into an arithmetic one for limbs in (-2^62, 2^62).
+    BB_TARGET_AVX2 static void normalize(Vec (&a)[NUM_LIMBS])
+    {
+        const Vec mask = broadcast(LIMB_MASK);
+        const Vec bias = broadcast(CARRY_BIAS);
+        const Vec unbias = broadcast(CARRY_BIAS >> LIMB_BITS);
+        for (size_t j = 0; j < NUM_LIMBS - 1; ++j) {
+            const Vec carry = _mm256_sub_epi64(_mm256_srli_epi64(_mm256_add_epi64(a[j], bias), 29), unbias);
+            a[j + 1] = _mm256_add_epi64(a[j + 1], carry);
+            a[j] = _mm256_and_si256(a[j], mask);
+        }
+    }
+
+    // r = a + b, reduced into [0, 2p) for a, b < 2p
+    BB_TARGET_AVX2 static void add(const Vec (&a)[NUM_LIMBS], const Vec (&b)[NUM_LIMBS], Vec (&r)[NUM_LIMBS])
+    {
+        Vec sum[NUM_LIMBS];
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            sum[j] = _mm256_add_epi64(a[j], b[j]);
+        }
+        normalize(sum);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm256_sub_epi64(sum[j], broadcast(twice_modulus[j]));
+        }
+        normalize(r);
+        const Vec underflow = _mm256_cmpgt_epi64(_mm256_setzero_si256(), r[NUM_LIMBS - 1]);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm256_blendv_epi8(r[j], sum[j], underflow);
+        }
+    }
+
+    // r = a - b, reduced into [0, 2p) for a, b < 2p
+    BB_TARGET_AVX2 static void sub(const Vec (&a)[NUM_LIMBS], const Vec (&b)[NUM_LIMBS], Vec (&r)[NUM_LIMBS])
+    {
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm256_sub_epi64(a[j], b[j]);
+        }
+        normalize(r);
+        const Vec underflow = _mm256_cmpgt_epi64(_mm256_setzero_si256(), r[NUM_LIMBS - 1]);
+        for (size_t j = 0; j < NUM_LIMBS; ++j) {
+            r[j] = _mm256_add_epi64(r[j], _mm256_and_si256(underflow, broadcast(twice_modulus[j])));
+        }
+        normalize(r);
+    }
+
+    template <BatchOp op>
+    BB_TARGET_AVX2_NOINLINE static size_t run(
+        const uint64_t* a, const uint64_t* b, const uint64_t* c, uint64_t* out, const size_t n)
+    {
+        constexpr bool broadcast_b = (op == BatchOp::MulBroadcast || op == BatchOp::FmaBroadcast);
+        constexpr size_t WORDS_PER_BLOCK = LANES * 4;
+        Vec a_limbs[NUM_LIMBS];
+        Vec b_limbs[NUM_LIMBS];
+        Vec c_limbs[NUM_LIMBS];
+        Vec r_limbs[NUM_LIMBS];
+        if constexpr (broadcast_b) {
+            const auto b_split = split_into_limbs<NUM_LIMBS, LIMB_BITS>({ b[0], b[1], b[2], b[3] });
+            for (size_t j = 0; j < NUM_LIMBS; ++j) {
+                b_limbs[j] = broadcast(b_split[j]);
+            }
+        }
+        const size_t num_blocks = n / LANES;
+        for (size_t block = 0; block < num_blocks; ++block) {
+            const size_t offset = block * WORDS_PER_BLOCK;
+            load(a + offset, a_limbs);
+            if constexpr (!broadcast_b) {
+                load(b + offset, b_limbs);
+            }
+            if constexpr (op == BatchOp::Add) {
+                add(a_limbs, b_limbs, r_limbs);
+            } else if constexpr (op == BatchOp::Sub) {
+                sub(a_limbs, b_limbs, r_limbs);
+            } else if constexpr (op == BatchOp::Mul || op == BatchOp::MulBroadcast) {
+                montgomery_mul(a_limbs, b_limbs, r_limbs);
+            } else {
+                Vec product[NUM_LIMBS];
+                montgomery_mul(a_limbs, b_limbs, product);
+                load(c + offset, c_limbs);
+                add(product, c_limbs, r_limbs);
+            }
+            store(out + offset, r_limbs);
+        }
+        return num_blocks * LANES;
+    }
+};
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+#endif // BB_FIELD_SIMD
+
+/**
+ * @brief Apply `op` to the longest prefix of the inputs that the active SIMD kernel can handle
+ *
+ * @param b a single element for broadcast ops
+ * @param c only read by fma ops
+ * @param out may alias any of the inputs
+ * @return the number of elements processed
+ */
+template <BatchOp op, class Field>
+size_t batch_simd([[maybe_unused]] const Field* a,
+                  [[maybe_unused]] const Field* b,
+                  [[maybe_unused]] const Field* c,
+                  [[maybe_unused]] Field* out,
+                  [[maybe_unused]] const size_t n) noexcept
+{
+#ifdef BB_FIELD_SIMD
+    using Params = typename Field::Params;
+    if constexpr (supports_batch_simd<Params>) {
+        const auto* a_words = reinterpret_cast<const uint64_t*>(a);
+        const auto* b_words = reinterpret_cast<const uint64_t*>(b);
+        const auto* c_words = reinterpret_cast<const uint64_t*>(c);
+        auto* out_words = reinterpret_cast<uint64_t*>(out);
+        switch (get_isa()) {
+        case Isa::AVX512IFMA:
+            return Avx512IfmaKernels<Params>::template run<op>(a_words, b_words, c_words, out_words, n);
+        case Isa::AVX2:
+            return Avx2Kernels<Params>::template run<op>(a_words, b_words, c_words, out_words, n);
+        default:
+            break;
+        }
+    }
+#endif
+    return 0;
+}
+
+} // namespace bb::field_simd
@@ -345,6 +345,27 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+
+    /**
+     * @brief Element-wise arithmetic over equally sized spans, e.g. out[i] = a[i] * b[i]
+     * @details Runs on multi-lane AVX-512 IFMA / AVX2 kernels where the CPU supports them (see field_batch_simd.hpp)
+     * and falls back to the scalar operators otherwise. `out` may alias any of the inputs.
+     */
+    static void batch_add(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept;
+    static void batch_sub(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept;
+    static void batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept;
+    static void batch_mul(std::span<const field> a, const field& b, std::span<field> out) noexcept;
+    static void batch_sqr(std::span<const field> a, std::span<field> out) noexcept;
+    // out[i] = a[i] * b[i] + c[i]
+    static void batch_fma(std::span<const field> a,
+                          std::span<const field> b,
+                          std::span<const field> c,
+                          std::span<field> out) noexcept;
+    // out[i] = a[i] * b + c[i]
+    static void batch_fma(std::span<const field> a,
+                          const field& b,
+                          std::span<const field> c,
+                          std::span<field> out) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
@@ -17,6 +17,7 @@
 #include <vector>
 
 #include "./field_declarations.hpp"
+#include "./field_batch_simd.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 
 namespace bb {
@@ -437,6 +438,93 @@ template <class T> void field<T>::batch_invert(std::span<field> coeffs) noexcept
     }
 }
 
+template <class T>
+void field<T>::batch_add(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), out.size());
+    const size_t n = out.size();
+    size_t i = field_simd::batch_simd<field_simd::BatchOp::Add, field>(a.data(), b.data(), nullptr, out.data(), n);
+    for (; i < n; ++i) {
+        out[i] = a[i] + b[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_sub(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), out.size());
+    const size_t n = out.size();
+    size_t i = field_simd::batch_simd<field_simd::BatchOp::Sub, field>(a.data(), b.data(), nullptr, out.data(), n);
+    for (; i < n; ++i) {
+        out[i] = a[i] - b[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_mul(std::span<const field> a, std::span<const field> b, std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), out.size());
+    const size_t n = out.size();
+    size_t i = field_simd::batch_simd<field_simd::BatchOp::Mul, field>(a.data(), b.data(), nullptr, out.data(), n);
+    for (; i < n; ++i) {
+        out[i] = a[i] * b[i];
+    }
+}
+
+template <class T> void field<T>::batch_mul(std::span<const field> a, const field& b, std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    const size_t n = out.size();
+    size_t i = field_simd::batch_simd<field_simd::BatchOp::MulBroadcast, field>(a.data(), &b, nullptr, out.data(), n);
+    for (; i < n; ++i) {
+        out[i] = a[i] * b;
+    }
+}
+
+template <class T> void field<T>::batch_sqr(std::span<const field> a, std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), out.size());
+    const size_t n = out.size();
+    size_t i = field_simd::batch_simd<field_simd::BatchOp::Mul, field>(a.data(), a.data(), nullptr, out.data(), n);
+    for (; i < n; ++i) {
+        out[i] = a[i].sqr();
+    }
+}
+
+template <class T>
+void field<T>::batch_fma(std::span<const field> a,
+                         std::span<const field> b,
+                         std::span<const field> c,
+                         std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), b.size());
+    BB_ASSERT_EQ(a.size(), c.size());
+    BB_ASSERT_EQ(a.size(), out.size());
+    const size_t n = out.size();
+    size_t i = field_simd::batch_simd<field_simd::BatchOp::Fma, field>(a.data(), b.data(), c.data(), out.data(), n);
+    for (; i < n; ++i) {
+        out[i] = a[i] * b[i] + c[i];
+    }
+}
+
+template <class T>
+void field<T>::batch_fma(std::span<const field> a,
+                         const field& b,
+                         std::span<const field> c,
+                         std::span<field> out) noexcept
+{
+    BB_ASSERT_EQ(a.size(), c.size());
+    BB_ASSERT_EQ(a.size(), out.size());
+    const size_t n = out.size();
+    size_t i = field_simd::batch_simd<field_simd::BatchOp::FmaBroadcast, field>(a.data(), &b, c.data(), out.data(), n);
+    for (; i < n; ++i) {
+        out[i] = a[i] * b + c[i];
+    }
+}
+
 /**
  * @brief Implements an optimized variant of Tonelli-Shanks via lookup tables.
  * Algorithm taken from https://cr.yp.to/papers/sqroot-20011123-retypeset20220327.pdf
@@ -0,0 +1,364 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+#include "barretenberg/ecc/scalar_multiplication/fixed_base_msm.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/op_count.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::scalar_multiplication {
+
+template <typename Curve>
+FixedBaseTable<Curve>::FixedBaseTable(size_t num_points, size_t window_bits)
+    : num_points(num_points)
+    , window_bits(window_bits)
+    , num_windows(get_num_windows(window_bits))
+    , entries_per_window(get_entries_per_window(window_bits))
+{}
+
+template <typename Curve> FixedBaseTable<Curve>::~FixedBaseTable()
+{
+#ifndef __wasm__
+    if (mapped_data != nullptr) {
+        munmap(mapped_data, mapped_size);
+    }
+#endif
+}
+
+template <typename Curve> uint64_t FixedBaseTable<Curve>::get_curve_id() noexcept
+{
+    if constexpr (std::same_as<Curve, curve::BN254>) {
+        return 1;
+    } else {
+        return 2;
+    }
+}
+
+template <typename Curve>
+size_t FixedBaseTable<Curve>::get_optimal_window_bits(const size_t num_points, const size_t memory_budget) noexcept
+{
+    // Wider windows strictly reduce the number of additions (one per window), so take the widest one that fits
+    for (size_t bits = MAX_WINDOW_BITS; bits >= MIN_WINDOW_BITS; --bits) {
+        if (get_table_size_in_bytes(num_points, bits) <= memory_budget) {
+            return bits;
+        }
+    }
+    return 0;
+}
+
+template <typename Curve>
+void FixedBaseTable<Curve>::get_signed_digits(const ScalarField& scalar,
+                                              const size_t window_bits,
+                                              std::span<int32_t> digits) noexcept
+{
+    const size_t num_windows = get_num_windows(window_bits);
+    BB_ASSERT_GTE(digits.size(), num_windows);
+    const uint64_t window_mask = (static_cast<uint64_t>(1) << window_bits) - 1;
+    const uint64_t half_window = static_cast<uint64_t>(1) << (window_bits - 1);
+
+    uint64_t carry = 0;
+    for (size_t j = 0; j < num_windows; ++j) {
+        const size_t lo_bit = j * window_bits;
+        const size_t limb = lo_bit >> 6;
+        const size_t offset = lo_bit & 63;
+        uint64_t slice = scalar.data[limb] >> offset;
+        if ((offset + window_bits > 64) && (limb + 1 < 4)) {
+            slice |= scalar.data[limb + 1] << (64 - offset);
+        }
+        slice = (slice & window_mask) + carry;
+        // A window value above 2^{w - 1} is represented as (value - 2^w), borrowing from the next window
+        carry = slice > half_window ? 1 : 0;
+        digits[j] = static_cast<int32_t>(slice) - static_cast<int32_t>(carry << window_bits);
+    }
+}
+
+template <typename Curve>
+void FixedBaseTable<Curve>::compute_table(std::span<const AffineElement> points,
+                                          const size_t window_bits,
+                                          std::span<AffineElement> out)
+{
+    const size_t num_windows = get_num_windows(window_bits);
+    const size_t entries_per_window = get_entries_per_window(window_bits);
+    const size_t entries_per_point = get_entries_per_point(window_bits);
+    BB_ASSERT_EQ(out.size(), points.size() * entries_per_point);
+
+    parallel_for_range(points.size(), [&](size_t start, size_t end) {
+        std::vector<Element> multiples(entries_per_point);
+        for (size_t i = start; i < end; ++i) {
+            // base = [2^{w * j}] P_i
+            Element base = points[i];
+            for (size_t j = 0; j < num_windows; ++j) {
+                Element accumulator = base;
+                multiples[j * entries_per_window] = accumulator;
+                for (size_t d = 1; d < entries_per_window; ++d) {
+                    accumulator += base;
+                    multiples[j * entries_per_window + d] = accumulator;
+                }
+                for (size_t k = 0; k < window_bits; ++k) {
+                    base.self_dbl();
+                }
+            }
+            Element::batch_normalize(&multiples[0], entries_per_point);
+            AffineElement* destination = &out[i * entries_per_point];
+            for (size_t e = 0; e < entries_per_point; ++e) {
+                destination[e] = AffineElement(multiples[e].x, multiples[e].y);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Sum a batch of points into `accumulator`
+ * @details Each pass halves the batch using independent affine additions that share a single inversion. Once the batch
+ * is small the inversion is no longer amortised, so the remaining points are added with mixed additions.
+ */
+template <typename Curve>
+void FixedBaseTable<Curve>::reduce_batch(std::span<AffineElement> points,
+                                         std::span<BaseField> scratch_space,
+                                         Element& accumulator)
+{
+    AffineElement* batch = points.data();
+    size_t batch_size = points.size();
+    while (batch_size > ADDITION_BATCH_TAIL_SIZE) {
+        if ((batch_size & 1) == 1) {
+            accumulator += batch[batch_size - 1];
+            batch_size -= 1;
+        }
+        BB_ASSERT_LTE(batch_size / 2, scratch_space.size());
+        MSM<Curve>::add_affine_points(batch, batch_size, scratch_space.data());
+        // `add_affine_points` stores the results in the top half of the batch
+        batch += batch_size / 2;
+        batch_size /= 2;
+    }
+    for (size_t i = 0; i < batch_size; ++i) {
+        accumulator += batch[i];
+    }
+}
+
+template <typename Curve>
+typename Curve::AffineElement FixedBaseTable<Curve>::msm(PolynomialSpan<const ScalarField> scalars) const
+{
+    PROFILE_THIS_NAME("fixed_base_msm");
+    if (scalars.size() == 0) {
+        return Curve::Group::affine_point_at_infinity;
+    }
+    BB_ASSERT_LTE(scalars.end_index(), num_points, "Fixed-base table does not cover the requested range.");
+
+    const size_t entries_per_point = num_windows * entries_per_window;
+    const MultithreadData thread_data = calculate_thread_data(scalars.size());
+    std::vector<Element> thread_results(thread_data.num_threads);
+
+    parallel_for(thread_data.num_threads, [&](size_t thread_idx) {
+        // Leave room for a full scalar's worth of digits past the batch size so that we never split a scalar
+        std::vector<AffineElement> batch(ADDITION_BATCH_SIZE + num_windows);
+        std::vector<BaseField> scratch_space(batch.size() / 2);
+        std::vector<int32_t> digits(num_windows);
+        Element accumulator = Curve::Group::point_at_infinity;
+        size_t batch_size = 0;
+
+        for (size_t i = thread_data.start[thread_idx]; i < thread_data.end[thread_idx]; ++i) {
+            const ScalarField scalar = scalars.span[i].from_montgomery_form();
+            if (scalar.is_zero()) {
+                continue;
+            }
+            get_signed_digits(scalar, window_bits, digits);
+            const AffineElement* point_table = &table[(scalars.start_index + i) * entries_per_point];
+            for (size_t j = 0; j < num_windows; ++j) {
+                const int32_t digit = digits[j];
+                if (digit == 0) {
+                    continue;
+                }
+                const size_t entry = static_cast<size_t>(digit > 0 ? digit : -digit) - 1;
+                const AffineElement& point = point_table[j * entries_per_window + entry];
+                batch[batch_size++] = digit > 0 ? point : -point;
+            }
+            if (batch_size >= ADDITION_BATCH_SIZE) {
+                reduce_batch({ batch.data(), batch_size }, scratch_space, accumulator);
+                batch_size = 0;
+            }
+        }
+        reduce_batch({ batch.data(), batch_size }, scratch_space, accumulator);
+        thread_results[thread_idx] = accumulator;
+    });
+
+    Element result = Curve::Group::point_at_infinity;
+    for (const Element& thread_result : thread_results) {
+        result += thread_result;
+    }
+    return AffineElement(result);
+}
+
+template <typename Curve>
+std::filesystem::path FixedBaseTable<Curve>::get_cache_file_path(const std::filesystem::path& cache_dir,
+                                                                 const size_t num_points,
+                                                                 const size_t window_bits)
+{
+    const std::string curve_name = std::same_as<Curve, curve::BN254> ? "bn254" : "grumpkin";
+    return cache_dir / ("fixed_base_" + curve_name + "_" + std::to_string(num_points) + "_w" +
+                        std::to_string(window_bits) + "_v" + std::to_string(CACHE_FILE_VERSION) + ".dat");
+}
+
+template <typename Curve>
+typename FixedBaseTable<Curve>::CacheFileHeader FixedBaseTable<Curve>::make_header(
+    std::span<const AffineElement> points) const
+{
+    CacheFileHeader header;
+    // Zero any padding so that the header bytes written to disk are deterministic
+    std::memset(static_cast<void*>(&header), 0, sizeof(CacheFileHeader));
+    header.magic = CACHE_FILE_MAGIC;
+    header.version = CACHE_FILE_VERSION;
+    header.curve_id = get_curve_id();
+    header.point_size = sizeof(AffineElement);
+    header.num_points = num_points;
+    header.window_bits = window_bits;
+    header.first_point = points.front();
+    header.last_point = points[num_points - 1];
+    return header;
+}
+
+template <typename Curve>
+bool FixedBaseTable<Curve>::load_from_file(const std::filesystem::path& path, std::span<const AffineElement> points)
+{
+#ifndef __wasm__
+    const size_t table_size = num_points * num_windows * entries_per_window;
+    const size_t file_size = sizeof(CacheFileHeader) + (table_size * sizeof(AffineElement));
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat file_stat;
+    if (fstat(fd, &file_stat) != 0 || static_cast<size_t>(file_stat.st_size) != file_size) {
+        close(fd);
+        return false;
+    }
+    void* addr = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping keeps the file alive, we no longer need the descriptor
+    close(fd);
+    if (addr == MAP_FAILED) {
+        return false;
+    }
+
+    const auto* header = static_cast<const CacheFileHeader*>(addr);
+    const CacheFileHeader expected = make_header(points);
+    bool valid = header->magic == expected.magic && header->version == expected.version &&
+                 header->curve_id == expected.curve_id && header->point_size == expected.point_size &&
+                 header->num_points == expected.num_points && header->window_bits == expected.window_bits &&
+                 header->first_point == expected.first_point && header->last_point == expected.last_point;
+    if (!valid) {
+        info("fixed-base table cache ", path, " does not match the SRS, rebuilding.");
+        munmap(addr, file_size);
+        return false;
+    }
+
+    mapped_data = addr;
+    mapped_size = file_size;
+    table = std::span<const AffineElement>(
+        reinterpret_cast<const AffineElement*>(static_cast<const uint8_t*>(addr) + sizeof(CacheFileHeader)),
+        table_size);
+    return true;
+#else
+    static_cast<void>(path);
+    static_cast<void>(points);
+    return false;
+#endif
+}
+
+template <typename Curve>
+void FixedBaseTable<Curve>::save_to_file(const std::filesystem::path& path, std::span<const AffineElement> points) const
+{
+#ifndef __wasm__
+    std::error_code error;
+    std::filesystem::create_directories(path.parent_path(), error);
+    // Write to a process-unique temporary and rename, so concurrent provers never observe a partially written table
+    std::filesystem::path temp_path = path;
+    temp_path += ".tmp." + std::to_string(getpid());
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            info("could not create fixed-base table cache ", temp_path);
+            return;
+        }
+        const CacheFileHeader header = make_header(points);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(CacheFileHeader));
+        file.write(reinterpret_cast<const char*>(table.data()),
+                   static_cast<std::streamsize>(table.size() * sizeof(AffineElement)));
+        if (!file) {
+            info("failed to write fixed-base table cache ", temp_path);
+            file.close();
+            std::filesystem::remove(temp_path, error);
+            return;
+        }
+    }
+    std::filesystem::rename(temp_path, path, error);
+    if (error) {
+        info("failed to move fixed-base table cache into place: ", error.message());
+        std::filesystem::remove(temp_path, error);
+    }
+#else
+    static_cast<void>(path);
+    static_cast<void>(points);
+#endif
+}
+
+template <typename Curve>
+std::shared_ptr<FixedBaseTable<Curve>> FixedBaseTable<Curve>::create(std::span<const AffineElement> points,
+                                                                     const size_t memory_budget,
+                                                                     const std::filesystem::path& cache_dir)
+{
+    PROFILE_THIS_NAME("FixedBaseTable::create");
+    size_t num_covered_points = points.size();
+    size_t window_bits = get_optimal_window_bits(num_covered_points, memory_budget);
+    if (window_bits == 0) {
+        // Not even the narrowest table fits: cover as many leading points as the budget allows. Most polynomials start
+        // at index 0, so a prefix is still useful.
+        window_bits = MIN_WINDOW_BITS;
+        num_covered_points = memory_budget / (get_entries_per_point(window_bits) * sizeof(AffineElement));
+    }
+    if (num_covered_points == 0) {
+        return nullptr;
+    }
+    std::span<const AffineElement> covered_points = points.subspan(0, num_covered_points);
+
+    std::shared_ptr<FixedBaseTable> result(new FixedBaseTable(num_covered_points, window_bits));
+    std::filesystem::path cache_path;
+    if (!cache_dir.empty()) {
+        cache_path = get_cache_file_path(cache_dir, num_covered_points, window_bits);
+        if (result->load_from_file(cache_path, covered_points)) {
+            vinfo("loaded fixed-base table from ", cache_path);
+            return result;
+        }
+    }
+
+    result->owned_table.resize(num_covered_points * get_entries_per_point(window_bits));
+    compute_table(covered_points, window_bits, result->owned_table);
+    result->table = result->owned_table;
+
+    if (!cache_dir.empty()) {
+        result->save_to_file(cache_path, covered_points);
+        // Prefer the mapping over our private copy: it is backed by the page cache and shared between processes
+        if (result->load_from_file(cache_path, covered_points)) {
+            result->owned_table = std::vector<AffineElement>();
+        }
+    }
+    return result;
+}
+
+template class FixedBaseTable<curve::Grumpkin>;
+template class FixedBaseTable<curve::BN254>;
+
+} // namespace bb::scalar_multiplication
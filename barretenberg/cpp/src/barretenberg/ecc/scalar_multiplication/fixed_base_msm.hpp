@@ -0,0 +1,161 @@
+// === AUDIT STATUS ===
+// internal:    { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_1:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// external_2:  { status: not started, auditors: [], date: YYYY-MM-DD }
+// =====================
+
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace bb::scalar_multiplication {
+
+/**
+ * @brief Precomputed windowed multiples of a fixed set of base points, used for bucket-free MSMs
+ * @details For a base point P_i and a window width w, the table holds
+ *
+ *          T[i][j][d - 1] = [d * 2^{w * j}] P_i   for d in [1, 2^{w - 1}] and j in [0, num_windows)
+ *
+ *          Scalars are decomposed into signed w-bit digits in [-2^{w - 1}, 2^{w - 1}], so that a multi-scalar
+ *          multiplication becomes a pure lookup-and-add: every nonzero digit contributes +/- one table entry and no
+ *          buckets, bucket accumulation or doublings are required. The additions are performed in large batches using
+ *          the affine trick (see `MSM::add_affine_points`).
+ *
+ *          The table size grows as N * ceil((NUM_BITS + 1) / w) * 2^{w - 1} points, so the window width is chosen as
+ *          the largest one whose table fits inside a caller-provided memory budget. If even the narrowest window does
+ *          not fit, only a prefix of the base points is covered.
+ *
+ *          As the bases never change between proofs, the table can be cached on disk. The cache is a versioned file
+ *          that is memory-mapped read-only on subsequent loads.
+ * @warning Like `pippenger_unsafe`, the batched affine additions assume the base points are linearly independent.
+ */
+template <typename Curve> class FixedBaseTable {
+  public:
+    using Element = typename Curve::Element;
+    using ScalarField = typename Curve::ScalarField;
+    using BaseField = typename Curve::BaseField;
+    using AffineElement = typename Curve::AffineElement;
+
+    static constexpr size_t NUM_BITS_IN_FIELD = ScalarField::modulus.get_msb() + 1;
+    static constexpr size_t MIN_WINDOW_BITS = 2;
+    static constexpr size_t MAX_WINDOW_BITS = 10;
+    // Bump whenever the on-disk layout or the table contents change
+    static constexpr uint64_t CACHE_FILE_VERSION = 1;
+
+    FixedBaseTable(const FixedBaseTable&) = delete;
+    FixedBaseTable& operator=(const FixedBaseTable&) = delete;
+    FixedBaseTable(FixedBaseTable&&) = delete;
+    FixedBaseTable& operator=(FixedBaseTable&&) = delete;
+    ~FixedBaseTable();
+
+    /**
+     * @brief Number of signed-digit windows. One more bit than the field is needed to absorb the final carry.
+     */
+    static constexpr size_t get_num_windows(const size_t window_bits) noexcept
+    {
+        return (NUM_BITS_IN_FIELD + window_bits) / window_bits;
+    }
+    static constexpr size_t get_entries_per_window(const size_t window_bits) noexcept
+    {
+        return static_cast<size_t>(1) << (window_bits - 1);
+    }
+    static constexpr size_t get_entries_per_point(const size_t window_bits) noexcept
+    {
+        return get_num_windows(window_bits) * get_entries_per_window(window_bits);
+    }
+    static constexpr size_t get_table_size_in_bytes(const size_t num_points, const size_t window_bits) noexcept
+    {
+        return num_points * get_entries_per_point(window_bits) * sizeof(AffineElement);
+    }
+
+    /**
+     * @brief Choose the widest window whose table for `num_points` bases fits in `memory_budget` bytes
+     * @return the window width, or 0 if not even a MIN_WINDOW_BITS table fits
+     */
+    static size_t get_optimal_window_bits(size_t num_points, size_t memory_budget) noexcept;
+
+    /**
+     * @brief Build (or load from `cache_dir`) a table for the given base points
+     *
+     * @param points the fixed bases, e.g. the SRS monomial points
+     * @param memory_budget upper bound on the size of the table in bytes
+     * @param cache_dir directory in which to look for / store the table file. Empty disables the on-disk cache.
+     * @return the table, or nullptr if the budget is too small to cover a single point
+     */
+    static std::shared_ptr<FixedBaseTable> create(std::span<const AffineElement> points,
+                                                  size_t memory_budget,
+                                                  const std::filesystem::path& cache_dir = {});
+
+    /**
+     * @brief Compute ∑ᵢ sᵢ⋅Pᵢ using table lookups. The scalars are not modified.
+     */
+    AffineElement msm(PolynomialSpan<const ScalarField> scalars) const;
+
+    size_t get_num_points() const noexcept { return num_points; }
+    size_t get_window_bits() const noexcept { return window_bits; }
+    bool is_memory_mapped() const noexcept { return mapped_data != nullptr; }
+    std::span<const AffineElement> get_table() const noexcept { return table; }
+
+    /**
+     * @brief Extract the signed w-bit digits of a scalar that is *NOT* in Montgomery form
+     * @details The output is little-endian, i.e. digits[j] is the coefficient of 2^{w * j}.
+     */
+    static void get_signed_digits(const ScalarField& scalar, size_t window_bits, std::span<int32_t> digits) noexcept;
+
+    static std::filesystem::path get_cache_file_path(const std::filesystem::path& cache_dir,
+                                                     size_t num_points,
+                                                     size_t window_bits);
+
+  private:
+    // Number of affine points gathered per thread before they are reduced with batched affine additions
+    static constexpr size_t ADDITION_BATCH_SIZE = 4096;
+    // Once a batch has been halved down to this many points, finish it off with mixed additions. Further halving would
+    // cost more in (non-amortised) inversions than it saves.
+    static constexpr size_t ADDITION_BATCH_TAIL_SIZE = 128;
+
+    struct CacheFileHeader {
+        uint64_t magic;
+        uint64_t version;
+        uint64_t curve_id;
+        uint64_t point_size;
+        uint64_t num_points;
+        uint64_t window_bits;
+        // The first and last covered base, used to detect a cache file that was built from a different SRS
+        AffineElement first_point;
+        AffineElement last_point;
+    };
+    static constexpr uint64_t CACHE_FILE_MAGIC = 0x4242464958454442ULL; // "BDEXIFBB"
+
+    FixedBaseTable(size_t num_points, size_t window_bits);
+
+    static uint64_t get_curve_id() noexcept;
+    static void compute_table(std::span<const AffineElement> points, size_t window_bits, std::span<AffineElement> out);
+    static void reduce_batch(std::span<AffineElement> points, std::span<BaseField> scratch_space, Element& accumulator);
+
+    CacheFileHeader make_header(std::span<const AffineElement> points) const;
+    bool load_from_file(const std::filesystem::path& path, std::span<const AffineElement> points);
+    void save_to_file(const std::filesystem::path& path, std::span<const AffineElement> points) const;
+
+    size_t num_points;
+    size_t window_bits;
+    size_t num_windows;
+    size_t entries_per_window;
+
+    std::span<const AffineElement> table;
+    std::vector<AffineElement> owned_table;
+    void* mapped_data = nullptr;
+    size_t mapped_size = 0;
+};
+
+extern template class FixedBaseTable<curve::Grumpkin>;
+extern template class FixedBaseTable<curve::BN254>;
+
+} // namespace bb::scalar_multiplication
@@ -0,0 +1,187 @@
+#include "fixed_base_msm.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include "barretenberg/polynomials/polynomial.hpp"
+#include <filesystem>
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_randomness();
+} // namespace
+
+template <class Curve> class FixedBaseMSMTest : public ::testing::Test {
+  public:
+    using Group = typename Curve::Group;
+    using AffineElement = typename Curve::AffineElement;
+    using ScalarField = typename Curve::ScalarField;
+    using Table = scalar_multiplication::FixedBaseTable<Curve>;
+
+    static constexpr size_t num_points = 3000;
+    static inline std::vector<AffineElement> generators{};
+    static inline std::vector<ScalarField> scalars{};
+
+    static void SetUpTestSuite()
+    {
+        generators.resize(num_points);
+        scalars.resize(num_points);
+        parallel_for_range(num_points, [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                generators[i] = Group::one * ScalarField::random_element(&engine);
+                scalars[i] = ScalarField::random_element(&engine);
+            }
+        });
+    }
+
+    static AffineElement pippenger(PolynomialSpan<const ScalarField> scalar_span)
+    {
+        return scalar_multiplication::MSM<Curve>::msm(generators, scalar_span);
+    }
+
+    static std::filesystem::path temp_cache_dir(const std::string& name)
+    {
+        return std::filesystem::temp_directory_path() /
+               ("fixed_base_msm_test_" + name + "_" + std::to_string(getpid()));
+    }
+};
+
+using CurveTypes = ::testing::Types<bb::curve::BN254, bb::curve::Grumpkin>;
+TYPED_TEST_SUITE(FixedBaseMSMTest, CurveTypes);
+
+TYPED_TEST(FixedBaseMSMTest, SignedDigitsRecomposeScalar)
+{
+    using ScalarField = typename TypeParam::ScalarField;
+    using Table = typename TestFixture::Table;
+
+    for (size_t window_bits = Table::MIN_WINDOW_BITS; window_bits <= Table::MAX_WINDOW_BITS; ++window_bits) {
+        const size_t num_windows = Table::get_num_windows(window_bits);
+        const int32_t max_digit = 1 << (window_bits - 1);
+        std::vector<int32_t> digits(num_windows);
+        // Include -1, whose top bits are all set, to exercise the final carry
+        for (ScalarField scalar : { ScalarField::random_element(&engine), ScalarField(-1), ScalarField(1) }) {
+            Table::get_signed_digits(scalar.from_montgomery_form(), window_bits, digits);
+
+            ScalarField recomposed = 0;
+            const ScalarField shift = ScalarField(uint256_t(1) << window_bits);
+            for (size_t j = num_windows; j > 0; --j) {
+                const int32_t digit = digits[j - 1];
+                EXPECT_LE(digit, max_digit);
+                EXPECT_GE(digit, -max_digit);
+                recomposed = recomposed * shift + (digit >= 0 ? ScalarField(static_cast<uint64_t>(digit))
+                                                              : -ScalarField(static_cast<uint64_t>(-digit)));
+            }
+            EXPECT_EQ(recomposed, scalar);
+        }
+    }
+}
+
+TYPED_TEST(FixedBaseMSMTest, WindowSelectionRespectsBudget)
+{
+    using Table = typename TestFixture::Table;
+
+    const size_t num_points = 1 << 10;
+    const size_t budget = Table::get_table_size_in_bytes(num_points, 5);
+    EXPECT_EQ(Table::get_optimal_window_bits(num_points, budget), 5UL);
+    EXPECT_EQ(Table::get_optimal_window_bits(num_points, budget - 1), 4UL);
+    EXPECT_EQ(Table::get_optimal_window_bits(num_points, 0), 0UL);
+}
+
+TYPED_TEST(FixedBaseMSMTest, MSMMatchesPippenger)
+{
+    using ScalarField = typename TypeParam::ScalarField;
+    using Table = typename TestFixture::Table;
+
+    const size_t num_points = TestFixture::num_points;
+    for (size_t window_bits : { 2UL, 4UL, 6UL }) {
+        auto table = Table::create(TestFixture::generators, Table::get_table_size_in_bytes(num_points, window_bits));
+        ASSERT_NE(table, nullptr);
+        EXPECT_EQ(table->get_window_bits(), window_bits);
+        EXPECT_EQ(table->get_num_points(), num_points);
+
+        // Polynomial with a nonzero start index and some zero coefficients
+        const size_t start_index = 123;
+        std::vector<ScalarField> coefficients(TestFixture::scalars.begin() + static_cast<ptrdiff_t>(start_index),
+                                              TestFixture::scalars.end());
+        for (size_t i = 0; i < coefficients.size(); i += 7) {
+            coefficients[i] = 0;
+        }
+        PolynomialSpan<const ScalarField> scalar_span(start_index, coefficients);
+
+        EXPECT_EQ(table->msm(scalar_span), TestFixture::pippenger(scalar_span));
+    }
+}
+
+TYPED_TEST(FixedBaseMSMTest, MSMEdgeCases)
+{
+    using ScalarField = typename TypeParam::ScalarField;
+    using Table = typename TestFixture::Table;
+
+    auto table = Table::create(TestFixture::generators, Table::get_table_size_in_bytes(TestFixture::num_points, 4));
+    ASSERT_NE(table, nullptr);
+
+    std::vector<ScalarField> empty;
+    EXPECT_EQ(table->msm(PolynomialSpan<const ScalarField>(0, empty)), TypeParam::Group::affine_point_at_infinity);
+
+    std::vector<ScalarField> zeroes(100, ScalarField(0));
+    EXPECT_EQ(table->msm(PolynomialSpan<const ScalarField>(0, zeroes)), TypeParam::Group::affine_point_at_infinity);
+
+    std::vector<ScalarField> single{ ScalarField(-1) };
+    PolynomialSpan<const ScalarField> single_span(7, single);
+    EXPECT_EQ(table->msm(single_span), TestFixture::pippenger(single_span));
+}
+
+TYPED_TEST(FixedBaseMSMTest, SmallBudgetCoversPrefix)
+{
+    using ScalarField = typename TypeParam::ScalarField;
+    using Table = typename TestFixture::Table;
+
+    const size_t num_covered = 100;
+    auto table = Table::create(TestFixture::generators,
+                               Table::get_table_size_in_bytes(num_covered, Table::MIN_WINDOW_BITS) + 1);
+    ASSERT_NE(table, nullptr);
+    EXPECT_EQ(table->get_window_bits(), Table::MIN_WINDOW_BITS);
+    EXPECT_EQ(table->get_num_points(), num_covered);
+
+    std::span<const ScalarField> covered_scalars(TestFixture::scalars.data(), num_covered);
+    PolynomialSpan<const ScalarField> scalar_span(0, covered_scalars);
+    EXPECT_EQ(table->msm(scalar_span), TestFixture::pippenger(scalar_span));
+
+    EXPECT_EQ(Table::create(TestFixture::generators, 1), nullptr);
+}
+
+TYPED_TEST(FixedBaseMSMTest, CacheFileRoundTrip)
+{
+    using ScalarField = typename TypeParam::ScalarField;
+    using AffineElement = typename TypeParam::AffineElement;
+    using Table = typename TestFixture::Table;
+
+    const auto cache_dir = TestFixture::temp_cache_dir("round_trip");
+    std::filesystem::remove_all(cache_dir);
+    const size_t budget = Table::get_table_size_in_bytes(TestFixture::num_points, 3);
+
+    auto built = Table::create(TestFixture::generators, budget, cache_dir);
+    ASSERT_NE(built, nullptr);
+    EXPECT_TRUE(std::filesystem::exists(Table::get_cache_file_path(cache_dir, TestFixture::num_points, 3)));
+
+    auto loaded = Table::create(TestFixture::generators, budget, cache_dir);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(loaded->is_memory_mapped());
+    ASSERT_EQ(loaded->get_table().size(), built->get_table().size());
+    EXPECT_TRUE(std::equal(loaded->get_table().begin(), loaded->get_table().end(), built->get_table().begin()));
+
+    PolynomialSpan<const ScalarField> scalar_span(0, TestFixture::scalars);
+    EXPECT_EQ(loaded->msm(scalar_span), TestFixture::pippenger(scalar_span));
+
+    // A cache file built from different bases must be rejected and rebuilt
+    std::vector<AffineElement> other_generators(TestFixture::generators);
+    other_generators[0] = TypeParam::Group::one;
+    auto rebuilt = Table::create(other_generators, budget, cache_dir);
+    ASSERT_NE(rebuilt, nullptr);
+    EXPECT_EQ(rebuilt->get_table()[0], other_generators[0]);
+
+    std::filesystem::remove_all(cache_dir);
+}
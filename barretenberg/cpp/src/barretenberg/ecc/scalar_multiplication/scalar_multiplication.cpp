@@ -120,8 +120,15 @@ std::vector<typename MSM<Curve>::ThreadWorkUnits> MSM<Curve>::get_work_units(
 
     const size_t num_msms = scalars.size();
     msm_scalar_indices.resize(num_msms);
+    if (num_msms > 0) {
+        file_backed_memory::prefetch(scalars[0].data(), scalars[0].size());
+    }
     for (size_t i = 0; i < num_msms; ++i) {
         BB_ASSERT_LT(i, scalars.size());
+        // For file-backed scalars (slow_low_memory mode), read the next batch in while this one is transformed
+        if (i + 1 < num_msms) {
+            file_backed_memory::prefetch(scalars[i + 1].data(), scalars[i + 1].size());
+        }
         transform_scalar_and_get_nonzero_scalar_indices(scalars[i], msm_scalar_indices[i]);
     }
 
@@ -222,22 +229,90 @@ uint32_t MSM<Curve>::get_scalar_slice(const typename Curve::ScalarField& scalar,
     return result;
 }
 
+/**
+ * @brief Compute the constant T = ∑ⱼ 2^{c-1}⋅2^{c⋅j} (over all windows j except the most significant one) that recodes
+ * a scalar into signed digits
+ * @details Writing s + T = ∑ⱼ uⱼ⋅2^{c⋅j} with unsigned c-bit slices uⱼ, we get s = ∑ⱼ (uⱼ - 2^{c-1})⋅2^{c⋅j} for
+ * all but the top window, whose digit is u_top. As the top window holds at most c - 1 bits of s plus a carry,
+ * u_top ≤ 2^{c-1}. The addition performs the carry propagation for all windows at once, so each round can extract its
+ * digit independently.
+ *
+ * @tparam Curve
+ * @param slice_size
+ * @return uint256_t
+ */
+template <typename Curve> uint256_t MSM<Curve>::get_signed_digit_offset(size_t slice_size) noexcept
+{
+    const size_t num_slices = get_num_slices(slice_size, SliceStrategy::SignedDigit);
+    uint256_t offset = 0;
+    for (size_t j = 0; j < num_slices - 1; ++j) {
+        offset += uint256_t(1) << (slice_size * j + slice_size - 1);
+    }
+    return offset;
+}
+
+/**
+ * @brief Given a scalar that is *NOT* in Montgomery form, extract the signed `slice_size`-bit digit for a round
+ * @details Round 0 is the most significant window. The returned value is the bucket index |digit|, with
+ * NEGATIVE_SLICE_FLAG set if the digit is negative.
+ *
+ * @tparam Curve
+ * @param scalar
+ * @param round
+ * @param slice_size
+ * @param digit_offset output of `get_signed_digit_offset(slice_size)`
+ * @return uint32_t
+ */
+template <typename Curve>
+uint32_t MSM<Curve>::get_signed_scalar_slice(const typename Curve::ScalarField& scalar,
+                                             size_t round,
+                                             size_t slice_size,
+                                             const uint256_t& digit_offset) noexcept
+{
+    const size_t num_slices = get_num_slices(slice_size, SliceStrategy::SignedDigit);
+    const size_t window = num_slices - 1 - round;
+    // s < 2^{NUM_BITS_IN_FIELD} and T < 2^{NUM_BITS_IN_FIELD} so this cannot overflow
+    const uint256_t recoded = uint256_t(scalar.data[0], scalar.data[1], scalar.data[2], scalar.data[3]) + digit_offset;
+
+    const size_t lo_bit = window * slice_size;
+    const size_t limb = lo_bit >> 6;
+    const size_t offset = lo_bit & 63;
+    uint64_t slice = recoded.data[limb] >> offset;
+    if ((offset + slice_size > 64) && (limb < 3)) {
+        slice |= recoded.data[limb + 1] << (64 - offset);
+    }
+    slice &= (static_cast<uint64_t>(1) << slice_size) - 1;
+
+    if (window == num_slices - 1) {
+        return static_cast<uint32_t>(slice);
+    }
+    const uint64_t half = static_cast<uint64_t>(1) << (slice_size - 1);
+    if (slice >= half) {
+        return static_cast<uint32_t>(slice - half);
+    }
+    return static_cast<uint32_t>(half - slice) | NEGATIVE_SLICE_FLAG;
+}
+
 /**
  * @brief For a given number of points, compute the optimal Pippenger bucket size
  *
  * @tparam Curve
  * @param num_points
+ * @param slice_strategy signed digits need half as many buckets per slice, so favour wider slices
  * @return constexpr size_t
  */
-template <typename Curve> size_t MSM<Curve>::get_optimal_log_num_buckets(const size_t num_points) noexcept
+template <typename Curve>
+size_t MSM<Curve>::get_optimal_log_num_buckets(const size_t num_points, const SliceStrategy slice_strategy) noexcept
 {
     // We do 2 group operations per bucket, and they are full 3D Jacobian adds which are ~2x more than an affine add
     constexpr size_t COST_OF_BUCKET_OP_RELATIVE_TO_POINT = 5;
     size_t cached_cost = static_cast<size_t>(-1);
     size_t target_bit_slice = 0;
-    for (size_t bit_slice = 1; bit_slice < 20; ++bit_slice) {
-        const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bit_slice);
-        const size_t num_buckets = 1 << bit_slice;
+    // signed digits need at least 2 bits (a sign and a magnitude)
+    const size_t min_bit_slice = slice_strategy == SliceStrategy::SignedDigit ? 2 : 1;
+    for (size_t bit_slice = min_bit_slice; bit_slice < 20; ++bit_slice) {
+        const size_t num_rounds = get_num_slices(bit_slice, slice_strategy);
+        const size_t num_buckets = get_num_buckets(bit_slice, slice_strategy);
         const size_t addition_cost = num_rounds * num_points;
         const size_t bucket_cost = num_rounds * num_buckets * COST_OF_BUCKET_OP_RELATIVE_TO_POINT;
         const size_t total_cost = addition_cost + bucket_cost;
@@ -381,12 +456,12 @@ typename Curve::Element MSM<Curve>::small_pippenger_low_memory_with_transformed_
 {
     std::span<const uint32_t>& nonzero_scalar_indices = msm_data.scalar_indices;
     const size_t size = nonzero_scalar_indices.size();
-    const size_t bits_per_slice = get_optimal_log_num_buckets(size);
-    const size_t num_buckets = 1 << bits_per_slice;
+    const size_t bits_per_slice = get_optimal_log_num_buckets(size, msm_data.slice_strategy);
+    const size_t num_buckets = get_num_buckets(bits_per_slice, msm_data.slice_strategy);
     JacobianBucketAccumulators bucket_data = JacobianBucketAccumulators(num_buckets);
     Element round_output = Curve::Group::point_at_infinity;
 
-    const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+    const size_t num_rounds = get_num_slices(bits_per_slice, msm_data.slice_strategy);
 
     for (size_t i = 0; i < num_rounds; ++i) {
         round_output = evaluate_small_pippenger_round(msm_data, i, bucket_data, round_output, bits_per_slice);
@@ -405,8 +480,8 @@ template <typename Curve>
 typename Curve::Element MSM<Curve>::pippenger_low_memory_with_transformed_scalars(MSMData& msm_data) noexcept
 {
     const size_t msm_size = msm_data.scalar_indices.size();
-    const size_t bits_per_slice = get_optimal_log_num_buckets(msm_size);
-    const size_t num_buckets = 1 << bits_per_slice;
+    const size_t bits_per_slice = get_optimal_log_num_buckets(msm_size, msm_data.slice_strategy);
+    const size_t num_buckets = get_num_buckets(bits_per_slice, msm_data.slice_strategy);
 
     if (!use_affine_trick(msm_size, num_buckets)) {
         return small_pippenger_low_memory_with_transformed_scalars(msm_data);
@@ -418,7 +493,7 @@ typename Curve::Element MSM<Curve>::pippenger_low_memory_with_transformed_scalar
 
     Element round_output = Curve::Group::point_at_infinity;
 
-    const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
+    const size_t num_rounds = get_num_slices(bits_per_slice, msm_data.slice_strategy);
     for (size_t i = 0; i < num_rounds; ++i) {
         round_output = evaluate_pippenger_round(msm_data, i, affine_data, bucket_data, round_output, bits_per_slice);
     }
@@ -449,17 +524,24 @@ typename Curve::Element MSM<Curve>::evaluate_small_pippenger_round(MSMData& msm_
     std::span<const AffineElement>& points = msm_data.points;
 
     const size_t size = nonzero_scalar_indices.size();
+    const bool signed_digits = msm_data.slice_strategy == SliceStrategy::SignedDigit;
+    const uint256_t digit_offset = signed_digits ? get_signed_digit_offset(bits_per_slice) : uint256_t(0);
     for (size_t i = 0; i < size; ++i) {
         BB_ASSERT_LT(nonzero_scalar_indices[i], scalars.size());
-        uint32_t bucket_index = get_scalar_slice(scalars[nonzero_scalar_indices[i]], round_index, bits_per_slice);
-        BB_ASSERT_LT(bucket_index, static_cast<uint32_t>(1 << bits_per_slice));
+        const ScalarField& scalar = scalars[nonzero_scalar_indices[i]];
+        uint32_t slice = signed_digits ? get_signed_scalar_slice(scalar, round_index, bits_per_slice, digit_offset)
+                                       : get_scalar_slice(scalar, round_index, bits_per_slice);
+        uint32_t bucket_index = slice & ~NEGATIVE_SLICE_FLAG;
+        BB_ASSERT_LT(bucket_index, static_cast<uint32_t>(bucket_data.buckets.size()));
         if (bucket_index > 0) {
+            AffineElement point = points[nonzero_scalar_indices[i]];
+            point.y.self_conditional_negate(static_cast<uint64_t>(slice != bucket_index));
             // do this check because we do not reset bucket_data.buckets after each round
             // (i.e. not neccessarily at infinity)
             if (bucket_data.bucket_exists.get(bucket_index)) {
-                bucket_data.buckets[bucket_index] += points[nonzero_scalar_indices[i]];
+                bucket_data.buckets[bucket_index] += point;
             } else {
-                bucket_data.buckets[bucket_index] = points[nonzero_scalar_indices[i]];
+                bucket_data.buckets[bucket_index] = point;
                 bucket_data.bucket_exists.set(bucket_index, true);
             }
         }
@@ -469,10 +551,11 @@ typename Curve::Element MSM<Curve>::evaluate_small_pippenger_round(MSMData& msm_
     round_output = accumulate_buckets(bucket_data);
     bucket_data.bucket_exists.clear();
     Element result = previous_round_output;
+    // Signed-digit windows are aligned to the least significant bit, so every round is a full slice
     const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
-    size_t num_doublings = ((round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0))
-                               ? NUM_BITS_IN_FIELD % bits_per_slice
-                               : bits_per_slice;
+    const bool short_final_round = (msm_data.slice_strategy == SliceStrategy::Unsigned) &&
+                                   (round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0);
+    size_t num_doublings = short_final_round ? NUM_BITS_IN_FIELD % bits_per_slice : bits_per_slice;
     for (size_t i = 0; i < num_doublings; ++i) {
         result.self_dbl();
     }
@@ -509,11 +592,25 @@ typename Curve::Element MSM<Curve>::evaluate_pippenger_round(MSMData& msm_data,
 
     // Construct a "round schedule". Each entry describes:
     // 1. low 32 bits: which bucket index do we add the point into? (bucket index = slice value)
-    // 2. high 32 bits: which point index do we source the point from?
-    for (size_t i = 0; i < size; ++i) {
-        BB_ASSERT_LT(scalar_indices[i], scalars.size());
-        round_schedule[i] = get_scalar_slice(scalars[scalar_indices[i]], round_index, bits_per_slice);
-        round_schedule[i] += (static_cast<uint64_t>(scalar_indices[i]) << 32ULL);
+    // 2. high 32 bits: which point index do we source the point from? The top bit flags a negated point.
+    const bool signed_digits = msm_data.slice_strategy == SliceStrategy::SignedDigit;
+    if (signed_digits) {
+        const uint256_t digit_offset = get_signed_digit_offset(bits_per_slice);
+        for (size_t i = 0; i < size; ++i) {
+            BB_ASSERT_LT(scalar_indices[i], scalars.size());
+            const uint32_t slice =
+                get_signed_scalar_slice(scalars[scalar_indices[i]], round_index, bits_per_slice, digit_offset);
+            const uint32_t bucket_index = slice & ~NEGATIVE_SLICE_FLAG;
+            round_schedule[i] = bucket_index;
+            round_schedule[i] += (static_cast<uint64_t>(scalar_indices[i]) << 32ULL);
+            round_schedule[i] |= (slice != bucket_index) ? NEGATIVE_POINT_FLAG : 0;
+        }
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            BB_ASSERT_LT(scalar_indices[i], scalars.size());
+            round_schedule[i] = get_scalar_slice(scalars[scalar_indices[i]], round_index, bits_per_slice);
+            round_schedule[i] += (static_cast<uint64_t>(scalar_indices[i]) << 32ULL);
+        }
     }
     // Sort our point schedules based on their bucket values. Reduces memory throughput in next step of algo
     const size_t num_zero_entries = scalar_multiplication::process_buckets_count_zero_entries(
@@ -527,16 +624,17 @@ typename Curve::Element MSM<Curve>::evaluate_pippenger_round(MSMData& msm_data,
     if (round_size > 0) {
         std::span<uint64_t> point_schedule(&round_schedule[num_zero_entries], round_size);
         // Iterate through our point schedule and add points into corresponding buckets
-        consume_point_schedule(point_schedule, points, affine_data, bucket_data, 0, 0);
+        consume_point_schedule(point_schedule, points, affine_data, bucket_data, 0, 0, signed_digits);
         round_output = accumulate_buckets(bucket_data);
         bucket_data.bucket_exists.clear();
     }
 
     Element result = previous_round_output;
+    // Signed-digit windows are aligned to the least significant bit, so every round is a full slice
     const size_t num_rounds = numeric::ceil_div(NUM_BITS_IN_FIELD, bits_per_slice);
-    size_t num_doublings = ((round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0))
-                               ? NUM_BITS_IN_FIELD % bits_per_slice
-                               : bits_per_slice;
+    const bool short_final_round = (msm_data.slice_strategy == SliceStrategy::Unsigned) &&
+                                   (round_index == num_rounds - 1) && (NUM_BITS_IN_FIELD % bits_per_slice != 0);
+    size_t num_doublings = short_final_round ? NUM_BITS_IN_FIELD % bits_per_slice : bits_per_slice;
     for (size_t i = 0; i < num_doublings; ++i) {
         result.self_dbl();
     }
@@ -556,6 +654,7 @@ typename Curve::Element MSM<Curve>::evaluate_pippenger_round(MSMData& msm_data,
  * @param bucket_data
  * @param num_input_points_processed
  * @param num_queued_affine_points
+ * @param has_negative_points whether schedule entries may carry NEGATIVE_POINT_FLAG (signed-digit slicing)
  */
 template <typename Curve>
 void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule,
@@ -563,7 +662,8 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
                                         MSM<Curve>::AffineAdditionData& affine_data,
                                         MSM<Curve>::BucketAccumulators& bucket_data,
                                         size_t num_input_points_processed,
-                                        size_t num_queued_affine_points) noexcept
+                                        size_t num_queued_affine_points,
+                                        bool has_negative_points) noexcept
 {
 
     size_t point_it = num_input_points_processed;
@@ -594,7 +694,7 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
         // we prefetchin'
         if ((point_it < prefetch_max) && ((point_it & 0x0f) == 0)) {
             for (size_t i = 16; i < 32; ++i) {
-                __builtin_prefetch(&points[(point_schedule[point_it + i] >> 32ULL)]);
+                __builtin_prefetch(&points[(point_schedule[point_it + i] >> 32ULL) & POINT_INDEX_MASK]);
             }
         }
 
@@ -614,8 +714,8 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
         uint64_t rhs_schedule = point_schedule[point_it + 1];
         size_t lhs_bucket = static_cast<size_t>(lhs_schedule) & 0xFFFFFFFF;
         size_t rhs_bucket = static_cast<size_t>(rhs_schedule) & 0xFFFFFFFF;
-        size_t lhs_point = static_cast<size_t>(lhs_schedule >> 32);
-        size_t rhs_point = static_cast<size_t>(rhs_schedule >> 32);
+        size_t lhs_point = static_cast<size_t>(lhs_schedule >> 32) & POINT_INDEX_MASK;
+        size_t rhs_point = static_cast<size_t>(rhs_schedule >> 32) & POINT_INDEX_MASK;
 
         bool has_bucket_accumulator = bucket_accumulator_exists.get(lhs_bucket);
         bool buckets_match = lhs_bucket == rhs_bucket;
@@ -638,6 +738,11 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
         // unconditional swap. No if statements here.
         *lhs_destination = *lhs_source;
         *rhs_destination = *rhs_source;
+        if (has_negative_points) {
+            // rhs is only sourced from the input points if the buckets match, otherwise it is a bucket accumulator
+            lhs_destination->y.self_conditional_negate(lhs_schedule >> 63);
+            rhs_destination->y.self_conditional_negate(static_cast<uint64_t>(buckets_match) & (rhs_schedule >> 63));
+        }
 
         // indicate whether bucket_accumulators[lhs_bucket] will contain a point after this iteration
         bucket_accumulator_exists.set(
@@ -653,11 +758,15 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
     if (point_it == num_points - 1) {
         uint64_t lhs_schedule = point_schedule[point_it];
         size_t lhs_bucket = static_cast<size_t>(lhs_schedule) & 0xFFFFFFFF;
-        size_t lhs_point = static_cast<size_t>(lhs_schedule >> 32);
+        size_t lhs_point = static_cast<size_t>(lhs_schedule >> 32) & POINT_INDEX_MASK;
         bool has_bucket_accumulator = bucket_accumulator_exists.get(lhs_bucket);
+        AffineElement lhs_value = points[lhs_point];
+        if (has_negative_points) {
+            lhs_value.y.self_conditional_negate(lhs_schedule >> 63);
+        }
 
         if (has_bucket_accumulator) { // point is added to its bucket accumulator
-            affine_addition_scratch_space[affine_input_it] = points[lhs_point];
+            affine_addition_scratch_space[affine_input_it] = lhs_value;
             affine_addition_scratch_space[affine_input_it + 1] = bucket_accumulators[lhs_bucket];
             bucket_accumulator_exists.set(lhs_bucket, false);
             affine_addition_output_bucket_destinations[affine_input_it >> 1] = lhs_bucket;
@@ -665,7 +774,7 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
             point_it += 1;
         } else { // otherwise, cache the point into the bucket
             BB_ASSERT_LT(lhs_point, points.size());
-            bucket_accumulators[lhs_bucket] = points[lhs_point];
+            bucket_accumulators[lhs_bucket] = lhs_value;
             bucket_accumulator_exists.set(lhs_bucket, true);
             point_it += 1;
         }
@@ -742,7 +851,8 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
     // If we have not finished iterating over the point schedule,
     // OR we have affine additions to perform in the scratch space, continue
     if (point_it < num_points || new_scratch_space_it != 0) {
-        consume_point_schedule(point_schedule, points, affine_data, bucket_data, point_it, new_scratch_space_it);
+        consume_point_schedule(
+            point_schedule, points, affine_data, bucket_data, point_it, new_scratch_space_it, has_negative_points);
     }
 }
 
@@ -757,13 +867,16 @@ void MSM<Curve>::consume_point_schedule(std::span<const uint64_t> point_schedule
  * @tparam Curve
  * @param points
  * @param scalars
+ * @param handle_edge_cases
+ * @param slice_strategy how scalars are sliced into bucket indices (see SliceStrategy)
  * @return std::vector<typename Curve::AffineElement>
  */
 template <typename Curve>
 std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
     std::vector<std::span<const typename Curve::AffineElement>>& points,
     std::vector<std::span<ScalarField>>& scalars,
-    bool handle_edge_cases) noexcept
+    bool handle_edge_cases,
+    SliceStrategy slice_strategy) noexcept
 {
     BB_ASSERT_EQ(points.size(), scalars.size());
     const size_t num_msms = points.size();
@@ -779,13 +892,30 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
         if (!thread_work_units[thread_idx].empty()) {
             const std::vector<MSMWorkUnit>& msms = thread_work_units[thread_idx];
             std::vector<std::pair<Element, size_t>>& msm_results = thread_msm_results[thread_idx];
-            for (const MSMWorkUnit& msm : msms) {
+            // For file-backed scalars (slow_low_memory mode), read in the scalars of the next work unit while the
+            // current one is processed
+            const auto prefetch_work_unit = [&](const MSMWorkUnit& msm) {
+                if (msm.size == 0) {
+                    return;
+                }
+                const auto& indices = msm_scalar_indices[msm.batch_msm_index];
+                const size_t first = indices[msm.start_index];
+                const size_t last = indices[msm.start_index + msm.size - 1];
+                file_backed_memory::prefetch(&scalars[msm.batch_msm_index][first], last - first + 1);
+            };
+            const bool prefetch_scalars = file_backed_memory::is_active();
+            for (size_t unit_idx = 0; unit_idx < msms.size(); ++unit_idx) {
+                const MSMWorkUnit& msm = msms[unit_idx];
+                if (prefetch_scalars && unit_idx + 1 < msms.size()) {
+                    prefetch_work_unit(msms[unit_idx + 1]);
+                }
                 std::span<const ScalarField> work_scalars = scalars[msm.batch_msm_index];
                 std::span<const AffineElement> work_points = points[msm.batch_msm_index];
                 std::span<const uint32_t> work_indices =
                     std::span<const uint32_t>{ &msm_scalar_indices[msm.batch_msm_index][msm.start_index], msm.size };
                 std::vector<uint64_t> point_schedule(msm.size);
-                MSMData msm_data(work_scalars, work_points, work_indices, std::span<uint64_t>(point_schedule));
+                MSMData msm_data(
+                    work_scalars, work_points, work_indices, std::span<uint64_t>(point_schedule), slice_strategy);
                 Element msm_result = Curve::Group::point_at_infinity;
                 constexpr size_t SINGLE_MUL_THRESHOLD = 16;
                 if (msm.size < SINGLE_MUL_THRESHOLD) {
@@ -840,12 +970,15 @@ std::vector<typename Curve::AffineElement> MSM<Curve>::batch_multi_scalar_mul(
  * @tparam Curve
  * @param points
  * @param _scalars
+ * @param handle_edge_cases
+ * @param slice_strategy
  * @return Curve::AffineElement
  */
 template <typename Curve>
 typename Curve::AffineElement MSM<Curve>::msm(std::span<const typename Curve::AffineElement> points,
                                               PolynomialSpan<const ScalarField> _scalars,
-                                              bool handle_edge_cases) noexcept
+                                              bool handle_edge_cases,
+                                              SliceStrategy slice_strategy) noexcept
 {
     if (_scalars.size() == 0) {
         return Curve::Group::affine_point_at_infinity;
@@ -860,7 +993,7 @@ typename Curve::AffineElement MSM<Curve>::msm(std::span<const typename Curve::Af
 
     std::vector<std::span<const AffineElement>> pp{ points.subspan(_scalars.start_index) };
     std::vector<std::span<ScalarField>> ss{ std::span<ScalarField>(scalars, _scalars.size()) };
-    AffineElement result = batch_multi_scalar_mul(pp, ss, handle_edge_cases)[0];
+    AffineElement result = batch_multi_scalar_mul(pp, ss, handle_edge_cases, slice_strategy)[0];
     return result;
 }
 
@@ -22,6 +22,22 @@ template <typename Curve> class MSM {
     using G1 = AffineElement;
     static constexpr size_t NUM_BITS_IN_FIELD = ScalarField::modulus.get_msb() + 1;
 
+    /**
+     * @brief How a scalar is cut into per-round bucket indices
+     * @details Unsigned: c-bit slices in [0, 2^c), requiring 2^c buckets per round.
+     *          SignedDigit: digits in [-2^{c-1}, 2^{c-1}], requiring 2^{c-1} + 1 buckets per round. A negative digit
+     *          adds the negated point (free in affine form) into bucket |digit|. Windows are aligned to the least
+     *          significant bit and one extra bit is needed to absorb the final carry.
+     *          As P and -P share an x-coordinate, the affine trick's requirement that the points are linearly
+     *          independent matters more here: only use SignedDigit without edge-case handling on independent points
+     *          such as the SRS.
+     */
+    enum class SliceStrategy { Unsigned, SignedDigit };
+    // Set on a signed slice / on a point schedule entry (top bit of the point index) if the point must be negated
+    static constexpr uint32_t NEGATIVE_SLICE_FLAG = 1U << 31;
+    static constexpr uint64_t NEGATIVE_POINT_FLAG = 1ULL << 63;
+    static constexpr uint64_t POINT_INDEX_MASK = 0x7FFFFFFF;
+
     /**
      * @brief MSMWorkUnit describes an MSM that may be part of a larger MSM
      * @details For a multi-MSM where each MSM has a variable size, we want to split the MSMs up
@@ -41,6 +57,7 @@ template <typename Curve> class MSM {
         std::span<const AffineElement> points;
         std::span<const uint32_t> scalar_indices;
         std::span<uint64_t> point_schedule;
+        SliceStrategy slice_strategy = SliceStrategy::Unsigned;
     };
 
     /**
@@ -97,7 +114,26 @@ template <typename Curve> class MSM {
     static std::vector<ThreadWorkUnits> get_work_units(std::vector<std::span<ScalarField>>& scalars,
                                                        std::vector<std::vector<uint32_t>>& msm_scalar_indices) noexcept;
     static uint32_t get_scalar_slice(const ScalarField& scalar, size_t round, size_t normal_slice_size) noexcept;
-    static size_t get_optimal_log_num_buckets(const size_t num_points) noexcept;
+    static uint32_t get_signed_scalar_slice(const ScalarField& scalar,
+                                            size_t round,
+                                            size_t slice_size,
+                                            const uint256_t& digit_offset) noexcept;
+    static uint256_t get_signed_digit_offset(size_t slice_size) noexcept;
+    static size_t get_num_slices(size_t bits_per_slice, SliceStrategy slice_strategy) noexcept
+    {
+        // Signed digits need one extra bit to absorb the carry out of the most significant window
+        const size_t num_bits = NUM_BITS_IN_FIELD + (slice_strategy == SliceStrategy::SignedDigit ? 1 : 0);
+        return (num_bits + bits_per_slice - 1) / bits_per_slice;
+    }
+    static size_t get_num_buckets(size_t bits_per_slice, SliceStrategy slice_strategy) noexcept
+    {
+        if (slice_strategy == SliceStrategy::SignedDigit) {
+            return (static_cast<size_t>(1) << (bits_per_slice - 1)) + 1;
+        }
+        return static_cast<size_t>(1) << bits_per_slice;
+    }
+    static size_t get_optimal_log_num_buckets(const size_t num_points,
+                                              const SliceStrategy slice_strategy = SliceStrategy::Unsigned) noexcept;
     static bool use_affine_trick(const size_t num_points, const size_t num_buckets) noexcept;
 
     static Element small_pippenger_low_memory_with_transformed_scalars(MSMData& msm_data) noexcept;
@@ -120,14 +156,18 @@ template <typename Curve> class MSM {
                                        AffineAdditionData& affine_data,
                                        BucketAccumulators& bucket_data,
                                        size_t num_input_points_processed,
-                                       size_t num_queued_affine_points) noexcept;
-
-    static std::vector<AffineElement> batch_multi_scalar_mul(std::vector<std::span<const AffineElement>>& points,
-                                                             std::vector<std::span<ScalarField>>& scalars,
-                                                             bool handle_edge_cases = true) noexcept;
+                                       size_t num_queued_affine_points,
+                                       bool has_negative_points = false) noexcept;
+
+    static std::vector<AffineElement> batch_multi_scalar_mul(
+        std::vector<std::span<const AffineElement>>& points,
+        std::vector<std::span<ScalarField>>& scalars,
+        bool handle_edge_cases = true,
+        SliceStrategy slice_strategy = SliceStrategy::Unsigned) noexcept;
     static AffineElement msm(std::span<const AffineElement> points,
                              PolynomialSpan<const ScalarField> _scalars,
-                             bool handle_edge_cases = false) noexcept;
+                             bool handle_edge_cases = false,
+                             SliceStrategy slice_strategy = SliceStrategy::Unsigned) noexcept;
 
     template <typename BucketType> static Element accumulate_buckets(BucketType& bucket_accumulators) noexcept
     {
@@ -446,6 +446,82 @@ TYPED_TEST(ScalarMultiplicationTest, MSM)
     EXPECT_EQ(result, expected);
 }
 
+TYPED_TEST(ScalarMultiplicationTest, SignedScalarSlicesRecompose)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using MSM = scalar_multiplication::MSM<Curve>;
+    using SliceStrategy = typename MSM::SliceStrategy;
+
+    for (size_t slice_bits = 2; slice_bits <= 20; ++slice_bits) {
+        const size_t num_slices = MSM::get_num_slices(slice_bits, SliceStrategy::SignedDigit);
+        const size_t num_buckets = MSM::get_num_buckets(slice_bits, SliceStrategy::SignedDigit);
+        const uint256_t digit_offset = MSM::get_signed_digit_offset(slice_bits);
+        const ScalarField shift = ScalarField(uint256_t(1) << slice_bits);
+        // -1 has all of its top bits set, which exercises the carry into the most significant window
+        for (ScalarField scalar : { ScalarField::random_element(&engine), ScalarField(-1), ScalarField(1) }) {
+            const ScalarField input = scalar.from_montgomery_form();
+            ScalarField recomposed = 0;
+            for (size_t round = 0; round < num_slices; ++round) {
+                const uint32_t slice = MSM::get_signed_scalar_slice(input, round, slice_bits, digit_offset);
+                const uint32_t bucket_index = slice & ~MSM::NEGATIVE_SLICE_FLAG;
+                EXPECT_LT(bucket_index, num_buckets);
+                const ScalarField digit = ScalarField(static_cast<uint64_t>(bucket_index));
+                recomposed = recomposed * shift + (slice == bucket_index ? digit : -digit);
+            }
+            EXPECT_EQ(recomposed, scalar);
+        }
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTest, MSMSignedDigit)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+    using MSM = scalar_multiplication::MSM<Curve>;
+
+    const size_t start_index = 1234;
+    const size_t num_points = TestFixture::num_points - start_index;
+
+    PolynomialSpan<ScalarField> scalar_span =
+        PolynomialSpan<ScalarField>(start_index, std::span<ScalarField>(&TestFixture::scalars[0], num_points));
+    AffineElement result = MSM::msm(TestFixture::generators, scalar_span, false, MSM::SliceStrategy::SignedDigit);
+
+    AffineElement expected = MSM::msm(TestFixture::generators, scalar_span);
+    EXPECT_EQ(result, expected);
+}
+
+TYPED_TEST(ScalarMultiplicationTest, BatchMultiScalarMulSignedDigit)
+{
+    SCALAR_MULTIPLICATION_TYPE_ALIASES
+    using AffineElement = typename Curve::AffineElement;
+    using MSM = scalar_multiplication::MSM<Curve>;
+
+    // A mix of sizes that take the Jacobian (small) and the affine-trick code paths
+    const std::vector<size_t> msm_sizes = { 1, 7, 33, 400, 5000 };
+    std::vector<AffineElement> expected(msm_sizes.size());
+
+    std::vector<std::span<const AffineElement>> batch_points_span;
+    std::vector<std::span<ScalarField>> batch_scalars_spans;
+
+    size_t vector_offset = 0;
+    for (size_t k = 0; k < msm_sizes.size(); ++k) {
+        const size_t num_points = msm_sizes[k];
+        std::span<ScalarField> batch_scalars(&TestFixture::scalars[vector_offset], num_points);
+        std::span<const AffineElement> batch_points(&TestFixture::generators[vector_offset], num_points);
+
+        vector_offset += num_points;
+        batch_points_span.push_back(batch_points);
+        batch_scalars_spans.push_back(batch_scalars);
+
+        expected[k] = TestFixture::naive_msm(batch_scalars_spans[k], batch_points_span[k]);
+    }
+
+    std::vector<AffineElement> result = MSM::batch_multi_scalar_mul(
+        batch_points_span, batch_scalars_spans, true, MSM::SliceStrategy::SignedDigit);
+
+    EXPECT_EQ(result, expected);
+}
+
 TYPED_TEST(ScalarMultiplicationTest, MSMAllZeroes)
 {
     SCALAR_MULTIPLICATION_TYPE_ALIASES
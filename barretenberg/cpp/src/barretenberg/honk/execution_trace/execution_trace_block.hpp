@@ -312,6 +312,37 @@ template <typename FF, size_t NUM_WIRES_> class ExecutionTraceBlock {
         this->wires[3].emplace_back(idx_4);
     }
 
+    /**
+     * @brief Append the gates of a block of another builder, mapping its variable indices into this builder
+     *
+     * @param other A block of the same type
+     * @param map_variable Maps a variable index of the other builder to one of this builder
+     */
+    template <typename VariableMap> void append(ExecutionTraceBlock& other, const VariableMap& map_variable)
+    {
+        for (size_t wire_idx = 0; wire_idx < NUM_WIRES; ++wire_idx) {
+            auto& wire = this->wires[wire_idx];
+            wire.reserve(wire.size() + other.wires[wire_idx].size());
+            for (const uint32_t variable_index : other.wires[wire_idx]) {
+                wire.emplace_back(map_variable(variable_index));
+            }
+        }
+        auto selectors = get_selectors();
+        auto other_selectors = other.get_selectors();
+        for (size_t selector_idx = 0; selector_idx < selectors.size(); ++selector_idx) {
+            auto& selector = selectors[selector_idx];
+            const auto& other_selector = other_selectors[selector_idx];
+            for (size_t i = 0; i < other_selector.size(); ++i) {
+                selector.push_back(other_selector[i]);
+            }
+        }
+#ifdef CHECK_CIRCUIT_STACKTRACES
+        stack_traces.stack_traces.insert(stack_traces.stack_traces.end(),
+                                         other.stack_traces.stack_traces.begin(),
+                                         other.stack_traces.stack_traces.end());
+#endif
+    }
+
     auto& w_l() { return std::get<0>(this->wires); };
     auto& w_r() { return std::get<1>(this->wires); };
     auto& w_o() { return std::get<2>(this->wires); };
@@ -82,4 +82,9 @@ uint64_t LMDBEnvironment::get_data_file_size() const
     }
     return 0;
 }
+
+void LMDBEnvironment::sync()
+{
+    call_lmdb_func("mdb_env_sync", mdb_env_sync, _mdbEnv, 1);
+}
 } // namespace bb::lmdblib
@@ -50,6 +50,11 @@ class LMDBEnvironment {
 
     uint64_t get_data_file_size() const;
 
+    /**
+     * @brief Flushes all committed transactions to disk, including those committed with a deferred sync
+     */
+    void sync();
+
   private:
     std::atomic_uint64_t _id;
     std::string _directory;
@@ -18,8 +18,10 @@
 #include "barretenberg/lmdblib/lmdb_db_transaction.hpp"
 #include "barretenberg/lmdblib/lmdb_environment.hpp"
 #include "barretenberg/lmdblib/lmdb_read_transaction.hpp"
+#include "barretenberg/lmdblib/lmdb_write_batch.hpp"
 #include "barretenberg/lmdblib/lmdb_write_transaction.hpp"
 #include "barretenberg/lmdblib/queries.hpp"
+#include "lmdb.h"
 
 using namespace bb::lmdblib;
 
@@ -119,6 +121,116 @@ TEST_F(LMDBEnvironmentTest, can_read_from_database)
     }
 }
 
+TEST_F(LMDBEnvironmentTest, can_apply_write_batch)
+{
+    LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
+        LMDBEnvironmentTest::_directory, LMDBEnvironmentTest::_mapSize, 1, LMDBEnvironmentTest::_maxReaders);
+    LMDBDatabase::SharedPtr db;
+
+    {
+        environment->wait_for_writer();
+        LMDBDatabaseCreationTransaction tx(environment);
+        db = std::make_unique<LMDBDatabase>(environment, tx, "DB", false, false);
+        EXPECT_NO_THROW(tx.commit());
+    }
+
+    {
+        environment->wait_for_writer();
+        LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+        auto key = get_key(0);
+        auto data = get_value(0, 0);
+        EXPECT_NO_THROW(tx->put_value(key, data, *db));
+        EXPECT_NO_THROW(tx->commit());
+    }
+
+    environment->wait_for_reader();
+    LMDBReadTransaction::Ptr readTx = std::make_unique<LMDBReadTransaction>(environment);
+    LMDBWriteBatch batch(*readTx);
+    {
+        // Reads fall through to the transaction until the key is written to the batch
+        auto key = get_key(0);
+        std::vector<uint8_t> data;
+        EXPECT_TRUE(batch.get_value(key, data, *db));
+        EXPECT_EQ(data, get_value(0, 0));
+
+        auto updated = get_value(0, 1);
+        batch.put_value(key, updated, *db);
+        auto newKey = get_key(1);
+        auto newData = get_value(1, 0);
+        batch.put_value(newKey, newData, *db);
+        auto latest = get_value(1, 1);
+        batch.put_value(newKey, latest, *db);
+
+        EXPECT_TRUE(batch.get_value(key, data, *db));
+        EXPECT_EQ(data, updated);
+        EXPECT_EQ(batch.size(), 2UL);
+    }
+    readTx.reset();
+
+    {
+        environment->wait_for_writer();
+        LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+        batch.apply(*tx);
+        EXPECT_NO_THROW(tx->commit_deferring_sync());
+    }
+    EXPECT_NO_THROW(environment->sync());
+
+    {
+        environment->wait_for_reader();
+        LMDBReadTransaction::Ptr tx = std::make_unique<LMDBReadTransaction>(environment);
+        for (int64_t count = 0; count < 2; count++) {
+            auto key = get_key(count);
+            std::vector<uint8_t> data;
+            EXPECT_TRUE(tx->get_value(key, data, *db));
+            EXPECT_EQ(data, get_value(count, 1));
+        }
+    }
+}
+
+TEST_F(LMDBEnvironmentTest, deferred_sync_flags_are_restored)
+{
+    LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
+        LMDBEnvironmentTest::_directory, LMDBEnvironmentTest::_mapSize, 1, LMDBEnvironmentTest::_maxReaders);
+    LMDBDatabase::SharedPtr db;
+
+    {
+        environment->wait_for_writer();
+        LMDBDatabaseCreationTransaction tx(environment);
+        db = std::make_unique<LMDBDatabase>(environment, tx, "DB", false, false);
+        EXPECT_NO_THROW(tx.commit());
+    }
+
+    auto get_sync_flags = [&]() {
+        unsigned int flags = 0;
+        mdb_env_get_flags(environment->underlying(), &flags);
+        return flags & static_cast<unsigned int>(MDB_NOSYNC | MDB_NOMETASYNC);
+    };
+    EXPECT_EQ(get_sync_flags(), 0U);
+
+    {
+        environment->wait_for_writer();
+        LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+        auto key = get_key(0);
+        auto data = get_value(0, 0);
+        tx->put_value(key, data, *db);
+        EXPECT_NO_THROW(tx->commit_deferring_sync());
+    }
+    EXPECT_EQ(get_sync_flags(), 0U);
+
+    {
+        // Committing an aborted transaction throws, the flags must still be reset
+        environment->wait_for_writer();
+        LMDBWriteTransaction::Ptr tx = std::make_unique<LMDBWriteTransaction>(environment);
+        auto key = get_key(1);
+        auto data = get_value(1, 0);
+        tx->put_value(key, data, *db);
+        tx->try_abort();
+        EXPECT_THROW(tx->commit_deferring_sync(), std::runtime_error);
+    }
+    EXPECT_EQ(get_sync_flags(), 0U);
+    EXPECT_NO_THROW(environment->sync());
+}
+
 TEST_F(LMDBEnvironmentTest, can_write_and_read_multiple)
 {
     LMDBEnvironment::SharedPtr environment = std::make_shared<LMDBEnvironment>(
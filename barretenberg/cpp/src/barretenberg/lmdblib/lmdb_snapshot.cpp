@@ -0,0 +1,340 @@
+#include "barretenberg/lmdblib/lmdb_snapshot.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/crypto/sha256/sha256.hpp"
+#include "barretenberg/lmdblib/lmdb_helpers.hpp"
+#include "lmdb.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <unordered_set>
+
+namespace bb::lmdblib {
+
+namespace {
+const std::string MANIFEST_FILE = "manifest";
+const std::string CHUNKS_DIR = "chunks";
+const uint32_t SNAPSHOT_VERSION = 1;
+const size_t CHECKSUM_SIZE = sizeof(crypto::Sha256Hash);
+// Once a chunk has reached its minimum size, it ends after a key whose hash has these bits clear
+const uint64_t CHUNK_BOUNDARY_MASK = 63;
+
+std::string to_hex(const crypto::Sha256Hash& bytes)
+{
+    static constexpr char digits[] = "0123456789abcdef";
+    std::string hex;
+    hex.reserve(bytes.size() * 2);
+    for (uint8_t byte : bytes) {
+        hex.push_back(digits[byte >> 4]);
+        hex.push_back(digits[byte & 0xf]);
+    }
+    return hex;
+}
+
+// FNV-1a, only used to place chunk boundaries
+uint64_t key_hash(const MDB_val& key)
+{
+    uint64_t hash = 14695981039346656037UL;
+    const auto* data = static_cast<const uint8_t*>(key.mv_data);
+    for (size_t i = 0; i < key.mv_size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211UL;
+    }
+    return hash;
+}
+
+std::vector<uint8_t> read_file(const std::filesystem::path& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        throw std::runtime_error("Unable to open snapshot file " + path.string());
+    }
+    return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+}
+
+void write_file(const std::filesystem::path& path, const std::vector<uint8_t>& data)
+{
+    // Written under a temporary name first so a partially written file is never taken for a complete one
+    std::filesystem::path tmpPath = path;
+    tmpPath += ".tmp";
+    {
+        std::ofstream file(tmpPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        if (!file) {
+            throw std::runtime_error("Unable to write snapshot file " + tmpPath.string());
+        }
+    }
+    std::filesystem::rename(tmpPath, path);
+}
+
+void append_val(std::vector<uint8_t>& buffer, const MDB_val& val)
+{
+    using serialize::write;
+    write(buffer, static_cast<uint32_t>(val.mv_size));
+    const auto* data = static_cast<const uint8_t*>(val.mv_data);
+    buffer.insert(buffer.end(), data, data + val.mv_size);
+}
+
+MDB_val read_val(const uint8_t*& it, const uint8_t* end)
+{
+    using serialize::read;
+    uint32_t size = 0;
+    if (static_cast<size_t>(end - it) < sizeof(size)) {
+        throw std::runtime_error("Snapshot chunk is truncated");
+    }
+    read(it, size);
+    if (static_cast<size_t>(end - it) < size) {
+        throw std::runtime_error("Snapshot chunk is truncated");
+    }
+    MDB_val val{ size, const_cast<uint8_t*>(it) };
+    it += size;
+    return val;
+}
+
+struct CursorGuard {
+    MDB_cursor* cursor = nullptr;
+
+    CursorGuard(const LMDBReadTransaction& tx, const LMDBDatabase& db)
+    {
+        call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), db.underlying(), &cursor);
+    }
+    CursorGuard(const CursorGuard& other) = delete;
+    CursorGuard(CursorGuard&& other) = delete;
+    CursorGuard& operator=(const CursorGuard& other) = delete;
+    CursorGuard& operator=(CursorGuard&& other) = delete;
+    ~CursorGuard() { call_lmdb_func(mdb_cursor_close, cursor); }
+};
+
+/**
+ * Writes each distinct chunk once, skipping those held by the base snapshot, at no more than the configured rate
+ */
+class ChunkWriter {
+  public:
+    ChunkWriter(std::filesystem::path chunksDir, std::unordered_set<std::string> baseChunks, uint64_t maxBytesPerSecond)
+        : _chunksDir(std::move(chunksDir))
+        , _baseChunks(std::move(baseChunks))
+        , _maxBytesPerSecond(maxBytesPerSecond)
+        , _start(std::chrono::steady_clock::now())
+    {}
+
+    std::string write(const std::vector<uint8_t>& chunk, SnapshotStats& stats)
+    {
+        std::string checksum = to_hex(crypto::sha256(chunk));
+        if (_baseChunks.contains(checksum)) {
+            ++stats.chunksReused;
+            return checksum;
+        }
+        std::filesystem::path path = _chunksDir / checksum;
+        if (std::filesystem::exists(path)) {
+            return checksum;
+        }
+        write_file(path, chunk);
+        ++stats.chunksWritten;
+        stats.bytesWritten += chunk.size();
+        throttle(chunk.size());
+        return checksum;
+    }
+
+  private:
+    std::filesystem::path _chunksDir;
+    std::unordered_set<std::string> _baseChunks;
+    uint64_t _maxBytesPerSecond;
+    uint64_t _bytesWritten = 0;
+    std::chrono::steady_clock::time_point _start;
+
+    void throttle(uint64_t bytes)
+    {
+        if (_maxBytesPerSecond == 0) {
+            return;
+        }
+        _bytesWritten += bytes;
+        std::chrono::duration<double> due(static_cast<double>(_bytesWritten) / static_cast<double>(_maxBytesPerSecond));
+        std::this_thread::sleep_until(_start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(due));
+    }
+};
+
+std::vector<uint8_t> read_chunk(const std::vector<std::filesystem::path>& chunkDirs, const std::string& checksum)
+{
+    for (const auto& dir : chunkDirs) {
+        std::filesystem::path path = dir / checksum;
+        if (!std::filesystem::exists(path)) {
+            continue;
+        }
+        std::vector<uint8_t> chunk = read_file(path);
+        if (to_hex(crypto::sha256(chunk)) != checksum) {
+            throw std::runtime_error("Snapshot chunk " + path.string() + " failed its checksum");
+        }
+        return chunk;
+    }
+    throw std::runtime_error("Unable to find snapshot chunk " + checksum);
+}
+} // namespace
+
+void SnapshotManifest::write(const std::string& snapshotPath) const
+{
+    using serialize::write;
+    std::vector<uint8_t> buffer;
+    write(buffer, SNAPSHOT_VERSION);
+    write(buffer, baseSnapshotPath);
+    write(buffer, static_cast<uint32_t>(databases.size()));
+    for (const auto& db : databases) {
+        write(buffer, db.name);
+        write(buffer, db.numEntries);
+        write(buffer, db.chunks);
+    }
+    crypto::Sha256Hash checksum = crypto::sha256(buffer);
+    buffer.insert(buffer.end(), checksum.begin(), checksum.end());
+    write_file(std::filesystem::path(snapshotPath) / MANIFEST_FILE, buffer);
+}
+
+SnapshotManifest SnapshotManifest::read(const std::string& snapshotPath)
+{
+    std::filesystem::path path = std::filesystem::path(snapshotPath) / MANIFEST_FILE;
+    std::vector<uint8_t> buffer = read_file(path);
+    if (buffer.size() < CHECKSUM_SIZE) {
+        throw std::runtime_error("Snapshot manifest " + path.string() + " is truncated");
+    }
+    std::vector<uint8_t> checksum(buffer.end() - CHECKSUM_SIZE, buffer.end());
+    buffer.resize(buffer.size() - CHECKSUM_SIZE);
+    if (crypto::sha256(buffer) != checksum) {
+        throw std::runtime_error("Snapshot manifest " + path.string() + " failed its checksum");
+    }
+
+    using serialize::read;
+    const uint8_t* it = buffer.data();
+    uint32_t version = 0;
+    read(it, version);
+    if (version != SNAPSHOT_VERSION) {
+        throw std::runtime_error("Unsupported snapshot version " + std::to_string(version));
+    }
+    SnapshotManifest manifest;
+    read(it, manifest.baseSnapshotPath);
+    uint32_t numDatabases = 0;
+    read(it, numDatabases);
+    manifest.databases.resize(numDatabases);
+    for (auto& db : manifest.databases) {
+        read(it, db.name);
+        read(it, db.numEntries);
+        read(it, db.chunks);
+    }
+    return manifest;
+}
+
+SnapshotStats export_snapshot(const std::vector<const LMDBDatabase*>& databases,
+                              LMDBReadTransaction& tx,
+                              const std::string& dstPath,
+                              const SnapshotOptions& options)
+{
+    if (options.chunkSize == 0) {
+        throw std::runtime_error("Snapshot chunk size must be greater than 0");
+    }
+    SnapshotManifest manifest;
+    std::unordered_set<std::string> baseChunks;
+    if (options.baseSnapshotPath.has_value()) {
+        manifest.baseSnapshotPath = std::filesystem::absolute(options.baseSnapshotPath.value()).string();
+        for (const auto& db : SnapshotManifest::read(manifest.baseSnapshotPath).databases) {
+            baseChunks.insert(db.chunks.begin(), db.chunks.end());
+        }
+    }
+
+    std::filesystem::path chunksDir = std::filesystem::path(dstPath) / CHUNKS_DIR;
+    std::filesystem::create_directories(chunksDir);
+    ChunkWriter writer(chunksDir, std::move(baseChunks), options.maxBytesPerSecond);
+    const uint64_t minChunkSize = options.chunkSize / 2;
+    const uint64_t maxChunkSize = options.chunkSize * 2;
+
+    SnapshotStats stats;
+    for (const LMDBDatabase* db : databases) {
+        SnapshotDatabase snapshotDb{ db->name(), 0, {} };
+        CursorGuard guard(tx, *db);
+        std::vector<uint8_t> chunk;
+        MDB_val key;
+        MDB_val value;
+        int rc = mdb_cursor_get(guard.cursor, &key, &value, MDB_FIRST);
+        while (rc == MDB_SUCCESS) {
+            append_val(chunk, key);
+            append_val(chunk, value);
+            ++snapshotDb.numEntries;
+            if (chunk.size() >= maxChunkSize ||
+                (chunk.size() >= minChunkSize && (key_hash(key) & CHUNK_BOUNDARY_MASK) == 0)) {
+                snapshotDb.chunks.push_back(writer.write(chunk, stats));
+                chunk.clear();
+            }
+            rc = mdb_cursor_get(guard.cursor, &key, &value, MDB_NEXT);
+        }
+        if (rc != MDB_NOTFOUND) {
+            throw_error("mdb_cursor_get", rc);
+        }
+        if (!chunk.empty()) {
+            snapshotDb.chunks.push_back(writer.write(chunk, stats));
+        }
+        stats.numEntries += snapshotDb.numEntries;
+        manifest.databases.push_back(std::move(snapshotDb));
+    }
+
+    manifest.write(dstPath);
+    return stats;
+}
+
+void import_snapshot(const std::vector<const LMDBDatabase*>& databases,
+                     const std::string& srcPath,
+                     const std::function<LMDBWriteTransaction::Ptr()>& createTransaction)
+{
+    SnapshotManifest manifest = SnapshotManifest::read(srcPath);
+
+    // Chunks are found in the snapshot itself or else in its chain of base snapshots
+    std::vector<std::filesystem::path> chunkDirs{ std::filesystem::path(srcPath) / CHUNKS_DIR };
+    std::unordered_set<std::string> visited;
+    for (std::string base = manifest.baseSnapshotPath; !base.empty() && visited.insert(base).second;
+         base = SnapshotManifest::read(base).baseSnapshotPath) {
+        chunkDirs.push_back(std::filesystem::path(base) / CHUNKS_DIR);
+    }
+
+    for (const LMDBDatabase* db : databases) {
+        auto snapshotDb = std::find_if(manifest.databases.begin(),
+                                       manifest.databases.end(),
+                                       [&](const SnapshotDatabase& candidate) { return candidate.name == db->name(); });
+        if (snapshotDb == manifest.databases.end()) {
+            throw std::runtime_error("Snapshot " + srcPath + " does not contain database " + db->name());
+        }
+        {
+            LMDBWriteTransaction::Ptr tx = createTransaction();
+            MDB_stat stat;
+            call_lmdb_func("mdb_stat", mdb_stat, tx->underlying(), db->underlying(), &stat);
+            if (stat.ms_entries != 0) {
+                throw std::runtime_error("Unable to import snapshot into non-empty database " + db->name());
+            }
+        }
+
+        // The entries of a key with duplicates can span chunks
+        std::vector<uint8_t> lastKey;
+        uint64_t numEntries = 0;
+        for (const auto& checksum : snapshotDb->chunks) {
+            std::vector<uint8_t> chunk = read_chunk(chunkDirs, checksum);
+            const uint8_t* it = chunk.data();
+            const uint8_t* end = it + chunk.size();
+            // The transaction is aborted on destruction if any entry fails
+            LMDBWriteTransaction::Ptr tx = createTransaction();
+            while (it != end) {
+                MDB_val key = read_val(it, end);
+                MDB_val value = read_val(it, end);
+                const auto* keyData = static_cast<const uint8_t*>(key.mv_data);
+                bool sameKey = std::equal(keyData, keyData + key.mv_size, lastKey.begin(), lastKey.end());
+                unsigned int flags = db->duplicate_keys_permitted() && sameKey ? MDB_APPENDDUP : MDB_APPEND;
+                call_lmdb_func("mdb_put", mdb_put, tx->underlying(), db->underlying(), &key, &value, flags);
+                lastKey.assign(keyData, keyData + key.mv_size);
+                ++numEntries;
+            }
+            tx->commit();
+        }
+        if (numEntries != snapshotDb->numEntries) {
+            throw std::runtime_error("Snapshot database " + db->name() + " is missing entries");
+        }
+    }
+}
+
+} // namespace bb::lmdblib
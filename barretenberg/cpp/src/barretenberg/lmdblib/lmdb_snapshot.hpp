@@ -0,0 +1,87 @@
+#pragma once
+
+#include "barretenberg/lmdblib/lmdb_database.hpp"
+#include "barretenberg/lmdblib/lmdb_read_transaction.hpp"
+#include "barretenberg/lmdblib/lmdb_write_transaction.hpp"
+#include "barretenberg/serialize/msgpack.hpp"
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace bb::lmdblib {
+
+const uint64_t DEFAULT_SNAPSHOT_CHUNK_SIZE = 4UL * 1024 * 1024;
+
+struct SnapshotOptions {
+    // Chunks are cut at content-defined boundaries between half and twice this size
+    uint64_t chunkSize = DEFAULT_SNAPSHOT_CHUNK_SIZE;
+    // The maximum rate at which chunks are written, 0 for no limit
+    uint64_t maxBytesPerSecond = 0;
+    // An earlier snapshot of the same databases, chunks it already holds are referenced rather than written again
+    std::optional<std::string> baseSnapshotPath;
+};
+
+struct SnapshotStats {
+    uint64_t numEntries = 0;
+    uint64_t chunksWritten = 0;
+    uint64_t chunksReused = 0;
+    uint64_t bytesWritten = 0;
+
+    MSGPACK_FIELDS(numEntries, chunksWritten, chunksReused, bytesWritten)
+
+    SnapshotStats& operator+=(const SnapshotStats& other)
+    {
+        numEntries += other.numEntries;
+        chunksWritten += other.chunksWritten;
+        chunksReused += other.chunksReused;
+        bytesWritten += other.bytesWritten;
+        return *this;
+    }
+};
+
+struct SnapshotDatabase {
+    std::string name;
+    uint64_t numEntries = 0;
+    // The checksums of the database's chunks in key order, each chunk is stored in a file named by its checksum
+    std::vector<std::string> chunks;
+};
+
+/**
+ * @brief Describes a snapshot, it is written once all of the snapshot's chunks have been written
+ */
+struct SnapshotManifest {
+    // Empty unless this is a delta snapshot, chunks not found in this snapshot are then read from the base
+    std::string baseSnapshotPath;
+    std::vector<SnapshotDatabase> databases;
+
+    void write(const std::string& snapshotPath) const;
+    static SnapshotManifest read(const std::string& snapshotPath);
+};
+
+/**
+ * @brief Streams the contents of the given databases, as seen by the read transaction, to a snapshot directory
+ *
+ * Every database is walked in key order and its entries are written as checksummed chunks. Chunk boundaries are
+ * chosen from the keys, so entries added or removed since a base snapshot only change the chunks around them and the
+ * rest are shared with the base. Holding the read transaction doesn't block writers, but pages freed while it is
+ * open can't be reused until the export completes.
+ */
+SnapshotStats export_snapshot(const std::vector<const LMDBDatabase*>& databases,
+                              LMDBReadTransaction& tx,
+                              const std::string& dstPath,
+                              const SnapshotOptions& options);
+
+/**
+ * @brief Loads a snapshot into the given databases, which must be empty
+ *
+ * The databases must be opened with the comparators of those they were exported from. Entries are appended in the
+ * order they were exported, a write transaction is committed for each chunk. Every chunk's checksum is verified before
+ * it is loaded.
+ */
+void import_snapshot(const std::vector<const LMDBDatabase*>& databases,
+                     const std::string& srcPath,
+                     const std::function<LMDBWriteTransaction::Ptr()>& createTransaction);
+
+} // namespace bb::lmdblib
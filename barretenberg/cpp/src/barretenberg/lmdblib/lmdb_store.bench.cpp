@@ -0,0 +1,119 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <vector>
+
+#include "barretenberg/lmdblib/fixtures.hpp"
+#include "barretenberg/lmdblib/lmdb_database.hpp"
+#include "barretenberg/lmdblib/lmdb_db_transaction.hpp"
+#include "barretenberg/lmdblib/lmdb_environment.hpp"
+#include "barretenberg/lmdblib/lmdb_read_transaction.hpp"
+#include "barretenberg/lmdblib/lmdb_write_transaction.hpp"
+
+using namespace benchmark;
+using namespace bb::lmdblib;
+
+namespace {
+
+const int64_t NUM_STORED_KEYS = 1 << 20;
+const uint64_t MAP_SIZE_KB = 4 * 1024 * 1024;
+const uint32_t MAX_READERS = 16;
+
+struct BenchStore {
+    std::string directory;
+    LMDBEnvironment::SharedPtr environment;
+    LMDBDatabase::SharedPtr db;
+
+    BenchStore()
+        : directory(random_temp_directory())
+    {
+        std::filesystem::create_directories(directory);
+        environment = std::make_shared<LMDBEnvironment>(directory, MAP_SIZE_KB, 1, MAX_READERS);
+        {
+            environment->wait_for_writer();
+            LMDBDatabaseCreationTransaction tx(environment);
+            db = std::make_unique<LMDBDatabase>(environment, tx, "DB", false, false);
+            tx.commit();
+        }
+        {
+            environment->wait_for_writer();
+            LMDBWriteTransaction tx(environment);
+            for (int64_t count = 0; count < NUM_STORED_KEYS; count++) {
+                auto key = get_key(count);
+                auto value = get_value(count, 0);
+                tx.put_value(key, value, *db);
+            }
+            tx.commit();
+        }
+    }
+    BenchStore(const BenchStore& other) = delete;
+    BenchStore(BenchStore&& other) = delete;
+    BenchStore& operator=(const BenchStore& other) = delete;
+    BenchStore& operator=(BenchStore&& other) = delete;
+
+    ~BenchStore()
+    {
+        db.reset();
+        environment.reset();
+        std::filesystem::remove_all(directory);
+    }
+};
+
+BenchStore& get_store()
+{
+    static BenchStore store;
+    return store;
+}
+
+// Random keys across the whole store, as a batch of sibling path or leaf index requests would ask for
+std::vector<std::vector<uint8_t>> random_keys(size_t numKeys)
+{
+    std::vector<std::vector<uint8_t>> keys;
+    keys.reserve(numKeys);
+    for (size_t count = 0; count < numKeys; count++) {
+        keys.push_back(get_key(static_cast<int64_t>(engine.get_random_uint32() % NUM_STORED_KEYS)));
+    }
+    return keys;
+}
+
+void get_individual(State& state) noexcept
+{
+    BenchStore& store = get_store();
+    std::vector<std::vector<uint8_t>> keys = random_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        store.environment->wait_for_reader();
+        LMDBReadTransaction tx(store.environment);
+        std::vector<std::optional<std::vector<uint8_t>>> values;
+        values.reserve(keys.size());
+        for (auto& key : keys) {
+            std::vector<uint8_t> value;
+            bool found = tx.get_value(key, value, *store.db);
+            values.emplace_back(found ? std::optional<std::vector<uint8_t>>(std::move(value)) : std::nullopt);
+        }
+        DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void get_batched(State& state) noexcept
+{
+    BenchStore& store = get_store();
+    std::vector<std::vector<uint8_t>> keys = random_keys(static_cast<size_t>(state.range(0)));
+    for (auto _ : state) {
+        store.environment->wait_for_reader();
+        LMDBReadTransaction tx(store.environment);
+        std::vector<std::optional<std::vector<uint8_t>>> values;
+        tx.get_values(keys, values, *store.db);
+        DoNotOptimize(values);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(get_individual)->RangeMultiplier(8)->Range(64, 1 << 15)->Unit(kMicrosecond);
+BENCHMARK(get_batched)->RangeMultiplier(8)->Range(64, 1 << 15)->Unit(kMicrosecond);
+
+BENCHMARK_MAIN();
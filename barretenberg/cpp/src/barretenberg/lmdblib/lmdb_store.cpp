@@ -139,13 +139,11 @@ void LMDBStore::get(KeysVector& keys, OptionalValuesVector& values, LMDBDatabase
     values.reserve(keys.size());
     ReadTransaction::SharedPtr tx = create_read_transaction();
     if (!db->duplicate_keys_permitted()) {
-        const LMDBDatabase& dbRef = *db;
-        for (auto& k : keys) {
-            OptionalValues optional;
-            Value value;
-            bool result = tx->get_value(k, value, dbRef);
-            optional = result ? OptionalValues(ValuesVector{ value }) : std::nullopt;
-            values.emplace_back(optional);
+        std::vector<std::optional<Value>> retrieved;
+        tx->get_values(keys, retrieved, *db);
+        for (auto& value : retrieved) {
+            values.emplace_back(value.has_value() ? OptionalValues(ValuesVector{ std::move(value.value()) })
+                                                  : std::nullopt);
         }
         return;
     }
@@ -5,6 +5,7 @@
 #include <chrono>
 #include <cstdlib>
 #include <filesystem>
+#include <iostream>
 #include <memory>
 #include <optional>
 #include <sstream>
@@ -365,6 +366,79 @@ TEST_F(LMDBStoreTest, can_read_missing_keys_from_database)
     EXPECT_FALSE(data[1].has_value());
 }
 
+TEST_F(LMDBStoreTest, can_read_many_unsorted_keys)
+{
+    LMDBStore::Ptr store = create_store();
+    const std::string dbName = "Test Database";
+    store->open_database(dbName);
+
+    // Only the even keys are written
+    int64_t numKeys = 1000;
+    KeyDupValuesVector toWrite;
+    KeyOptionalValuesVector toDelete;
+    for (int64_t count = 0; count < numKeys; count += 2) {
+        toWrite.emplace_back(get_key(count), ValuesVector{ get_value(count, 0) });
+    }
+    LMDBStore::PutData putData = { toWrite, toDelete, dbName };
+    std::vector<LMDBStore::PutData> putDatas = { putData };
+    store->put(putDatas);
+
+    // Request the keys out of order, including missing keys, repeated keys and keys beyond the last one
+    KeysVector keys;
+    OptionalValuesVector expected;
+    for (int64_t count = numKeys + 10; count >= 0; count -= 3) {
+        for (int64_t repeat = 0; repeat < (count % 7 == 0 ? 2 : 1); repeat++) {
+            keys.push_back(get_key(count));
+            bool present = count < numKeys && count % 2 == 0;
+            expected.emplace_back(present ? OptionalValues(ValuesVector{ get_value(count, 0) }) : std::nullopt);
+        }
+    }
+
+    OptionalValuesVector retrieved;
+    store->get(keys, retrieved, dbName);
+    EXPECT_EQ(retrieved, expected);
+
+    KeysVector noKeys;
+    OptionalValuesVector noValues;
+    store->get(noKeys, noValues, dbName);
+    EXPECT_TRUE(noValues.empty());
+}
+
+TEST_F(LMDBStoreTest, batched_reads_match_individual_reads)
+{
+    LMDBStore::Ptr store = create_store();
+    const std::string dbName = "Test Database";
+    store->open_database(dbName);
+
+    int64_t numKeys = 1000;
+    write_test_data({ dbName }, numKeys, 1, *store);
+
+    // Read a random selection of the keys, including repeats and missing keys, as a batch of requests would
+    std::srand(1);
+    KeysVector keys;
+    for (int64_t count = 0; count < numKeys / 2; count++) {
+        keys.push_back(get_key(std::rand() % (numKeys + numKeys / 10)));
+    }
+
+    OptionalValuesVector individual;
+    {
+        LMDBStore::ReadTransaction::SharedPtr tx = store->create_shared_read_transaction();
+        LMDBStore::Cursor::Ptr cursor = store->create_cursor(tx, dbName);
+        for (auto& key : keys) {
+            KeyDupValuesVector keyValuePairs;
+            if (cursor->set_at_key(key)) {
+                cursor->read_next(1, keyValuePairs);
+            }
+            individual.emplace_back(keyValuePairs.empty() ? std::nullopt : OptionalValues(keyValuePairs[0].second));
+        }
+    }
+
+    OptionalValuesVector batched;
+    store->get(keys, batched, dbName);
+
+    EXPECT_EQ(batched, individual);
+}
+
 TEST_F(LMDBStoreTest, can_write_and_delete)
 {
     LMDBStore::Ptr store = create_store(2);
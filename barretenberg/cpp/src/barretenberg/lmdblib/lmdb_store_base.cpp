@@ -30,6 +30,11 @@ LMDBStoreBase::WriteTransaction::Ptr LMDBStoreBase::create_write_transaction() c
     return std::make_unique<WriteTransaction>(_environment);
 }
 
+void LMDBStoreBase::sync() const
+{
+    _environment->sync();
+}
+
 void LMDBStoreBase::copy_store(const std::string& dstPath, bool compact)
 {
     // Create a write tx to acquire a write lock to prevent writes while copying. From LMDB docs:
@@ -22,6 +22,8 @@ class LMDBStoreBase {
     WriteTransaction::Ptr create_write_transaction() const;
     LMDBDatabaseCreationTransaction::Ptr create_db_transaction() const;
     void copy_store(const std::string& dstPath, bool compact);
+    // Flushes transactions committed with a deferred sync to disk
+    void sync() const;
 
   protected:
     std::string _dbDirectory;
@@ -45,4 +45,11 @@ bool LMDBTransaction::get_value(std::vector<uint8_t>& key, uint64_t& data, const
 {
     return lmdb_queries::get_value(key, data, db, *this);
 }
+
+void LMDBTransaction::get_values(const std::vector<std::vector<uint8_t>>& keys,
+                                 std::vector<std::optional<std::vector<uint8_t>>>& values,
+                                 const LMDBDatabase& db) const
+{
+    lmdb_queries::get_values(keys, values, db, *this);
+}
 } // namespace bb::lmdblib
\ No newline at end of file
@@ -4,6 +4,7 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -70,6 +71,19 @@ class LMDBTransaction {
 
     bool get_value(std::vector<uint8_t>& key, uint64_t& data, const LMDBDatabase& db) const;
 
+    /*
+     * Reads the values of many keys with a single sorted cursor scan, see lmdb_queries::get_values.
+     * The database must not permit duplicate keys.
+     */
+    template <typename T>
+    void get_values(const std::vector<T>& keys,
+                    std::vector<std::optional<std::vector<uint8_t>>>& values,
+                    const LMDBDatabase& db) const;
+
+    void get_values(const std::vector<std::vector<uint8_t>>& keys,
+                    std::vector<std::optional<std::vector<uint8_t>>>& values,
+                    const LMDBDatabase& db) const;
+
   protected:
     std::shared_ptr<LMDBEnvironment> _environment;
     uint64_t _id;
@@ -89,6 +103,19 @@ template <typename T> bool LMDBTransaction::get_value(T& key, uint64_t& data, co
     return get_value(keyBuffer, data, db);
 }
 
+template <typename T>
+void LMDBTransaction::get_values(const std::vector<T>& keys,
+                                 std::vector<std::optional<std::vector<uint8_t>>>& values,
+                                 const LMDBDatabase& db) const
+{
+    std::vector<std::vector<uint8_t>> keyBuffers;
+    keyBuffers.reserve(keys.size());
+    for (const T& key : keys) {
+        keyBuffers.emplace_back(serialise_key(key));
+    }
+    get_values(keyBuffers, values, db);
+}
+
 template <typename T, typename K>
 bool LMDBTransaction::get_value_or_previous(T& key, K& data, const LMDBDatabase& db) const
 {
@@ -0,0 +1,51 @@
+#include "barretenberg/lmdblib/lmdb_write_batch.hpp"
+#include "barretenberg/lmdblib/queries.hpp"
+#include <stdexcept>
+
+namespace bb::lmdblib {
+
+LMDBWriteBatch::LMDBWriteBatch(const LMDBTransaction& readTransaction)
+    : _readTransaction(&readTransaction)
+{}
+
+void LMDBWriteBatch::put_value(Key& key, Value data, const LMDBDatabase& db)
+{
+    if (db.duplicate_keys_permitted()) {
+        throw std::runtime_error("Write batches do not support databases with duplicate keys");
+    }
+    auto [it, inserted] = _positions.try_emplace({ db.underlying(), key }, _puts.size());
+    if (!inserted) {
+        _puts[it->second].value = std::move(data);
+        return;
+    }
+    _puts.push_back({ .db = &db, .key = key, .value = std::move(data) });
+}
+
+bool LMDBWriteBatch::get_value(Key& key, Value& data, const LMDBDatabase& db) const
+{
+    auto it = _positions.find({ db.underlying(), key });
+    if (it == _positions.end()) {
+        return _readTransaction->get_value(key, data, db);
+    }
+    data = _puts[it->second].value;
+    return true;
+}
+
+bool LMDBWriteBatch::get_value(Key& key, uint64_t& data, const LMDBDatabase& db) const
+{
+    auto it = _positions.find({ db.underlying(), key });
+    if (it == _positions.end()) {
+        return _readTransaction->get_value(key, data, db);
+    }
+    Value value = _puts[it->second].value;
+    deserialise_key(value.data(), data);
+    return true;
+}
+
+void LMDBWriteBatch::apply(LMDBWriteTransaction& tx)
+{
+    for (Put& put : _puts) {
+        tx.put_value(put.key, put.value, *put.db);
+    }
+}
+} // namespace bb::lmdblib
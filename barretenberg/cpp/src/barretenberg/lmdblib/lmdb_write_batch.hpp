@@ -0,0 +1,80 @@
+#pragma once
+#include "barretenberg/lmdblib/lmdb_database.hpp"
+#include "barretenberg/lmdblib/lmdb_helpers.hpp"
+#include "barretenberg/lmdblib/lmdb_transaction.hpp"
+#include "barretenberg/lmdblib/lmdb_write_transaction.hpp"
+#include "barretenberg/lmdblib/types.hpp"
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace bb::lmdblib {
+
+/**
+ * Collects the puts of a write transaction so that they can be serialised before the write transaction is started.
+ * Offers the put_value/get_value methods of a write transaction, reads see the values put to the batch and otherwise
+ * fall through to the given transaction. apply() then replays the puts, in order, in a write transaction.
+ * Only intended for databases that don't permit duplicate keys, a later put to the same key replaces an earlier one.
+ * The transaction given on construction must outlive the use of put_value/get_value, but is not used by apply().
+ */
+class LMDBWriteBatch {
+  public:
+    explicit LMDBWriteBatch(const LMDBTransaction& readTransaction);
+
+    template <typename T> void put_value(T& key, Value& data, const LMDBDatabase& db);
+
+    template <typename T> void put_value(T& key, const uint64_t& data, const LMDBDatabase& db);
+
+    void put_value(Key& key, Value data, const LMDBDatabase& db);
+
+    template <typename T> bool get_value(T& key, Value& data, const LMDBDatabase& db) const;
+
+    template <typename T> bool get_value(T& key, uint64_t& data, const LMDBDatabase& db) const;
+
+    bool get_value(Key& key, Value& data, const LMDBDatabase& db) const;
+
+    bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db) const;
+
+    void apply(LMDBWriteTransaction& tx);
+
+    size_t size() const { return _puts.size(); }
+
+  private:
+    struct Put {
+        const LMDBDatabase* db;
+        Key key;
+        Value value;
+    };
+
+    const LMDBTransaction* _readTransaction;
+    std::vector<Put> _puts;
+    // The position in _puts of the latest value of each database/key
+    std::map<std::pair<MDB_dbi, Key>, size_t> _positions;
+};
+
+template <typename T> void LMDBWriteBatch::put_value(T& key, Value& data, const LMDBDatabase& db)
+{
+    Key keyBuffer = serialise_key(key);
+    put_value(keyBuffer, data, db);
+}
+
+template <typename T> void LMDBWriteBatch::put_value(T& key, const uint64_t& data, const LMDBDatabase& db)
+{
+    Key keyBuffer = serialise_key(key);
+    // Serialised as by the write transaction
+    put_value(keyBuffer, serialise_key(data), db);
+}
+
+template <typename T> bool LMDBWriteBatch::get_value(T& key, Value& data, const LMDBDatabase& db) const
+{
+    Key keyBuffer = serialise_key(key);
+    return get_value(keyBuffer, data, db);
+}
+
+template <typename T> bool LMDBWriteBatch::get_value(T& key, uint64_t& data, const LMDBDatabase& db) const
+{
+    Key keyBuffer = serialise_key(key);
+    return get_value(keyBuffer, data, db);
+}
+} // namespace bb::lmdblib
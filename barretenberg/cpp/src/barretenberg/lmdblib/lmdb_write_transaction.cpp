@@ -7,6 +7,7 @@
 #include "barretenberg/lmdblib/lmdb_helpers.hpp"
 #include "barretenberg/lmdblib/queries.hpp"
 #include "lmdb.h"
+#include <exception>
 #include <utility>
 
 namespace bb::lmdblib {
@@ -30,6 +31,20 @@ void LMDBWriteTransaction::commit()
     state = TransactionState::COMMITTED;
 }
 
+void LMDBWriteTransaction::commit_deferring_sync()
+{
+    // Only one write transaction can exist at a time so the flag only applies to this commit
+    MDB_env* env = _environment->underlying();
+    call_lmdb_func("mdb_env_set_flags", mdb_env_set_flags, env, static_cast<unsigned int>(MDB_NOMETASYNC), 1);
+    try {
+        commit();
+    } catch (std::exception&) {
+        call_lmdb_func(mdb_env_set_flags, env, static_cast<unsigned int>(MDB_NOMETASYNC), 0);
+        throw;
+    }
+    call_lmdb_func("mdb_env_set_flags", mdb_env_set_flags, env, static_cast<unsigned int>(MDB_NOMETASYNC), 0);
+}
+
 void LMDBWriteTransaction::try_abort()
 {
     LMDBTransaction::abort();
@@ -53,6 +53,14 @@ class LMDBWriteTransaction : public LMDBTransaction {
 
     void commit();
 
+    /**
+     * @brief Commits without waiting for the environment's meta data to be flushed to disk
+     * @details The data pages are still flushed, so the database stays consistent, but the transaction is only durable
+     * once the environment is next synced (see LMDBEnvironment::sync) or another transaction is committed. A crash
+     * before then loses at most this transaction.
+     */
+    void commit_deferring_sync();
+
     void try_abort();
 };
 
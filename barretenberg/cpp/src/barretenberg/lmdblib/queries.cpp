@@ -4,7 +4,11 @@
 #include "barretenberg/lmdblib/lmdb_write_transaction.hpp"
 #include "barretenberg/lmdblib/types.hpp"
 #include "lmdb.h"
+#include <algorithm>
 #include <cstdint>
+#include <exception>
+#include <numeric>
+#include <optional>
 #include <vector>
 
 namespace bb::lmdblib::lmdb_queries {
@@ -114,6 +118,77 @@ bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const bb::lmdbl
     return true;
 }
 
+void get_values(const KeysVector& keys,
+                std::vector<std::optional<Value>>& values,
+                const LMDBDatabase& db,
+                const bb::lmdblib::LMDBTransaction& tx)
+{
+    values.assign(keys.size(), std::nullopt);
+    if (keys.empty()) {
+        return;
+    }
+    auto to_mdb_val = [](const Key& key) {
+        MDB_val dbKey;
+        dbKey.mv_size = key.size();
+        dbKey.mv_data = (void*)key.data();
+        return dbKey;
+    };
+    // The keys must be visited in the order of the database's own comparator
+    std::vector<size_t> order(keys.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+        MDB_val lhsKey = to_mdb_val(keys[lhs]);
+        MDB_val rhsKey = to_mdb_val(keys[rhs]);
+        return mdb_cmp(tx.underlying(), db.underlying(), &lhsKey, &rhsKey) < 0;
+    });
+
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, tx.underlying(), db.underlying(), &cursor);
+    try {
+        MDB_val dbKey;
+        MDB_val dbVal;
+        // Once positioned, the cursor is at a key >= every key visited so far
+        bool positioned = false;
+        for (size_t index : order) {
+            MDB_val target = to_mdb_val(keys[index]);
+            int cmp = positioned ? mdb_cmp(tx.underlying(), db.underlying(), &target, &dbKey) : 1;
+            if (cmp > 0 && positioned) {
+                // Requested keys are often adjacent in the database, so try the next key before searching for it
+                int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_NEXT);
+                if (code == MDB_NOTFOUND) {
+                    // We are past the last key, none of the remaining keys are present
+                    break;
+                }
+                if (code != MDB_SUCCESS) {
+                    throw_error("get_values::mdb_cursor_get", code);
+                }
+                cmp = mdb_cmp(tx.underlying(), db.underlying(), &target, &dbKey);
+            }
+            if (cmp > 0) {
+                dbKey = target;
+                int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_SET_RANGE);
+                if (code == MDB_NOTFOUND) {
+                    // There is no key >= this one, none of the remaining keys are present
+                    break;
+                }
+                if (code != MDB_SUCCESS) {
+                    throw_error("get_values::mdb_cursor_get", code);
+                }
+                positioned = true;
+                cmp = mdb_cmp(tx.underlying(), db.underlying(), &target, &dbKey);
+            }
+            // Otherwise the cursor is at a larger key and this one is not present
+            if (cmp == 0) {
+                values[index] = mdb_val_to_vector(dbVal);
+            }
+        }
+    } catch (std::exception& e) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+}
+
 bool set_at_key(const LMDBCursor& cursor, Key& key)
 {
     MDB_val dbKey;
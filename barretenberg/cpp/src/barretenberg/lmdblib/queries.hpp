@@ -6,6 +6,7 @@
 #include "lmdb.h"
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <vector>
 
 namespace bb::lmdblib {
@@ -450,6 +451,16 @@ bool get_value(Key& key, Value& data, const LMDBDatabase& db, const LMDBTransact
 
 bool get_value(Key& key, uint64_t& data, const LMDBDatabase& db, const LMDBTransaction& tx);
 
+/**
+ * Reads the values of many keys from a database that does not permit duplicate keys. values[i] is set to the value of
+ * keys[i], or nullopt if it is not present. The keys are visited in the database's sort order by a single cursor, so
+ * keys stored near each other are found on the pages the cursor is already on rather than by a search from the root
+ */
+void get_values(const KeysVector& keys,
+                std::vector<std::optional<Value>>& values,
+                const LMDBDatabase& db,
+                const LMDBTransaction& tx);
+
 bool set_at_key(const LMDBCursor& cursor, Key& key);
 bool set_at_key_gte(const LMDBCursor& cursor, Key& key);
 bool set_at_start(const LMDBCursor& cursor);
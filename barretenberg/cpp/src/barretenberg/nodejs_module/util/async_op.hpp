@@ -1,21 +1,52 @@
 #pragma once
 
 #include "barretenberg/serialize/msgpack_impl.hpp"
+#include <cstdlib>
 #include <memory>
 #include <napi.h>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace bb::nodejs {
 
 using async_fn = std::function<void(msgpack::sbuffer&)>;
 
+/**
+ * @brief The response to one message of a batch, either the packed response or the error raised by its handler
+ */
+struct BatchResponse {
+    msgpack::sbuffer data;
+    std::optional<std::string> error;
+};
+
+using async_batch_fn = std::function<void(std::vector<BatchResponse>&)>;
+
+/**
+ * @brief Hands the contents of the buffer over to a JS Buffer without copying them, the buffer is left empty
+ *
+ * The memory is freed once the JS Buffer is garbage collected. Runtimes that don't allow external buffers get a copy.
+ * Must be called on the main JS thread.
+ */
+inline Napi::Buffer<char> release_to_js_buffer(Napi::Env env, msgpack::sbuffer& buffer)
+{
+    size_t size = buffer.size();
+    if (size == 0) {
+        return Napi::Buffer<char>::New(env, 0);
+    }
+    return Napi::Buffer<char>::NewOrCopy(
+        env, buffer.release(), size, [](Napi::Env, char* data) { std::free(data); }); // NOLINT
+}
+
 /**
  * @brief Encapsulatest some work that can be done off the JavaScript main thread
  *
  * This class takes a Deferred instance (i.e. a Promise to JS), execute some work in a separate thread, and then report
  * back on the result. The async execution _must not_ touch the JS environment. Everything that's needed to complete the
- * work must be copied into memory owned by the C++ code. The same has to be done when reporting back the result: keep
- * the result in memory owned by the C++ code and copy it back to the JS environment in the OnOK/OnError methods.
+ * work must be copied into memory owned by the C++ code, or kept alive by passing the JS value it lives in as the input
+ * of the operation, in which case JS must not modify it until the operation completes. The result is kept in memory
+ * owned by the C++ code and handed over to the JS environment in the OnOK/OnError methods.
  *
  * OnOK/OnError will be called on the main JS thread, so it's safe to interact with the JS environment there.
  *
@@ -32,6 +63,12 @@ class AsyncOperation : public Napi::AsyncWorker {
         , _deferred(std::move(deferred))
     {}
 
+    AsyncOperation(Napi::Env env, std::shared_ptr<Napi::Promise::Deferred> deferred, async_fn fn, Napi::Value input)
+        : AsyncOperation(env, std::move(deferred), std::move(fn))
+    {
+        _input = Napi::Persistent(input);
+    }
+
     AsyncOperation(const AsyncOperation&) = delete;
     AsyncOperation& operator=(const AsyncOperation&) = delete;
     AsyncOperation(AsyncOperation&&) = delete;
@@ -48,17 +85,72 @@ class AsyncOperation : public Napi::AsyncWorker {
         }
     }
 
+    void OnOK() override { _deferred->Resolve(release_to_js_buffer(Env(), _result)); }
+    void OnError(const Napi::Error& e) override { _deferred->Reject(e.Value()); }
+
+  private:
+    async_fn _fn;
+    std::shared_ptr<Napi::Promise::Deferred> _deferred;
+    msgpack::sbuffer _result;
+    // keeps the JS value holding the request alive while it is read off the main thread
+    Napi::Reference<Napi::Value> _input;
+};
+
+/**
+ * @brief An AsyncOperation handling a batch of messages, resolving the promise with an array holding a Buffer with the
+ * response to each message or, if the message failed, an Error
+ *
+ * A failed message doesn't fail the batch, the promise is only rejected if the batch itself can't be handled.
+ */
+class AsyncBatchOperation : public Napi::AsyncWorker {
+  public:
+    AsyncBatchOperation(Napi::Env env,
+                        std::shared_ptr<Napi::Promise::Deferred> deferred,
+                        async_batch_fn fn,
+                        Napi::Value input)
+        : Napi::AsyncWorker(env)
+        , _fn(std::move(fn))
+        , _deferred(std::move(deferred))
+        , _input(Napi::Persistent(input))
+    {}
+
+    AsyncBatchOperation(const AsyncBatchOperation&) = delete;
+    AsyncBatchOperation& operator=(const AsyncBatchOperation&) = delete;
+    AsyncBatchOperation(AsyncBatchOperation&&) = delete;
+    AsyncBatchOperation& operator=(AsyncBatchOperation&&) = delete;
+
+    ~AsyncBatchOperation() override = default;
+
+    void Execute() override
+    {
+        try {
+            _fn(_results);
+        } catch (const std::exception& e) {
+            SetError(e.what());
+        }
+    }
+
     void OnOK() override
     {
-        auto buf = Napi::Buffer<char>::Copy(Env(), _result.data(), _result.size());
-        _deferred->Resolve(buf);
+        Napi::Env env = Env();
+        auto responses = Napi::Array::New(env, _results.size());
+        for (uint32_t i = 0; i < _results.size(); ++i) {
+            BatchResponse& result = _results[i];
+            if (result.error.has_value()) {
+                responses.Set(i, Napi::Error::New(env, *result.error).Value());
+            } else {
+                responses.Set(i, release_to_js_buffer(env, result.data));
+            }
+        }
+        _deferred->Resolve(responses);
     }
     void OnError(const Napi::Error& e) override { _deferred->Reject(e.Value()); }
 
   private:
-    async_fn _fn;
+    async_batch_fn _fn;
     std::shared_ptr<Napi::Promise::Deferred> _deferred;
-    msgpack::sbuffer _result;
+    std::vector<BatchResponse> _results;
+    Napi::Reference<Napi::Value> _input;
 };
 
 } // namespace bb::nodejs
@@ -0,0 +1,44 @@
+#pragma once
+
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/crypto/merkle_tree/workers_parallel_for.hpp"
+#include "barretenberg/messaging/dispatcher.hpp"
+#include "barretenberg/nodejs_module/util/async_op.hpp"
+#include "barretenberg/serialize/msgpack_impl.hpp"
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <vector>
+
+namespace bb::nodejs {
+
+/**
+ * @brief Decodes a msgpack array of messages and dispatches them concurrently, one response per message in order
+ *
+ * The messages of a batch are independent of each other, like messages sent individually while others are still in
+ * flight, so they are handled in no particular order. The whole batch is decoded once and every message is read in
+ * place. The calling thread handles messages alongside the given workers.
+ */
+inline void dispatch_message_batch(const messaging::MessageDispatcher& dispatcher,
+                                   ThreadPool& workers,
+                                   const char* data,
+                                   size_t length,
+                                   std::vector<BatchResponse>& responses)
+{
+    msgpack::object_handle obj_handle = msgpack::unpack(data, length);
+    msgpack::object batch = obj_handle.get();
+    if (batch.type != msgpack::type::ARRAY) {
+        throw std::runtime_error("Message batch must be an array");
+    }
+
+    responses = std::vector<BatchResponse>(batch.via.array.size);
+    crypto::merkle_tree::workers_parallel_for(workers, responses.size(), [&](size_t i) {
+        try {
+            dispatcher.on_new_data(batch.via.array.ptr[i], responses[i].data);
+        } catch (const std::exception& e) {
+            responses[i].error = e.what();
+        }
+    });
+}
+
+} // namespace bb::nodejs
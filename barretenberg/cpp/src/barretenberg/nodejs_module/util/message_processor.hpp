@@ -76,18 +76,20 @@ class AsyncMessageProcessor {
             deferred->Reject(Napi::TypeError::New(env, "Argument must be a buffer").Value());
         } else {
             auto buffer = info[0].As<Napi::Buffer<char>>();
-            size_t length = buffer.Length();
             // we mustn't access the Napi::Env outside of this top-level function
-            // so copy the data to a variable we own
-            // and make it a shared pointer so that it doesn't get destroyed as soon as we exit this code block
-            auto data = std::make_shared<std::vector<char>>(length);
-            std::copy_n(buffer.Data(), length, data->data());
-
-            auto* op = new bb::nodejs::AsyncOperation(env, deferred, [data, this, length](msgpack::sbuffer& buf) {
-                msgpack::object_handle obj_handle = msgpack::unpack(data->data(), length);
-                msgpack::object obj = obj_handle.get();
-                dispatcher.on_new_data(obj, buf);
-            });
+            // the message is decoded straight from the buffer's memory, the operation keeps the buffer alive until done
+            const char* data = buffer.Data();
+            size_t length = buffer.Length();
+
+            auto* op = new bb::nodejs::AsyncOperation(
+                env,
+                deferred,
+                [data, this, length](msgpack::sbuffer& buf) {
+                    msgpack::object_handle obj_handle = msgpack::unpack(data, length);
+                    msgpack::object obj = obj_handle.get();
+                    dispatcher.on_new_data(obj, buf);
+                },
+                buffer);
 
             // Napi is now responsible for destroying this object
             op->Queue();
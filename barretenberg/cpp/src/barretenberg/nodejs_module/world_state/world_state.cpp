@@ -19,6 +19,7 @@
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/messaging/header.hpp"
 #include "barretenberg/nodejs_module/util/async_op.hpp"
+#include "barretenberg/nodejs_module/util/message_batch.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
@@ -149,6 +150,16 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
         thread_pool_size = info[thread_pool_size_index].As<Napi::Number>().Uint32Value();
     }
 
+    // A snapshot to populate a new data directory with before opening it
+    size_t import_snapshot_index = 8;
+    if (info.Length() > import_snapshot_index && !info[import_snapshot_index].IsUndefined()) {
+        if (!info[import_snapshot_index].IsString()) {
+            throw Napi::TypeError::New(env, "Snapshot path must be a string");
+        }
+
+        WorldState::import_snapshot(info[import_snapshot_index].As<Napi::String>(), data_dir, map_size);
+    }
+
     _ws = std::make_unique<WorldState>(thread_pool_size,
                                        data_dir,
                                        map_size,
@@ -156,6 +167,16 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
                                        tree_prefill,
                                        prefilled_public_data,
                                        initial_header_generator_point);
+    _batch_workers = std::make_unique<ThreadPool>(thread_pool_size);
+
+    size_t upper_node_levels_index = 7;
+    if (info.Length() > upper_node_levels_index) {
+        if (!info[upper_node_levels_index].IsNumber()) {
+            throw Napi::TypeError::New(env, "Historical upper node levels must be a number");
+        }
+
+        _ws->set_historical_upper_node_levels(info[upper_node_levels_index].As<Napi::Number>().Uint32Value());
+    }
 
     _dispatcher.register_target(
         WorldStateMessageType::GET_TREE_INFO,
@@ -274,6 +295,10 @@ WorldStateWrapper::WorldStateWrapper(const Napi::CallbackInfo& info)
     _dispatcher.register_target(
         WorldStateMessageType::COPY_STORES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return copy_stores(obj, buffer); });
+
+    _dispatcher.register_target(
+        WorldStateMessageType::EXPORT_SNAPSHOT,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return export_snapshot(obj, buffer); });
 }
 
 Napi::Value WorldStateWrapper::call(const Napi::CallbackInfo& info)
@@ -291,18 +316,51 @@ Napi::Value WorldStateWrapper::call(const Napi::CallbackInfo& info)
         deferred->Reject(Napi::TypeError::New(env, "World state has been closed").Value());
     } else {
         auto buffer = info[0].As<Napi::Buffer<char>>();
-        size_t length = buffer.Length();
         // we mustn't access the Napi::Env outside of this top-level function
-        // so copy the data to a variable we own
-        // and make it a shared pointer so that it doesn't get destroyed as soon as we exit this code block
-        auto data = std::make_shared<std::vector<char>>(length);
-        std::copy_n(buffer.Data(), length, data->data());
+        // the message is decoded straight from the buffer's memory, the operation keeps the buffer alive until done
+        const char* data = buffer.Data();
+        size_t length = buffer.Length();
+
+        auto* op = new AsyncOperation(
+            env,
+            deferred,
+            [=, this](msgpack::sbuffer& buf) {
+                msgpack::object_handle obj_handle = msgpack::unpack(data, length);
+                msgpack::object obj = obj_handle.get();
+                _dispatcher.on_new_data(obj, buf);
+            },
+            buffer);
+
+        // Napi is now responsible for destroying this object
+        op->Queue();
+    }
+
+    return deferred->Promise();
+}
+
+Napi::Value WorldStateWrapper::call_batch(const Napi::CallbackInfo& info)
+{
+    Napi::Env env = info.Env();
+    auto deferred = std::make_shared<Napi::Promise::Deferred>(env);
+
+    if (info.Length() < 1) {
+        deferred->Reject(Napi::TypeError::New(env, "Wrong number of arguments").Value());
+    } else if (!info[0].IsBuffer()) {
+        deferred->Reject(Napi::TypeError::New(env, "Argument must be a buffer").Value());
+    } else if (!_ws) {
+        deferred->Reject(Napi::TypeError::New(env, "World state has been closed").Value());
+    } else {
+        auto buffer = info[0].As<Napi::Buffer<char>>();
+        const char* data = buffer.Data();
+        size_t length = buffer.Length();
 
-        auto* op = new AsyncOperation(env, deferred, [=, this](msgpack::sbuffer& buf) {
-            msgpack::object_handle obj_handle = msgpack::unpack(data->data(), length);
-            msgpack::object obj = obj_handle.get();
-            _dispatcher.on_new_data(obj, buf);
-        });
+        auto* op = new AsyncBatchOperation(
+            env,
+            deferred,
+            [=, this](std::vector<BatchResponse>& responses) {
+                dispatch_message_batch(_dispatcher, *_batch_workers, data, length, responses);
+            },
+            buffer);
 
         // Napi is now responsible for destroying this object
         op->Queue();
@@ -924,11 +982,30 @@ bool WorldStateWrapper::copy_stores(msgpack::object& obj, msgpack::sbuffer& buff
     return true;
 }
 
+bool WorldStateWrapper::export_snapshot(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<ExportSnapshotRequest> request;
+    obj.convert(request);
+
+    lmdblib::SnapshotOptions options;
+    options.chunkSize = request.value.chunkSize.value_or(lmdblib::DEFAULT_SNAPSHOT_CHUNK_SIZE);
+    options.maxBytesPerSecond = request.value.maxBytesPerSecond.value_or(0);
+    options.baseSnapshotPath = request.value.baseSnapshotPath;
+    lmdblib::SnapshotStats stats = _ws->export_snapshot(request.value.dstPath, options);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<lmdblib::SnapshotStats> resp_msg(WorldStateMessageType::EXPORT_SNAPSHOT, header, stats);
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 Napi::Function WorldStateWrapper::get_class(Napi::Env env)
 {
     return DefineClass(env,
                        "WorldState",
                        {
                            WorldStateWrapper::InstanceMethod("call", &WorldStateWrapper::call),
+                           WorldStateWrapper::InstanceMethod("callBatch", &WorldStateWrapper::call_batch),
                        });
 }
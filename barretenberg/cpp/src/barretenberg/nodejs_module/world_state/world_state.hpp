@@ -1,5 +1,6 @@
 #pragma once
 
+#include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/messaging/dispatcher.hpp"
 #include "barretenberg/nodejs_module/world_state/world_state_message.hpp"
 #include "barretenberg/world_state/types.hpp"
@@ -18,10 +19,16 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     WorldStateWrapper(const Napi::CallbackInfo&);
 
     /**
-     * @brief The only instance method exposed to JavaScript. Takes a msgpack Message and returns a Promise
+     * @brief Takes a msgpack Message and returns a Promise
      */
     Napi::Value call(const Napi::CallbackInfo&);
 
+    /**
+     * @brief Takes a msgpack array of Messages and returns a Promise of an array with the response to each. The
+     * messages are handled concurrently
+     */
+    Napi::Value call_batch(const Napi::CallbackInfo&);
+
     /**
      * @brief Register the WorldStateAddon class with the JavaScript runtime.
      */
@@ -30,6 +37,8 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
   private:
     std::unique_ptr<bb::world_state::WorldState> _ws;
     bb::messaging::MessageDispatcher _dispatcher;
+    // handles the messages of a batch, separate from the world state's own workers which the handlers wait on
+    std::unique_ptr<bb::ThreadPool> _batch_workers;
 
     bool get_tree_info(msgpack::object& obj, msgpack::sbuffer& buffer) const;
     bool get_state_reference(msgpack::object& obj, msgpack::sbuffer& buffer) const;
@@ -73,6 +82,7 @@ class WorldStateWrapper : public Napi::ObjectWrap<WorldStateWrapper> {
     bool revert_all_checkpoints(msgpack::object& obj, msgpack::sbuffer& buffer);
 
     bool copy_stores(msgpack::object& obj, msgpack::sbuffer& buffer);
+    bool export_snapshot(msgpack::object& obj, msgpack::sbuffer& buffer) const;
 };
 
 } // namespace bb::nodejs
@@ -58,6 +58,7 @@ enum WorldStateMessageType {
     REVERT_ALL_CHECKPOINTS,
 
     COPY_STORES,
+    EXPORT_SNAPSHOT,
 
     CLOSE = 999,
 };
@@ -256,6 +257,14 @@ struct CopyStoresRequest {
     MSGPACK_FIELDS(dstPath, compact);
 };
 
+struct ExportSnapshotRequest {
+    std::string dstPath;
+    std::optional<std::string> baseSnapshotPath;
+    std::optional<uint64_t> chunkSize;
+    std::optional<uint64_t> maxBytesPerSecond;
+    MSGPACK_FIELDS(dstPath, baseSnapshotPath, chunkSize, maxBytesPerSecond);
+};
+
 } // namespace bb::nodejs
 
 MSGPACK_ADD_ENUM(bb::nodejs::WorldStateMessageType)
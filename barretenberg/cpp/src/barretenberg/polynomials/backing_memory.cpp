@@ -1,5 +1,316 @@
 #include "barretenberg/polynomials/backing_memory.hpp"
+#include "barretenberg/common/assert.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 bool slow_low_memory =
     std::getenv("BB_SLOW_LOW_MEMORY") == nullptr ? false : std::string(std::getenv("BB_SLOW_LOW_MEMORY")) == "1";
+
+namespace bb::file_backed_memory {
+namespace {
+
+size_t get_default_max_resident_bytes()
+{
+    const char* value = std::getenv("BB_LOW_MEMORY_MAX_RESIDENT_MB");
+    return value == nullptr ? 0 : std::stoul(value) << 20;
+}
+
+std::atomic<size_t> num_regions = 0;
+std::atomic<size_t> chunk_size = DEFAULT_CHUNK_SIZE;
+std::atomic<size_t> max_resident_bytes = get_default_max_resident_bytes();
+
+#ifndef __wasm__
+struct Region {
+    uintptr_t begin;
+    size_t size;
+    int fd;
+    size_t chunk_size;
+    // Per chunk: 0 if not counted as resident, otherwise the clock value of its last prefetch
+    std::vector<uint64_t> last_use;
+
+    size_t get_chunk_bytes(size_t chunk) const { return std::min(chunk_size, size - (chunk * chunk_size)); }
+};
+
+struct Eviction {
+    void* address;
+    size_t size;
+    int fd;
+    off_t file_offset;
+
+    /**
+     * @brief Write the chunk back to its file and drop it from memory
+     * @details Unmapping pages of a shared file mapping leaves dirty data in the page cache, so the data is flushed
+     * first and then dropped from the page cache too.
+     */
+    void run() const
+    {
+        msync(address, size, MS_SYNC);
+        madvise(address, size, MADV_DONTNEED);
+#ifdef POSIX_FADV_DONTNEED
+        posix_fadvise(fd, file_offset, static_cast<off_t>(size), POSIX_FADV_DONTNEED);
+#endif
+    }
+};
+
+/**
+ * @brief Tracks the chunks of all file-backed regions and evicts the least recently prefetched ones over the cap
+ */
+class ResidencyTracker {
+  public:
+    void add(void* data, size_t size, int fd)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        const size_t region_chunk_size = chunk_size;
+        Region region{ reinterpret_cast<uintptr_t>(data),
+                       size,
+                       fd,
+                       region_chunk_size,
+                       std::vector<uint64_t>((size + region_chunk_size - 1) / region_chunk_size, 0) };
+        regions_.emplace(region.begin, std::move(region));
+        num_regions++;
+    }
+
+    void remove(void* data)
+    {
+        // Waits for evictions in flight, which may touch this region
+        std::unique_lock<std::shared_mutex> lifetime_lock(lifetime_mutex_);
+        std::unique_lock<std::mutex> lock(mutex_);
+        auto it = regions_.find(reinterpret_cast<uintptr_t>(data));
+        if (it == regions_.end()) {
+            return;
+        }
+        for (size_t chunk = 0; chunk < it->second.last_use.size(); ++chunk) {
+            if (it->second.last_use[chunk] != 0) {
+                resident_bytes_ -= it->second.get_chunk_bytes(chunk);
+            }
+        }
+        regions_.erase(it);
+        num_regions--;
+    }
+
+    void prefetch(const void* data, size_t size)
+    {
+        // Keeps the regions mapped until our evictions have run
+        std::shared_lock<std::shared_mutex> lifetime_lock(lifetime_mutex_);
+        std::vector<Eviction> evictions;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            Region* region = nullptr;
+            size_t first_chunk = 0;
+            size_t end_chunk = 0;
+            if (!find_chunks(data, size, /*covering=*/true, region, first_chunk, end_chunk)) {
+                return;
+            }
+            const uint64_t first_use = clock_ + 1;
+            for (size_t chunk = first_chunk; chunk < end_chunk; ++chunk) {
+                if (region->last_use[chunk] == 0) {
+                    const size_t bytes = region->get_chunk_bytes(chunk);
+                    // Starts the read in the background and returns immediately
+                    madvise(
+                        reinterpret_cast<void*>(region->begin + chunk * region->chunk_size), bytes, MADV_WILLNEED);
+                    resident_bytes_ += bytes;
+                }
+                region->last_use[chunk] = ++clock_;
+            }
+            enforce_cap(first_use, evictions);
+        }
+        // The write-back is slow, don't hold the lock for it
+        for (const Eviction& eviction : evictions) {
+            eviction.run();
+        }
+    }
+
+    void release(const void* data, size_t size)
+    {
+        // Keeps the regions mapped until our evictions have run
+        std::shared_lock<std::shared_mutex> lifetime_lock(lifetime_mutex_);
+        std::vector<Eviction> evictions;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            Region* region = nullptr;
+            size_t first_chunk = 0;
+            size_t end_chunk = 0;
+            // Only whole chunks: the rest of a partially released chunk may still be in use
+            if (!find_chunks(data, size, /*covering=*/false, region, first_chunk, end_chunk)) {
+                return;
+            }
+            for (size_t chunk = first_chunk; chunk < end_chunk; ++chunk) {
+                evictions.push_back(evict(*region, chunk));
+            }
+        }
+        for (const Eviction& eviction : evictions) {
+            eviction.run();
+        }
+    }
+
+    size_t get_resident_bytes()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return resident_bytes_;
+    }
+
+  private:
+    std::shared_mutex lifetime_mutex_;
+    std::mutex mutex_;
+    std::map<uintptr_t, Region> regions_;
+    size_t resident_bytes_ = 0;
+    uint64_t clock_ = 0;
+
+    /**
+     * @brief Find the region containing [data, data + size) and the chunks that either cover or lie within it
+     */
+    bool find_chunks(
+        const void* data, size_t size, bool covering, Region*& region, size_t& first_chunk, size_t& end_chunk)
+    {
+        const auto begin = reinterpret_cast<uintptr_t>(data);
+        auto it = regions_.upper_bound(begin);
+        if (it == regions_.begin()) {
+            return false;
+        }
+        --it;
+        region = &it->second;
+        if (begin >= region->begin + region->size) {
+            return false;
+        }
+        const size_t offset = begin - region->begin;
+        const size_t end_offset = std::min(offset + size, region->size);
+        if (covering) {
+            first_chunk = offset / region->chunk_size;
+            end_chunk = (end_offset + region->chunk_size - 1) / region->chunk_size;
+        } else {
+            first_chunk = (offset + region->chunk_size - 1) / region->chunk_size;
+            end_chunk = end_offset == region->size ? region->last_use.size() : end_offset / region->chunk_size;
+        }
+        return first_chunk < end_chunk;
+    }
+
+    /**
+     * @brief Stop counting a chunk as resident and return the eviction to run once the lock is released
+     */
+    Eviction evict(Region& region, size_t chunk)
+    {
+        const size_t bytes = region.get_chunk_bytes(chunk);
+        if (region.last_use[chunk] != 0) {
+            resident_bytes_ -= bytes;
+            region.last_use[chunk] = 0;
+        }
+        return Eviction{ reinterpret_cast<void*>(region.begin + chunk * region.chunk_size),
+                         bytes,
+                         region.fd,
+                         static_cast<off_t>(chunk * region.chunk_size) };
+    }
+
+    /**
+     * @brief Evict least recently prefetched chunks until under the cap, sparing those prefetched at or after
+     * `protected_from`
+     */
+    void enforce_cap(uint64_t protected_from, std::vector<Eviction>& evictions)
+    {
+        const size_t cap = max_resident_bytes;
+        while (cap != 0 && resident_bytes_ > cap) {
+            Region* oldest_region = nullptr;
+            size_t oldest_chunk = 0;
+            uint64_t oldest_use = protected_from;
+            for (auto& [begin, region] : regions_) {
+                for (size_t chunk = 0; chunk < region.last_use.size(); ++chunk) {
+                    const uint64_t use = region.last_use[chunk];
+                    if (use != 0 && use < oldest_use) {
+                        oldest_use = use;
+                        oldest_region = &region;
+                        oldest_chunk = chunk;
+                    }
+                }
+            }
+            if (oldest_region == nullptr) {
+                return;
+            }
+            evictions.push_back(evict(*oldest_region, oldest_chunk));
+        }
+    }
+};
+
+ResidencyTracker& get_tracker()
+{
+    static ResidencyTracker tracker;
+    return tracker;
+}
+#endif
+} // namespace
+
+bool is_active()
+{
+    return num_regions.load(std::memory_order_relaxed) != 0;
+}
+
+size_t get_chunk_size()
+{
+    return chunk_size;
+}
+
+void set_chunk_size(size_t bytes)
+{
+    BB_ASSERT_GT(bytes, 0UL);
+#ifndef __wasm__
+    // madvise needs page-aligned chunks
+    const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    bytes = (bytes + page_size - 1) / page_size * page_size;
+#endif
+    chunk_size = bytes;
+}
+
+size_t get_max_resident_bytes()
+{
+    return max_resident_bytes;
+}
+
+void set_max_resident_bytes(size_t bytes)
+{
+    max_resident_bytes = bytes;
+}
+
+#ifndef __wasm__
+size_t get_resident_bytes()
+{
+    return get_tracker().get_resident_bytes();
+}
+
+void register_region(void* data, size_t size, int fd)
+{
+    get_tracker().add(data, size, fd);
+}
+
+void unregister_region(void* data)
+{
+    get_tracker().remove(data);
+}
+
+void prefetch(const void* data, size_t size)
+{
+    if (is_active()) {
+        get_tracker().prefetch(data, size);
+    }
+}
+
+void release(const void* data, size_t size)
+{
+    if (is_active()) {
+        get_tracker().release(data, size);
+    }
+}
+#else
+size_t get_resident_bytes()
+{
+    return 0;
+}
+void register_region(void* /*unused*/, size_t /*unused*/, int /*unused*/) {}
+void unregister_region(void* /*unused*/) {}
+void prefetch(const void* /*unused*/, size_t /*unused*/) {}
+void release(const void* /*unused*/, size_t /*unused*/) {}
+#endif
+} // namespace bb::file_backed_memory
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include "barretenberg/common/numa.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "unistd.h"
@@ -21,6 +22,56 @@
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 extern bool slow_low_memory;
 
+/**
+ * @brief Residency management for file-backed polynomials (slow_low_memory mode)
+ *
+ * @details Each FileBackedMemory region is divided into fixed-size chunks of get_chunk_size() bytes. Code that knows
+ * its access pattern ahead of time (sumcheck rounds, the MSM work schedule) calls prefetch() on the range it is about
+ * to read, which starts asynchronous readahead of the chunks covering it (madvise(MADV_WILLNEED)), and release() on
+ * ranges it is done with, which writes the chunks back and drops them from memory. If the resident chunks exceed
+ * get_max_resident_bytes(), the least recently prefetched chunks are evicted.
+ *
+ * Both calls take arbitrary addresses and ignore those outside file-backed regions. When no file-backed region exists
+ * they cost a single atomic load, so they can be issued unconditionally from hot loops. Pages touched without a
+ * prefetch are left to the kernel and are not counted towards the cap.
+ */
+namespace bb::file_backed_memory {
+
+// Default chunk size; a multiple of any page size we expect to see
+constexpr size_t DEFAULT_CHUNK_SIZE = 1UL << 23;
+
+// True if at least one file-backed region exists
+bool is_active();
+size_t get_chunk_size();
+void set_chunk_size(size_t bytes);
+
+// Cap on prefetched chunks kept in memory, in bytes; 0 means no cap. Defaults to BB_LOW_MEMORY_MAX_RESIDENT_MB.
+size_t get_max_resident_bytes();
+void set_max_resident_bytes(size_t bytes);
+// Bytes of chunks currently counted as resident
+size_t get_resident_bytes();
+
+void register_region(void* data, size_t size, int fd);
+void unregister_region(void* data);
+
+void prefetch(const void* data, size_t size);
+void release(const void* data, size_t size);
+
+template <typename T> void prefetch(const T* data, size_t count)
+{
+    if (is_active() && count != 0) {
+        prefetch(static_cast<const void*>(data), count * sizeof(T));
+    }
+}
+template <typename T> void release(const T* data, size_t count)
+{
+    if (is_active() && count != 0) {
+        release(static_cast<const void*>(data), count * sizeof(T));
+    }
+}
+
+} // namespace bb::file_backed_memory
+
 template <typename T> class AlignedMemory;
 
 #ifndef __wasm__
@@ -61,7 +112,10 @@ template <typename T> class AlignedMemory : public BackingMemory<T> {
         : BackingMemory<T>()
         // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
         , data(std::static_pointer_cast<T[]>(std::move(bb::get_mem_slab(sizeof(T) * size))))
-    {}
+    {
+        // Spread large polynomials over the NUMA nodes before they are first written (no-op on single node machines)
+        bb::numa::place_memory(data.get(), sizeof(T) * size);
+    }
 
     // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
     std::shared_ptr<T[]> data;
@@ -86,6 +140,7 @@ template <typename T> class FileBackedMemory : public BackingMemory<T> {
             return;
         }
         if (memory != nullptr && file_size > 0) {
+            bb::file_backed_memory::unregister_region(memory);
             munmap(memory, file_size);
         }
         if (fd >= 0) {
@@ -136,6 +191,7 @@ template <typename T> class FileBackedMemory : public BackingMemory<T> {
         }
 
         memory = static_cast<T*>(addr);
+        bb::file_backed_memory::register_region(memory, file_size, fd);
     }
 
     size_t file_size;
@@ -180,9 +180,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator+=(PolynomialSpan
     parallel_for(num_threads, [&](size_t j) {
         size_t offset = j * range_per_thread + other.start_index;
         size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += other[i];
-        }
+        std::span<Fr> chunk(&at(offset), end - offset);
+        Fr::batch_add(chunk, other.span.subspan(offset - other.start_index, end - offset), chunk);
     });
     return *this;
 }
@@ -271,9 +270,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator-=(PolynomialSpan
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) -= other[i];
-        }
+        std::span<Fr> chunk(&at(offset), end - offset);
+        Fr::batch_sub(chunk, other.span.subspan(offset - other.start_index, end - offset), chunk);
     });
     return *this;
 }
@@ -286,9 +284,8 @@ template <typename Fr> Polynomial<Fr>& Polynomial<Fr>::operator*=(const Fr scali
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            data()[i] *= scaling_factor;
-        }
+        std::span<Fr> chunk(data() + offset, end - offset);
+        Fr::batch_mul(chunk, scaling_factor, chunk);
     });
 
     return *this;
@@ -342,9 +339,8 @@ template <typename Fr> void Polynomial<Fr>::add_scaled(PolynomialSpan<const Fr>
     parallel_for(num_threads, [&](size_t j) {
         const size_t offset = j * range_per_thread + other.start_index;
         const size_t end = (j == num_threads - 1) ? offset + range_per_thread + leftovers : offset + range_per_thread;
-        for (size_t i = offset; i < end; ++i) {
-            at(i) += scaling_factor * other[i];
-        }
+        std::span<Fr> chunk(&at(offset), end - offset);
+        Fr::batch_fma(other.span.subspan(offset - other.start_index, end - offset), scaling_factor, chunk, chunk);
     });
 }
 
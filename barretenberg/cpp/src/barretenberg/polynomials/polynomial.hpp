@@ -295,6 +295,37 @@ template <typename Fr> class Polynomial {
     Fr* data() { return coefficients_.data(); }
     const Fr* data() const { return coefficients_.data(); }
 
+    /**
+     * @brief Hint that the coefficients with indices in [start, end) are about to be read
+     * @details Only has an effect for file-backed polynomials (slow_low_memory mode), where it starts reading them in
+     * the background. See bb::file_backed_memory.
+     */
+    void prefetch(size_t start, size_t end) const
+    {
+        if (file_backed_memory::is_active()) {
+            start = std::max(start, start_index());
+            end = std::min(end, end_index());
+            if (start < end) {
+                file_backed_memory::prefetch(data() + (start - start_index()), end - start);
+            }
+        }
+    }
+
+    /**
+     * @brief Hint that the coefficients with indices in [start, end) won't be needed for a while
+     * @details For file-backed polynomials, writes them back and frees the memory they occupy.
+     */
+    void release(size_t start, size_t end) const
+    {
+        if (file_backed_memory::is_active()) {
+            start = std::max(start, start_index());
+            end = std::min(end, end_index());
+            if (start < end) {
+                file_backed_memory::release(data() + (start - start_index()), end - start);
+            }
+        }
+    }
+
     /**
      * @brief Our mutable accessor, unlike operator[].
      * We abuse precedent a bit to differentiate at() and operator[] as mutable and immutable, respectively.
@@ -262,3 +262,49 @@ TEST(Polynomial, Expand)
 }
 
 #endif
+
+#ifndef __wasm__
+TEST(Polynomial, FileBackedPrefetchAndRelease)
+{
+    using FF = bb::fr;
+    namespace fbm = bb::file_backed_memory;
+    const bool original_slow_low_memory = slow_low_memory;
+    const size_t original_chunk_size = fbm::get_chunk_size();
+    const size_t original_max_resident_bytes = fbm::get_max_resident_bytes();
+
+    slow_low_memory = true;
+    // 64 coefficients per chunk, rounded up to the page size
+    fbm::set_chunk_size(64 * sizeof(FF));
+    const size_t chunk_size = fbm::get_chunk_size();
+    const size_t chunk_coefficients = chunk_size / sizeof(FF);
+    fbm::set_max_resident_bytes(2 * chunk_size);
+    {
+        const size_t size = 8 * chunk_coefficients;
+        auto poly = bb::Polynomial<FF>::random(size);
+        const std::vector<FF> expected(poly.data(), poly.data() + size);
+        EXPECT_TRUE(fbm::is_active());
+        EXPECT_EQ(fbm::get_resident_bytes(), 0UL);
+
+        poly.prefetch(0, 1);
+        EXPECT_EQ(fbm::get_resident_bytes(), chunk_size);
+        poly.prefetch(chunk_coefficients, 3 * chunk_coefficients);
+        // Over the cap: the least recently prefetched chunk is evicted
+        EXPECT_EQ(fbm::get_resident_bytes(), 2 * chunk_size);
+        // Partially covered chunks are not released
+        poly.release(chunk_coefficients + 1, 3 * chunk_coefficients);
+        EXPECT_EQ(fbm::get_resident_bytes(), chunk_size);
+        poly.release(0, size);
+        EXPECT_EQ(fbm::get_resident_bytes(), 0UL);
+
+        // Evicted data is read back from the file
+        for (size_t i = 0; i < size; ++i) {
+            EXPECT_EQ(poly[i], expected[i]);
+        }
+    }
+    EXPECT_FALSE(fbm::is_active());
+
+    slow_low_memory = original_slow_low_memory;
+    fbm::set_chunk_size(original_chunk_size);
+    fbm::set_max_resident_bytes(original_max_resident_bytes);
+}
+#endif
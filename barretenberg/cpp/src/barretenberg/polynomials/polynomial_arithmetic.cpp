@@ -365,9 +365,10 @@ template <typename Fr>
 void ifft(Fr* coeffs, const EvaluationDomain<Fr>& domain)
 {
     fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        std::span<Fr> chunk(coeffs + j * domain.thread_size, domain.thread_size);
+        Fr::batch_mul(chunk, domain.domain_inverse, chunk);
+    });
 }
 
 template <typename Fr>
@@ -375,9 +376,10 @@ template <typename Fr>
 void ifft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain)
 {
     fft_inner_parallel(coeffs, target, domain, domain.root_inverse, domain.get_inverse_round_roots());
-    ITERATE_OVER_DOMAIN_START(domain);
-    target[i] *= domain.domain_inverse;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        std::span<Fr> chunk(target + j * domain.thread_size, domain.thread_size);
+        Fr::batch_mul(chunk, domain.domain_inverse, chunk);
+    });
 }
 
 template <typename Fr>
@@ -515,9 +517,10 @@ void ifft_with_constant(Fr* coeffs, const EvaluationDomain<Fr>& domain, const Fr
 {
     fft_inner_parallel({ coeffs }, domain, domain.root_inverse, domain.get_inverse_round_roots());
     Fr T0 = domain.domain_inverse * value;
-    ITERATE_OVER_DOMAIN_START(domain);
-    coeffs[i] *= T0;
-    ITERATE_OVER_DOMAIN_END;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        std::span<Fr> chunk(coeffs + j * domain.thread_size, domain.thread_size);
+        Fr::batch_mul(chunk, T0, chunk);
+    });
 }
 
 template <typename Fr>
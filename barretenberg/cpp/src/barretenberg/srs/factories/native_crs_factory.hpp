@@ -5,6 +5,7 @@
 #include "barretenberg/srs/factories/mem_grumpkin_crs_factory.hpp"
 #include <filesystem>
 #include <memory>
+#include <mutex>
 
 namespace bb::srs::factories {
 
@@ -40,6 +41,8 @@ class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
     {}
     std::shared_ptr<Crs<curve::BN254>> get_crs(size_t degree) override
     {
+        // Requests served concurrently (e.g. by the bbapi daemon) may grow the crs at the same time
+        std::unique_lock<std::mutex> lock(mutex_);
         if (degree > last_degree_ || mem_crs_ == nullptr) {
             mem_crs_ = std::make_shared<MemBn254CrsFactory>(init_bn254_crs(path_, degree, allow_download_));
             last_degree_ = degree;
@@ -51,6 +54,7 @@ class NativeBn254CrsFactory : public CrsFactory<curve::BN254> {
     std::filesystem::path path_;
     bool allow_download_ = true;
     size_t last_degree_ = 0;
+    std::mutex mutex_;
     std::shared_ptr<MemBn254CrsFactory> mem_crs_;
 };
 
@@ -63,6 +67,7 @@ class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
 
     std::shared_ptr<Crs<curve::Grumpkin>> get_crs(size_t degree) override
     {
+        std::unique_lock<std::mutex> lock(mutex_);
         if (degree > last_degree_ || mem_crs_ == nullptr) {
             mem_crs_ = std::make_unique<MemGrumpkinCrsFactory>(init_grumpkin_crs(path_, degree, allow_download_));
             last_degree_ = degree;
@@ -74,6 +79,7 @@ class NativeGrumpkinCrsFactory : public CrsFactory<curve::Grumpkin> {
     std::filesystem::path path_;
     bool allow_download_ = true;
     size_t last_degree_ = 0;
+    std::mutex mutex_;
     std::unique_ptr<MemGrumpkinCrsFactory> mem_crs_;
 };
 
@@ -2447,6 +2447,166 @@ void UltraCircuitBuilder_<FF>::create_poseidon2_internal_gate(const poseidon2_in
     ++this->num_gates;
 }
 
+template <typename ExecutionTrace>
+UltraCircuitBuilder_<ExecutionTrace>::UltraCircuitBuilder_(const UltraCircuitBuilder_& parent, SubBuilderTag /*unused*/)
+    : CircuitBuilderBase<FF>(0, parent.has_dummy_witnesses)
+    , constant_variable_indices(parent.constant_variable_indices)
+{
+    const size_t num_variables = parent.get_num_variables();
+    for (size_t idx = 0; idx < num_variables; ++idx) {
+        this->add_variable(parent.get_variable(static_cast<uint32_t>(idx)));
+    }
+    this->zero_idx = parent.zero_idx;
+    this->one_idx = parent.one_idx;
+    this->tau.insert({ DUMMY_TAG, DUMMY_TAG });
+    this->is_recursive_circuit = parent.is_recursive_circuit;
+}
+
+template <typename ExecutionTrace>
+UltraCircuitBuilder_<ExecutionTrace> UltraCircuitBuilder_<ExecutionTrace>::create_sub_builder() const
+{
+    BB_ASSERT_EQ(circuit_finalized, false, "Cannot create a sub-builder of a finalized circuit");
+    return UltraCircuitBuilder_(*this, SubBuilderTag{});
+}
+
+template <typename ExecutionTrace>
+void UltraCircuitBuilder_<ExecutionTrace>::merge_sub_builder(UltraCircuitBuilder_&& sub_builder,
+                                                             const size_t num_shared_variables)
+{
+    BB_ASSERT_EQ(circuit_finalized, false);
+    BB_ASSERT_EQ(sub_builder.circuit_finalized, false);
+    ASSERT(sub_builder.public_inputs().empty(), "Sub-builders cannot add public inputs");
+    BB_ASSERT_GTE(this->get_num_variables(), num_shared_variables);
+    BB_ASSERT_GTE(sub_builder.get_num_variables(), num_shared_variables);
+    // Memory records are only created when the circuit is finalized
+    ASSERT(sub_builder.memory_read_records.empty() && sub_builder.memory_write_records.empty());
+
+    if (sub_builder.failed() && !this->failed()) {
+        this->failure(sub_builder.err());
+    }
+
+    // Shared variables keep their index, the others are appended after the variables of this builder
+    const auto num_shared = static_cast<uint32_t>(num_shared_variables);
+    const auto offset = static_cast<uint32_t>(this->get_num_variables()) - num_shared;
+    const auto map_variable = [num_shared, offset](const uint32_t variable_index) {
+        return variable_index < num_shared ? variable_index : variable_index + offset;
+    };
+
+    // New variables start out in a class of their own, then the copy constraints of the sub-builder are replayed. This
+    // also joins the classes of shared variables without disturbing the cycles they are already part of here.
+    const auto num_sub_variables = static_cast<uint32_t>(sub_builder.get_num_variables());
+    for (uint32_t idx = num_shared; idx < num_sub_variables; ++idx) {
+        this->add_variable(sub_builder.get_variable(idx));
+    }
+    for (uint32_t idx = 0; idx < num_sub_variables; ++idx) {
+        const uint32_t real_idx = sub_builder.real_variable_index[idx];
+        if (real_idx != idx) {
+            this->assert_equal(map_variable(real_idx), map_variable(idx), "merge_sub_builder");
+        }
+    }
+
+    // Constants created by the sub-builder are either new here or duplicates of ones created by an earlier merge
+    for (const auto& [value, variable_index] : sub_builder.constant_variable_indices) {
+        if (variable_index < num_shared) {
+            continue;
+        }
+        const auto [it, inserted] = constant_variable_indices.try_emplace(value, map_variable(variable_index));
+        if (!inserted) {
+            this->assert_equal(it->second, map_variable(variable_index), "merge_sub_builder");
+        }
+    }
+
+    // Lookup gates select their table by its index in lookup_tables, so tables are merged by id and the selector is
+    // rewritten to the index here
+    std::vector<size_t> table_indices(sub_builder.lookup_tables.size());
+    for (auto& table : sub_builder.lookup_tables) {
+        auto existing = std::find_if(lookup_tables.begin(), lookup_tables.end(), [&](const plookup::BasicTable& other) {
+            return other.id == table.id;
+        });
+        if (existing != lookup_tables.end()) {
+            existing->lookup_gates.insert(
+                existing->lookup_gates.end(), table.lookup_gates.begin(), table.lookup_gates.end());
+            table_indices[table.table_index] = existing->table_index;
+        } else {
+            table_indices[table.table_index] = lookup_tables.size();
+            table.table_index = lookup_tables.size();
+            lookup_tables.emplace_back(std::move(table));
+        }
+    }
+    auto& sub_lookup_block = sub_builder.blocks.lookup;
+    for (size_t row = 0; row < sub_lookup_block.size(); ++row) {
+        if (!sub_lookup_block.q_lookup_type()[row].is_zero()) {
+            const auto table_index = static_cast<size_t>(uint256_t(sub_lookup_block.q_3()[row]).data[0]);
+            sub_lookup_block.q_3().set(row, FF(table_indices[table_index]));
+        }
+    }
+
+    const size_t memory_gate_offset = blocks.memory.size();
+    auto sub_blocks = sub_builder.blocks.get();
+    size_t block_idx = 0;
+    for (auto& block : blocks.get()) {
+        block.append(sub_blocks[block_idx++], map_variable);
+    }
+
+    const auto map_memory_variable = [&](const uint32_t variable_index) {
+        return variable_index == UNINITIALIZED_MEMORY_RECORD ? variable_index : map_variable(variable_index);
+    };
+    for (auto& rom_array : sub_builder.rom_ram_logic.rom_arrays) {
+        for (auto& entry : rom_array.state) {
+            entry = { map_memory_variable(entry[0]), map_memory_variable(entry[1]) };
+        }
+        for (auto& record : rom_array.records) {
+            record.index_witness = map_variable(record.index_witness);
+            record.value_column1_witness = map_variable(record.value_column1_witness);
+            record.value_column2_witness = map_variable(record.value_column2_witness);
+            record.record_witness = map_variable(record.record_witness);
+            record.gate_index += memory_gate_offset;
+        }
+        rom_ram_logic.rom_arrays.emplace_back(std::move(rom_array));
+    }
+    for (auto& ram_array : sub_builder.rom_ram_logic.ram_arrays) {
+        for (auto& entry : ram_array.state) {
+            entry = map_memory_variable(entry);
+        }
+        for (auto& record : ram_array.records) {
+            record.index_witness = map_variable(record.index_witness);
+            record.timestamp_witness = map_variable(record.timestamp_witness);
+            record.value_witness = map_variable(record.value_witness);
+            record.record_witness = map_variable(record.record_witness);
+            record.gate_index += memory_gate_offset;
+        }
+        rom_ram_logic.ram_arrays.emplace_back(std::move(ram_array));
+    }
+
+    // Tags are not carried over: the range constraints are applied again, which deals with variables that are already
+    // range constrained here. The first variables of each list hold the step values of the sub-builder's own copy of
+    // the range list and are left out.
+    for (const auto& [target_range, list] : sub_builder.range_lists) {
+        const size_t num_step_variables = target_range / DEFAULT_PLOOKUP_RANGE_STEP_SIZE + 2;
+        for (size_t i = num_step_variables; i < list.variable_indices.size(); ++i) {
+            create_new_range_constraint(map_variable(list.variable_indices[i]), target_range, "merge_sub_builder");
+        }
+    }
+
+    for (auto& multiplication : sub_builder.cached_partial_non_native_field_multiplications) {
+        for (size_t i = 0; i < 4; ++i) {
+            multiplication.a[i] = map_variable(multiplication.a[i]);
+            multiplication.b[i] = map_variable(multiplication.b[i]);
+        }
+        multiplication.lo_0 = map_variable(multiplication.lo_0);
+        multiplication.hi_0 = map_variable(multiplication.hi_0);
+        multiplication.hi_1 = map_variable(multiplication.hi_1);
+        cached_partial_non_native_field_multiplications.emplace_back(multiplication);
+    }
+    for (const uint32_t variable_index : sub_builder.used_witnesses) {
+        used_witnesses.emplace_back(map_variable(variable_index));
+    }
+    for (const auto& [variable_index, name] : sub_builder.variable_names) {
+        this->variable_names.try_emplace(map_variable(variable_index), name);
+    }
+    this->num_gates += sub_builder.num_gates;
+}
+
 /**
  * Export the existing circuit as msgpack compatible buffer.
  * Should be called after `finalize_circuit()`
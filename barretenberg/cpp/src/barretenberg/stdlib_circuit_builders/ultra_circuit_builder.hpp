@@ -792,7 +792,34 @@ class UltraCircuitBuilder_ : public CircuitBuilderBase<typename ExecutionTrace_:
     void create_poseidon2_external_gate(const poseidon2_external_gate_<FF>& in);
     void create_poseidon2_internal_gate(const poseidon2_internal_gate_<FF>& in);
 
+    /**
+     * Parallel construction
+     **/
+
+    /**
+     * @brief Create an empty builder for constructing part of this circuit, possibly on another thread
+     * @details The sub-builder starts with a copy of the values of all current variables, so that its gates can refer
+     * to them by their index in this builder, and of the constants, so that using one does not add a gate. It has no
+     * gates and no copy constraints of its own.
+     */
+    UltraCircuitBuilder_ create_sub_builder() const;
+
+    /**
+     * @brief Append the gates, variables and constraints of a sub-builder to this circuit
+     * @details Variables created by the sub-builder are appended to the variables of this builder, and its gates,
+     * copy cycles, range lists, lookup tables and ROM/RAM arrays are rewritten to refer to them. Merging the same
+     * sub-builders in the same order always results in the same circuit.
+     *
+     * @param sub_builder A builder obtained from create_sub_builder()
+     * @param num_shared_variables The number of variables this builder had when the sub-builder was created
+     */
+    void merge_sub_builder(UltraCircuitBuilder_&& sub_builder, size_t num_shared_variables);
+
     msgpack::sbuffer export_circuit() override;
+
+  private:
+    struct SubBuilderTag {};
+    UltraCircuitBuilder_(const UltraCircuitBuilder_& parent, SubBuilderTag /*unused*/);
 };
 using UltraCircuitBuilder = UltraCircuitBuilder_<UltraExecutionTraceBlocks>;
 } // namespace bb
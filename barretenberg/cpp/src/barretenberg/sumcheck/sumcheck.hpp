@@ -186,6 +186,12 @@ template <typename Flavor> class SumcheckProver {
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
 
+    // Fuse each round's partial evaluation into the next round's univariate computation. Needs a second book-keeping
+    // table of n/4 rows, so it is skipped in low memory mode.
+    bool use_blocked_rounds = sumcheck_blocked_rounds && !slow_low_memory && !specifiesUnivariateChunks<Flavor>;
+    // The table the blocked rounds alternate with #partially_evaluated_polynomials
+    PartiallyEvaluatedMultivariates blocked_rounds_table;
+
     // SumcheckProver constructor for the Flavors that generate NUM_SUBRELATIONS - 1 subrelation separator challenges.
     SumcheckProver(size_t multivariate_n,
                    ProverPolynomials& prover_polynomials,
@@ -253,7 +259,9 @@ template <typename Flavor> class SumcheckProver {
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_0");
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, round_challenge);
+            if (!defer_partial_evaluation(0)) {
+                partially_evaluate(full_polynomials, round_challenge);
+            }
             gate_separators.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
             // release memory?        // All but final round
@@ -264,16 +272,22 @@ template <typename Flavor> class SumcheckProver {
 
             // Write the round univariate to the transcript
             round_univariate =
-                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, gate_separators, alphas);
+                use_blocked_rounds
+                    ? compute_blocked_round_univariate(round_idx, multivariate_challenge.back(), gate_separators)
+                    : round.compute_univariate(
+                          partially_evaluated_polynomials, relation_parameters, gate_separators, alphas);
             // Place evaluations of Sumcheck Round Univariate in the transcript
             transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
             FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round.
-            partially_evaluate(partially_evaluated_polynomials, round_challenge);
+            if (!defer_partial_evaluation(round_idx)) {
+                partially_evaluate(partially_evaluated_polynomials, round_challenge);
+            }
             gate_separators.partially_evaluate(round_challenge);
             round.round_size = round.round_size >> 1;
         }
+        blocked_rounds_table = PartiallyEvaluatedMultivariates();
         vinfo("completed ", multivariate_d, " rounds of sumcheck");
 
         GateSeparatorPolynomial<FF> virtual_gate_separator(gate_challenges, multivariate_challenge);
@@ -372,7 +386,9 @@ template <typename Flavor> class SumcheckProver {
 
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round
-            partially_evaluate(full_polynomials, round_challenge);
+            if (!defer_partial_evaluation(0)) {
+                partially_evaluate(full_polynomials, round_challenge);
+            }
             // Prepare ZK Sumcheck data for the next round
             zk_sumcheck_data.update_zk_sumcheck_data(round_challenge, round_idx);
             row_disabling_polynomial.update_evaluations(round_challenge, round_idx);
@@ -387,7 +403,12 @@ template <typename Flavor> class SumcheckProver {
             // Computes the round univariate in two parts: first the contribution necessary to hide the polynomial and
             // account for having randomness at the end of the trace and then the contribution from the full
             // relation. Note: we compute the hiding univariate first as the `compute_univariate` method prepares
-            // relevant data structures for the next round
+            // relevant data structures for the next round. In blocked mode the book-keeping table of this round is
+            // only produced by the blocked univariate computation, so that comes first instead.
+            if (use_blocked_rounds) {
+                round_univariate =
+                    compute_blocked_round_univariate(round_idx, multivariate_challenge.back(), gate_separators);
+            }
             hiding_univariate = round.compute_hiding_univariate(round_idx,
                                                                 partially_evaluated_polynomials,
                                                                 relation_parameters,
@@ -395,8 +416,10 @@ template <typename Flavor> class SumcheckProver {
                                                                 alphas,
                                                                 zk_sumcheck_data,
                                                                 row_disabling_polynomial);
-            round_univariate =
-                round.compute_univariate(partially_evaluated_polynomials, relation_parameters, gate_separators, alphas);
+            if (!use_blocked_rounds) {
+                round_univariate = round.compute_univariate(
+                    partially_evaluated_polynomials, relation_parameters, gate_separators, alphas);
+            }
             round_univariate += hiding_univariate;
 
             if constexpr (!IsGrumpkinFlavor<Flavor>) {
@@ -412,7 +435,9 @@ template <typename Flavor> class SumcheckProver {
                 transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
             multivariate_challenge.emplace_back(round_challenge);
             // Prepare sumcheck book-keeping table for the next round.
-            partially_evaluate(partially_evaluated_polynomials, round_challenge);
+            if (!defer_partial_evaluation(round_idx)) {
+                partially_evaluate(partially_evaluated_polynomials, round_challenge);
+            }
             // Prepare evaluation masking and libra structures for the next round (for ZK Flavors)
             zk_sumcheck_data.update_zk_sumcheck_data(round_challenge, round_idx);
             row_disabling_polynomial.update_evaluations(round_challenge, round_idx);
@@ -421,6 +446,8 @@ template <typename Flavor> class SumcheckProver {
             round.round_size = round.round_size >> 1;
         }
 
+        blocked_rounds_table = PartiallyEvaluatedMultivariates();
+
         if constexpr (IsGrumpkinFlavor<Flavor>) {
             round_evaluations[multivariate_d - 1][2] =
                 round_univariate.evaluate(multivariate_challenge[multivariate_d - 1]);
@@ -502,14 +529,28 @@ template <typename Flavor> class SumcheckProver {
      */
     void partially_evaluate(auto& polynomials, const FF& round_challenge)
     {
+        PROFILE_THIS_NAME("partially_evaluate");
+
         auto pep_view = partially_evaluated_polynomials.get_all();
         auto poly_view = polynomials.get_all();
+        // In slow_low_memory mode, read ahead one file-backed chunk at a time. In the first round the full polynomials
+        // are not needed again by sumcheck, so they are also evicted as we go.
+        const size_t prefetch_window =
+            file_backed_memory::is_active() ? std::max(file_backed_memory::get_chunk_size() / sizeof(FF), size_t{ 2 })
+                                            : 0;
         // after the first round, operate in place on partially_evaluated_polynomials
         parallel_for(poly_view.size(), [&](size_t j) {
             const auto& poly = poly_view[j];
+            const bool in_place = poly.data() == pep_view[j].data();
             // The polynomial is shorter than the round size.
             size_t limit = poly.end_index();
             for (size_t i = 0; i < limit; i += 2) {
+                if (prefetch_window != 0 && i % prefetch_window < 2) {
+                    poly.prefetch(i + prefetch_window, i + (2 * prefetch_window));
+                    if (!in_place && i >= prefetch_window) {
+                        poly.release(i - prefetch_window, i);
+                    }
+                }
                 pep_view[j].at(i >> 1) = poly[i] + round_challenge * (poly[i + 1] - poly[i]);
             }
 
@@ -547,6 +588,55 @@ template <typename Flavor> class SumcheckProver {
         });
     };
 
+    /**
+     * @brief In blocked mode, the partial evaluation after every round but the last is done by the next round's
+     * univariate computation
+     */
+    bool defer_partial_evaluation(size_t round_idx) const
+    {
+        return use_blocked_rounds && round_idx + 1 < multivariate_d;
+    }
+
+    /**
+     * @brief Blocked mode: partially evaluate the previous round's table at its challenge and compute the univariate of
+     * round `round_idx` in one pass, see SumcheckProverRound::compute_univariate_blocked
+     * @details Round 1 reads the prover polynomials and writes #partially_evaluated_polynomials. Later rounds write to
+     * #blocked_rounds_table and swap it with #partially_evaluated_polynomials, so the latter always holds the current
+     * round's table.
+     */
+    SumcheckRoundUnivariate compute_blocked_round_univariate(size_t round_idx,
+                                                             const FF& previous_challenge,
+                                                             const GateSeparatorPolynomial<FF>& gate_separators)
+    {
+        if constexpr (specifiesUnivariateChunks<Flavor>) {
+            throw_or_abort("Blocked sumcheck rounds are not supported for flavors with univariate chunks");
+        } else {
+            if (round_idx == 1) {
+                return round.compute_univariate_blocked(full_polynomials,
+                                                        partially_evaluated_polynomials,
+                                                        previous_challenge,
+                                                        relation_parameters,
+                                                        gate_separators,
+                                                        alphas);
+            }
+            if (round_idx == 2) {
+                for (auto [table_poly, poly] :
+                     zip_view(blocked_rounds_table.get_all(), partially_evaluated_polynomials.get_all())) {
+                    const size_t limit = poly.end_index();
+                    table_poly = typename Flavor::Polynomial(limit / 2 + limit % 2, multivariate_n / 4);
+                }
+            }
+            auto round_univariate = round.compute_univariate_blocked(partially_evaluated_polynomials,
+                                                                     blocked_rounds_table,
+                                                                     previous_challenge,
+                                                                     relation_parameters,
+                                                                     gate_separators,
+                                                                     alphas);
+            std::swap(partially_evaluated_polynomials, blocked_rounds_table);
+            return round_univariate;
+        }
+    }
+
     /**
      * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
      * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$. For ZK
@@ -172,7 +172,7 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
     }
 
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
-    void test_prover_verifier_flow()
+    void test_prover_verifier_flow(bool use_blocked_rounds = false)
     {
         const size_t multivariate_d(3);
         const size_t multivariate_n(1 << multivariate_d);
@@ -265,6 +265,7 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
                                                prover_gate_challenges,
                                                relation_parameters,
                                                virtual_log_n);
+        sumcheck_prover.use_blocked_rounds = use_blocked_rounds;
 
         SumcheckOutput<Flavor> output;
         if constexpr (Flavor::HasZK) {
@@ -404,6 +405,64 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
 
         EXPECT_EQ(verified, false);
     };
+
+    /**
+     * @brief Check that blocked rounds produce exactly the same proof as the unblocked ones
+     */
+    void test_blocked_rounds_match_unblocked()
+    {
+        // Large enough for several threads and tiles per round
+        const size_t multivariate_d(12);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Polynomials of different (and odd) sizes, as for structured traces
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+            const size_t size = (multivariate_n >> (i % 3)) - (i % 2);
+            random_polynomials[i] = Polynomial<FF>(size, multivariate_n);
+            for (size_t j = 0; j < size; ++j) {
+                random_polynomials[i].at(j) = FF::random_element();
+            }
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+        RelationParameters<FF> relation_parameters{
+            .beta = FF::random_element(),
+            .gamma = FF::random_element(),
+            .public_input_delta = FF::random_element(),
+        };
+
+        auto prove = [&](bool use_blocked_rounds) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            SubrelationSeparators alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < multivariate_d; idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            SumcheckProver<Flavor> sumcheck(multivariate_n,
+                                            full_polynomials,
+                                            transcript,
+                                            alpha,
+                                            gate_challenges,
+                                            relation_parameters,
+                                            multivariate_d);
+            sumcheck.use_blocked_rounds = use_blocked_rounds;
+            auto output = sumcheck.prove();
+            return std::make_pair(output, transcript->export_proof());
+        };
+
+        auto [expected_output, expected_proof] = prove(false);
+        auto [output, proof] = prove(true);
+        EXPECT_EQ(proof, expected_proof);
+        EXPECT_EQ(output.challenge, expected_output.challenge);
+        for (auto [evaluation, expected_evaluation] :
+             zip_view(output.claimed_evaluations.get_all(), expected_output.claimed_evaluations.get_all())) {
+            EXPECT_EQ(evaluation, expected_evaluation);
+        }
+    }
 };
 
 // Define the FlavorTypes
@@ -438,6 +497,19 @@ TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
     this->test_prover_verifier_flow();
 }
+// Tests the prover-verifier flow with blocked sumcheck rounds
+TYPED_TEST(SumcheckTests, ProverAndVerifierBlockedRounds)
+{
+    this->test_prover_verifier_flow(/*use_blocked_rounds=*/true);
+}
+TYPED_TEST(SumcheckTests, BlockedRoundsMatchUnblocked)
+{
+    if constexpr (!TypeParam::HasZK) {
+        this->test_blocked_rounds_match_unblocked();
+    } else {
+        GTEST_SKIP() << "The ZK prover masks the round univariates with fresh randomness";
+    }
+}
 // This tests is fed an invalid circuit and checks that the verifier would output false.
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimpleFailure)
 {
@@ -14,6 +14,9 @@
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/stdlib/primitives/bool/bool.hpp"
 #include "zk_sumcheck_data.hpp"
+#include <bit>
+#include <cstdlib>
+#include <string>
 
 namespace bb {
 
@@ -22,6 +25,12 @@ namespace bb {
 template <typename Flavor>
 concept specifiesUnivariateChunks = std::convertible_to<decltype(Flavor::MAX_CHUNK_THREAD_PORTION_SIZE), size_t>;
 
+// Whether SumcheckProver fuses the partial evaluation of each round into the univariate computation of the next (see
+// SumcheckProverRound::compute_univariate_blocked). Defaults to the BB_SUMCHECK_BLOCKED environment variable.
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+inline bool sumcheck_blocked_rounds =
+    std::getenv("BB_SUMCHECK_BLOCKED") == nullptr ? false : std::string(std::getenv("BB_SUMCHECK_BLOCKED")) == "1";
+
 /*! \brief Imlementation of the Sumcheck prover round.
     \class SumcheckProverRound
     \details
@@ -139,6 +148,30 @@ template <typename Flavor> class SumcheckProverRound {
             }
         }
     }
+    /**
+     * @brief In slow_low_memory mode, keep the rows [row, row + 2 * window) of all polynomials prefetched, where the
+     * window is one file-backed memory chunk worth of rows
+     * @details This way the chunk after the one being processed is read in the background instead of being faulted in
+     * page by page. `prefetched_until` tracks the progress of the calling thread and should start at 0.
+     */
+    template <typename ProverPolynomialsOrPartiallyEvaluatedMultivariates>
+    static void prefetch_rows_ahead(const ProverPolynomialsOrPartiallyEvaluatedMultivariates& polynomials,
+                                    size_t row,
+                                    size_t& prefetched_until)
+    {
+        if (!file_backed_memory::is_active()) {
+            return;
+        }
+        const size_t window = std::max(file_backed_memory::get_chunk_size() / sizeof(FF), size_t{ 1 });
+        if (prefetched_until < row + window) {
+            const size_t start = std::max(prefetched_until, row);
+            prefetched_until = row + (2 * window);
+            for (const auto& poly : polynomials.get_all()) {
+                poly.prefetch(start, prefetched_until);
+            }
+        }
+    }
+
     /**
      * @brief Return the evaluations of the univariate round polynomials. Toggles between chunked computation
      * (designed with the AVM in mind) and a version which intelligently allows from row-skipped functionality
@@ -266,9 +299,14 @@ template <typename Flavor> class SumcheckProverRound {
         parallel_for(num_threads, [&](size_t thread_idx) {
             // Construct extended univariates containers; one per thread
             ExtendedEdges extended_edges;
+            size_t prefetched_until = 0;
             for (size_t chunk_idx = 0; chunk_idx < num_of_chunks; chunk_idx++) {
                 size_t start = chunk_idx * chunk_size + thread_idx * chunk_thread_portion_size;
                 size_t end = chunk_idx * chunk_size + (thread_idx + 1) * chunk_thread_portion_size;
+                // All threads sweep the rows together one chunk at a time, so one of them prefetching is enough
+                if (thread_idx == 0) {
+                    prefetch_rows_ahead(polynomials, chunk_idx * chunk_size, prefetched_until);
+                }
                 for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
                     extend_edges(extended_edges, polynomials, edge_idx);
                     // Compute the \f$ \ell \f$-th edge's univariate contribution,
@@ -293,6 +331,96 @@ template <typename Flavor> class SumcheckProverRound {
         return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alphas, gate_separators);
     }
 
+    /**
+     * @brief Rows per tile in compute_univariate_blocked, sized so that the rows of all polynomials read and written
+     * for a tile (about 3 * NUM_ALL_ENTITIES field elements per row) stay within a typical L2 cache
+     */
+    static constexpr size_t BLOCKED_TILE_SIZE =
+        std::max(std::bit_floor((size_t{ 1 } << 19) / (3 * Flavor::NUM_ALL_ENTITIES * sizeof(FF))), size_t{ 2 });
+
+    /**
+     * @brief Blocked version of a round: partially evaluate the previous round's table at its challenge and compute the
+     * univariate of the current round in a single pass over memory
+     * @details The unblocked prover streams every polynomial from memory twice per round, once in `compute_univariate`
+     * and once in `SumcheckProver::partially_evaluate`. Here each thread walks its share of the new table in tiles of
+     * BLOCKED_TILE_SIZE rows. For each tile it first writes row \f$ \ell \f$ of every destination polynomial from rows
+     * \f$ 2\ell, 2\ell + 1 \f$ of the source, then extends the edges and accumulates the relations on the tile while it
+     * is still in cache. The result equals that of `partially_evaluate` followed by `compute_univariate`.
+     *
+     * A tile reads source rows at twice the index of the destination rows it writes, so doing this in place would race
+     * with other threads: `source` and `destination` must be distinct tables. Flavors that specify univariate chunks
+     * (the AVM) always use the unblocked rounds.
+     *
+     * @param source The table of the previous round (the prover polynomials in round 1)
+     * @param destination Receives the table of the current round; its polynomials must have at least the new size
+     * @param previous_challenge \f$ u_{i-1} \f$
+     * @note round_size must already be set to the size of the current round.
+     */
+    template <typename SourcePolynomials, typename DestinationPolynomials>
+    SumcheckRoundUnivariate compute_univariate_blocked(const SourcePolynomials& source,
+                                                       DestinationPolynomials& destination,
+                                                       const FF& previous_challenge,
+                                                       const bb::RelationParameters<FF>& relation_parameters,
+                                                       const bb::GateSeparatorPolynomial<FF>& gate_separators,
+                                                       const SubrelationSeparators& alphas)
+    {
+        PROFILE_THIS_NAME("compute_univariate_blocked");
+
+        auto source_view = source.get_all();
+        auto destination_view = destination.get_all();
+        // The new table has CEIL(limit / 2) rows. Shrinking first makes rows left over in the destination from earlier
+        // rounds read as zero when extending edges.
+        for (auto [destination_poly, source_poly] : zip_view(destination_view, source_view)) {
+            const size_t limit = source_poly.end_index();
+            destination_poly.shrink_end_index(limit / 2 + limit % 2);
+        }
+
+        size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
+        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
+        size_t rows_per_thread = round_size / num_threads;
+        // Construct univariate accumulator containers; one per thread
+        // Note: std::vector will trigger {}-initialization of the contents. Therefore no need to zero the univariates.
+        std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
+
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            // Construct extended univariates containers; one per thread
+            ExtendedEdges extended_edges;
+            const size_t thread_end = (thread_idx + 1) * rows_per_thread;
+            for (size_t tile_start = thread_idx * rows_per_thread; tile_start < thread_end;
+                 tile_start += BLOCKED_TILE_SIZE) {
+                const size_t tile_end = std::min(tile_start + BLOCKED_TILE_SIZE, thread_end);
+                // Partially evaluate the tile, one polynomial at a time to keep the reads sequential
+                for (auto [destination_poly, source_poly] : zip_view(destination_view, source_view)) {
+                    const size_t end = std::min(tile_end, destination_poly.end_index());
+                    for (size_t row = tile_start; row < end; ++row) {
+                        const FF& even = source_poly[2 * row];
+                        destination_poly.at(row) = even + previous_challenge * (source_poly[(2 * row) + 1] - even);
+                    }
+                }
+                // Accumulate the contribution of each edge of the tile; see compute_univariate_with_row_skipping
+                for (size_t edge_idx = tile_start; edge_idx < tile_end; edge_idx += 2) {
+                    if constexpr (isRowSkippable<Flavor, DestinationPolynomials, size_t>) {
+                        if (Flavor::skip_entire_row(destination, edge_idx)) {
+                            continue;
+                        }
+                    }
+                    extend_edges(extended_edges, destination, edge_idx);
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges,
+                                                    relation_parameters,
+                                                    gate_separators[(edge_idx >> 1) * gate_separators.periodicity]);
+                }
+            }
+        });
+
+        // Accumulate the per-thread univariate accumulators into a single set of accumulators
+        for (auto& accumulators : thread_univariate_accumulators) {
+            Utils::add_nested_tuples(univariate_accumulators, accumulators);
+        }
+        // Batch the univariate contributions from each sub-relation to obtain the round univariate
+        return batch_over_relations<SumcheckRoundUnivariate>(univariate_accumulators, alphas, gate_separators);
+    }
+
     /**
      * @brief Helper struct that describes a block of non-zero unskippable rows
      */
@@ -439,8 +567,10 @@ template <typename Flavor> class SumcheckProverRound {
             RowIterator edge_iterator(round_manifest, start);
             // Construct extended univariates containers; one per thread
             ExtendedEdges extended_edges;
+            size_t prefetched_until = 0;
             for (size_t i = start; i < end; ++i) {
                 size_t edge_idx = edge_iterator.get_next_edge();
+                prefetch_rows_ahead(polynomials, edge_idx, prefetched_until);
                 extend_edges(extended_edges, polynomials, edge_idx);
                 // Compute the \f$ \ell \f$-th edge's univariate contribution,
                 // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
@@ -13,15 +13,19 @@ using namespace bb::avm2::simulation;
 std::pair<AvmAPI::AvmProof, AvmAPI::AvmVerificationKey> AvmAPI::prove(const AvmAPI::ProvingInputs& inputs)
 {
     // Simulate.
+    // The traces of some subsystems are generated on other threads while simulating.
     info("Simulating...");
+    // The trace is declared first so that it outlives the streaming workers, even if the simulation throws.
+    tracegen::TraceContainer trace;
+    AvmTraceGenHelper tracegen_helper;
     AvmSimulationHelper simulation_helper(inputs.hints);
-    auto events = AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate());
+    auto events =
+        AVM_TRACK_TIME_V("simulation/all", simulation_helper.simulate(tracegen_helper.start_streaming(trace)));
+    AVM_TRACK_TIME("tracegen/streaming", tracegen_helper.finish_streaming());
 
     // Generate trace.
     info("Generating trace...");
-    AvmTraceGenHelper tracegen_helper;
-    auto trace =
-        AVM_TRACK_TIME_V("tracegen/all", tracegen_helper.generate_trace(std::move(events), inputs.publicInputs));
+    AVM_TRACK_TIME("tracegen/all", tracegen_helper.generate_trace(trace, std::move(events), inputs.publicInputs));
 
     // Prove.
     info("Proving...");
@@ -1,6 +1,8 @@
 #include "barretenberg/vm2/constraining/polynomials.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <span>
 
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/vm2/common/constants.hpp"
@@ -68,9 +70,16 @@ AvmProver::ProverPolynomials compute_polynomials(tracegen::TraceContainer& trace
                            auto& poly = unshifted[i];
                            Column col = static_cast<Column>(i);
 
-                           trace.visit_column(col, [&](size_t row, const AvmProver::FF& value) {
-                               // We use `at` because we are sure the row exists and the value is non-zero.
-                               poly.at(row) = value;
+                           // The trace is stored densely, so we copy whole chunks of rows at a time.
+                           // Rows past the end of the polynomial are zero and are dropped.
+                           trace.visit_column_chunks(col, [&](size_t first_row, std::span<const AvmProver::FF> chunk) {
+                               const size_t start = std::max(first_row, poly.start_index());
+                               const size_t end = std::min(first_row + chunk.size(), poly.end_index());
+                               if (start < end) {
+                                   std::copy(chunk.begin() + static_cast<std::ptrdiff_t>(start - first_row),
+                                             chunk.begin() + static_cast<std::ptrdiff_t>(end - first_row),
+                                             poly.data() + (start - poly.start_index()));
+                               }
                            });
                            // We free columns as we go.
                            // TODO: If we merge the init with the setting, this would be even more memory efficient.
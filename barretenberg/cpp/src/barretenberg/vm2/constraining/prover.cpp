@@ -17,6 +17,12 @@ namespace bb::avm2 {
 using Flavor = AvmFlavor;
 using FF = Flavor::FF;
 
+namespace {
+// Maximum number of polynomials committed to in one batched MSM. The MSM holds the indices of every non-zero scalar
+// in the batch at once, so this bounds its memory for the full-size columns of a large trace.
+constexpr size_t MAX_COMMIT_BATCH_SIZE = 64;
+} // namespace
+
 /**
  * Create AvmProver from proving key, witness and manifest.
  *
@@ -53,12 +59,17 @@ void AvmProver::execute_preamble_round()
 void AvmProver::execute_wire_commitments_round()
 {
     // Commit to all polynomials (apart from logderivative inverse polynomials, which are committed to in the later
-    // logderivative phase)
+    // logderivative phase). Most wires are short and sparse, so we commit to all of them in one batched MSM.
     auto wire_polys = prover_polynomials.get_wires();
     const auto& labels = prover_polynomials.get_wires_labels();
+    std::vector<PolynomialSpan<const FF>> wire_spans;
+    wire_spans.reserve(wire_polys.size());
+    for (const auto& poly : wire_polys) {
+        wire_spans.emplace_back(poly);
+    }
+    auto commitments = commitment_key.batch_commit(wire_spans, MAX_COMMIT_BATCH_SIZE);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        auto comm = commitment_key.commit(wire_polys[idx]);
-        transcript->send_to_verifier(labels[idx], comm);
+        transcript->send_to_verifier(labels[idx], commitments[idx]);
     }
 }
 
@@ -84,8 +95,13 @@ void AvmProver::execute_log_derivative_inverse_round()
 void AvmProver::execute_log_derivative_inverse_commitments_round()
 {
     // Commit to all logderivative inverse polynomials
-    for (auto [commitment, key_poly] : zip_view(witness_commitments.get_derived(), key->get_derived())) {
-        commitment = commitment_key.commit(key_poly);
+    std::vector<PolynomialSpan<const FF>> derived_spans;
+    for (const auto& poly : key->get_derived()) {
+        derived_spans.emplace_back(poly);
+    }
+    auto commitments = commitment_key.batch_commit(derived_spans, MAX_COMMIT_BATCH_SIZE);
+    for (auto [commitment, derived_commitment] : zip_view(witness_commitments.get_derived(), commitments)) {
+        commitment = derived_commitment;
     }
 
     // Send all commitments to the verifier
@@ -67,7 +67,7 @@ BytecodeId TxBytecodeManager::get_bytecode(const AztecAddress& address)
     decomposition_events.emit({ .bytecode_id = bytecode_id, .bytecode = shared_bytecode });
 
     // We now save the bytecode so that we don't repeat this process.
-    bytecodes.emplace(bytecode_id, std::move(shared_bytecode));
+    bytecodes.emplace(bytecode_id, ProcessedBytecode{ .bytecode = std::move(shared_bytecode) });
 
     auto tree_states = merkle_db.get_tree_state();
 
@@ -83,6 +83,31 @@ BytecodeId TxBytecodeManager::get_bytecode(const AztecAddress& address)
     return bytecode_id;
 }
 
+TxBytecodeManager::DecodedInstruction TxBytecodeManager::decode_instruction(const std::vector<uint8_t>& bytecode,
+                                                                          uint32_t pc)
+{
+    DecodedInstruction decoded;
+
+    try {
+        decoded.instruction = deserialize_instruction(bytecode, pc);
+
+        // If the following code is executed, no error was thrown in deserialize_instruction().
+        if (!check_tag(decoded.instruction)) {
+            decoded.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
+        };
+    } catch (const InstrDeserializationError& error) {
+        decoded.error = error;
+    }
+
+    // FIXME: remove this once all execution opcodes are supported.
+    if (!decoded.error.has_value() && !EXEC_INSTRUCTION_SPEC.contains(decoded.instruction.get_exec_opcode())) {
+        vinfo("Invalid execution opcode: ", decoded.instruction.get_exec_opcode(), " at pc: ", pc);
+        decoded.error = InstrDeserializationError::INVALID_EXECUTION_OPCODE;
+    }
+
+    return decoded;
+}
+
 Instruction TxBytecodeManager::read_instruction(BytecodeId bytecode_id, uint32_t pc)
 {
     // We'll be filling in the event as we progress.
@@ -95,28 +120,15 @@ Instruction TxBytecodeManager::read_instruction(BytecodeId bytecode_id, uint32_t
     instr_fetching_event.bytecode_id = bytecode_id;
     instr_fetching_event.pc = pc;
 
-    auto bytecode_ptr = it->second;
+    auto& [bytecode_ptr, decoded_instructions] = it->second;
     instr_fetching_event.bytecode = bytecode_ptr;
 
-    const auto& bytecode = *bytecode_ptr;
-
-    try {
-        instr_fetching_event.instruction = deserialize_instruction(bytecode, pc);
-
-        // If the following code is executed, no error was thrown in deserialize_instruction().
-        if (!check_tag(instr_fetching_event.instruction)) {
-            instr_fetching_event.error = InstrDeserializationError::TAG_OUT_OF_RANGE;
-        };
-    } catch (const InstrDeserializationError& error) {
-        instr_fetching_event.error = error;
-    }
-
-    // FIXME: remove this once all execution opcodes are supported.
-    if (!instr_fetching_event.error.has_value() &&
-        !EXEC_INSTRUCTION_SPEC.contains(instr_fetching_event.instruction.get_exec_opcode())) {
-        vinfo("Invalid execution opcode: ", instr_fetching_event.instruction.get_exec_opcode(), " at pc: ", pc);
-        instr_fetching_event.error = InstrDeserializationError::INVALID_EXECUTION_OPCODE;
+    auto decoded_it = decoded_instructions.find(pc);
+    if (decoded_it == decoded_instructions.end()) {
+        decoded_it = decoded_instructions.emplace(pc, decode_instruction(*bytecode_ptr, pc)).first;
     }
+    instr_fetching_event.instruction = decoded_it->second.instruction;
+    instr_fetching_event.error = decoded_it->second.error;
 
     // We are showing whether bytecode_size > pc or not. If there is no fetching error,
     // we always have bytecode_size > pc.
@@ -81,7 +81,20 @@ class TxBytecodeManager : public TxBytecodeManagerInterface {
     EventEmitterInterface<BytecodeRetrievalEvent>& retrieval_events;
     EventEmitterInterface<BytecodeDecompositionEvent>& decomposition_events;
     EventEmitterInterface<InstructionFetchingEvent>& fetching_events;
-    unordered_flat_map<BytecodeId, std::shared_ptr<std::vector<uint8_t>>> bytecodes;
+
+    // Decoding only depends on the bytecode, so each pc is decoded once and reused by every later fetch.
+    struct DecodedInstruction {
+        Instruction instruction;
+        std::optional<InstrDeserializationError> error;
+    };
+    struct ProcessedBytecode {
+        std::shared_ptr<std::vector<uint8_t>> bytecode;
+        // Keyed by pc, filled in as instructions are fetched.
+        unordered_flat_map<uint32_t, DecodedInstruction> decoded_instructions;
+    };
+    unordered_flat_map<BytecodeId, ProcessedBytecode> bytecodes;
+
+    static DecodedInstruction decode_instruction(const std::vector<uint8_t>& bytecode, uint32_t pc);
 };
 
 // Manages the bytecode of a single nested call.
@@ -7,6 +7,7 @@
 #include <optional>
 #include <vector>
 
+#include "barretenberg/vm2/common/aztec_constants.hpp"
 #include "barretenberg/vm2/common/aztec_types.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/simulation/bytecode_hashing.hpp"
@@ -16,6 +17,7 @@
 #include "barretenberg/vm2/simulation/testing/mock_poseidon2.hpp"
 #include "barretenberg/vm2/simulation/testing/mock_range_check.hpp"
 #include "barretenberg/vm2/testing/fixtures.hpp"
+#include "barretenberg/vm2/testing/instruction_builder.hpp"
 
 using ::testing::_;
 using ::testing::Return;
@@ -152,5 +154,58 @@ TEST_F(BytecodeManagerTest, RetrievalAndDeduplication)
     EXPECT_THAT(decomposition_events_dump, SizeIs(0)); // No decomposition for deduplicated bytecode
 }
 
+TEST_F(BytecodeManagerTest, ReadInstructionFromCache)
+{
+    TxBytecodeManager tx_bytecode_manager(contract_db,
+                                          merkle_db,
+                                          bytecode_hasher,
+                                          range_check,
+                                          contract_instance_manager,
+                                          retrieval_events,
+                                          decomposition_events,
+                                          instruction_fetching_events);
+
+    Instruction add = testing::InstructionBuilder(WireOpCode::ADD_8)
+                          .operand<uint8_t>(1)
+                          .operand<uint8_t>(2)
+                          .operand<uint8_t>(3)
+                          .build();
+    AztecAddress address = AztecAddress::random_element();
+    ContractInstance instance = testing::random_contract_instance();
+    ContractClass klass = testing::random_contract_class();
+    klass.packed_bytecode = add.serialize();
+    const uint32_t bytecode_size = static_cast<uint32_t>(klass.packed_bytecode.size());
+
+    EXPECT_CALL(contract_instance_manager, get_contract_instance(address))
+        .WillOnce(Return(std::make_optional(instance)));
+    EXPECT_CALL(contract_db, get_contract_class(instance.current_class_id))
+        .WillOnce(Return(std::make_optional(klass)));
+    EXPECT_CALL(poseidon2, hash(_)).WillOnce(Return(klass.public_bytecode_commitment));
+    EXPECT_CALL(merkle_db, get_tree_state()).WillOnce(Return(TreeStates{}));
+    BytecodeId bytecode_id = tx_bytecode_manager.get_bytecode(address);
+
+    // The second read is served from the decoded instructions, but still emits its event and range check.
+    EXPECT_CALL(range_check, assert_range(bytecode_size - 1, AVM_PC_SIZE_IN_BITS)).Times(2);
+    EXPECT_EQ(tx_bytecode_manager.read_instruction(bytecode_id, 0), add);
+    EXPECT_EQ(tx_bytecode_manager.read_instruction(bytecode_id, 0), add);
+
+    auto fetching_events_dump = instruction_fetching_events.dump_events();
+    EXPECT_THAT(fetching_events_dump, SizeIs(2));
+    for (const auto& event : fetching_events_dump) {
+        EXPECT_EQ(event.bytecode_id, bytecode_id);
+        EXPECT_EQ(event.pc, 0U);
+        EXPECT_EQ(event.instruction, add);
+        EXPECT_FALSE(event.error.has_value());
+    }
+
+    // Reading past the end of the bytecode still fails.
+    EXPECT_CALL(range_check, assert_range(0, AVM_PC_SIZE_IN_BITS));
+    EXPECT_THROW(tx_bytecode_manager.read_instruction(bytecode_id, bytecode_size), InstructionFetchingError);
+
+    fetching_events_dump = instruction_fetching_events.dump_events();
+    EXPECT_THAT(fetching_events_dump, SizeIs(1));
+    EXPECT_EQ(fetching_events_dump[0].error, InstrDeserializationError::PC_OUT_OF_RANGE);
+}
+
 } // namespace
 } // namespace bb::avm2::simulation
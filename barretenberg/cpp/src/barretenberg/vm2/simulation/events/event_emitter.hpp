@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cassert>
+#include <cstddef>
+#include <functional>
 #include <vector>
 
 #include "barretenberg/vm2/common/set.hpp"
@@ -19,9 +21,32 @@ template <typename Event> class EventEmitterInterface {
 template <typename Event> class EventEmitter : public EventEmitterInterface<Event> {
   public:
     using Container = std::vector<Event>;
+    // Receives a batch of events, in the order they were emitted.
+    using BatchHandler = std::function<void(Container&&)>;
 
     virtual ~EventEmitter() = default;
-    void emit(Event&& event) override { events.push_back(std::move(event)); };
+    void emit(Event&& event) override
+    {
+        events.push_back(std::move(event));
+        if (batch_handler && events.size() >= batch_size) {
+            flush();
+        }
+    };
+
+    // Hands the events over to the handler in batches of batch_size as they are emitted, instead of keeping them
+    // until they are dumped. Events that don't fill a batch are handed over by flush().
+    void set_batch_handler(size_t batch_size, BatchHandler handler)
+    {
+        this->batch_size = batch_size;
+        batch_handler = std::move(handler);
+    }
+    void flush()
+    {
+        if (batch_handler && !events.empty()) {
+            batch_handler(std::move(events));
+            events = Container();
+        }
+    }
 
     const Container& get_events() const { return events; }
     // Transfers ownership of the events to the caller (clears the internal container).
@@ -29,6 +54,8 @@ template <typename Event> class EventEmitter : public EventEmitterInterface<Even
 
   private:
     Container events;
+    size_t batch_size = 0;
+    BatchHandler batch_handler;
 };
 
 // This is an EventEmitter that eagerly deduplicates events based on a provided key.
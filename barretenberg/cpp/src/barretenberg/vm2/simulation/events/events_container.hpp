@@ -77,4 +77,14 @@ struct EventsContainer {
     EventEmitterInterface<EmitUnencryptedLogEvent>::Container emit_unencrypted_log_events;
 };
 
+// Handlers that receive the events of some subsystems in batches while the simulation is running, instead of in the
+// EventsContainer once it has finished. Subsystems without a handler are collected as usual.
+struct EventBatchHandlers {
+    size_t batch_size = 0;
+    EventEmitter<BitwiseEvent>::BatchHandler bitwise;
+    EventEmitter<FieldGreaterThanEvent>::BatchHandler field_gt;
+    EventEmitter<Poseidon2HashEvent>::BatchHandler poseidon2_hash;
+    EventEmitter<Poseidon2PermutationEvent>::BatchHandler poseidon2_permutation;
+};
+
 } // namespace bb::avm2::simulation
@@ -1087,7 +1087,10 @@ ExecutionResult Execution::execute(std::unique_ptr<ContextInterface> enqueued_ca
             Instruction instruction = context.get_bytecode_manager().read_instruction(pc);
 
             ex_event.wire_instruction = instruction;
-            debug("@", pc, " ", instruction.to_string());
+            // Stringifying every instruction is costly even when the log is discarded.
+            if (debug_logging) {
+                debug("@", pc, " ", instruction.to_string());
+            }
             context.set_next_pc(pc + static_cast<uint32_t>(instruction.size_in_bytes()));
 
             //// Temporality group 4 starts ////
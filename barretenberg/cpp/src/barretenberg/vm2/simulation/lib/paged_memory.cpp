@@ -0,0 +1,32 @@
+#include "barretenberg/vm2/simulation/lib/paged_memory.hpp"
+
+namespace bb::avm2::simulation {
+
+const MemoryValue& PagedMemory::default_value()
+{
+    static const auto value = MemoryValue::from<FF>(0);
+    return value;
+}
+
+PagedMemory::Page* PagedMemory::find_page_slow(uint32_t page_index) const
+{
+    auto it = pages.find(page_index);
+    if (it == pages.end()) {
+        // Don't cache misses, the page might be created by the next set.
+        return nullptr;
+    }
+    cache[page_index % PAGE_CACHE_SIZE] = { .page_index = page_index, .page = it->second.get() };
+    return it->second.get();
+}
+
+PagedMemory::Page& PagedMemory::create_page(uint32_t page_index)
+{
+    auto page = std::make_unique<Page>();
+    page->fill(default_value());
+    Page& result = *page;
+    pages.emplace(page_index, std::move(page));
+    cache[page_index % PAGE_CACHE_SIZE] = { .page_index = page_index, .page = &result };
+    return result;
+}
+
+} // namespace bb::avm2::simulation
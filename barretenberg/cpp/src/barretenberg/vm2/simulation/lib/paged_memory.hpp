@@ -0,0 +1,68 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "barretenberg/vm2/common/map.hpp"
+#include "barretenberg/vm2/common/memory_types.hpp"
+
+namespace bb::avm2::simulation {
+
+// Storage for one memory space. The address space is split in pages of PAGE_SIZE slots which are only allocated
+// when first written to, unwritten slots read as FF(0). Most programs only touch a handful of pages, so the last
+// pages used are kept in a small direct-mapped cache and the page table is only hit when switching pages.
+//
+// Pages are never moved or freed, so a reference returned by get stays valid for the lifetime of the memory.
+// This is stronger than what MemoryInterface promises.
+class PagedMemory {
+  public:
+    static constexpr size_t PAGE_BITS = 12;
+    static constexpr size_t PAGE_SIZE = 1 << PAGE_BITS;
+    static constexpr size_t PAGE_CACHE_SIZE = 4;
+
+    const MemoryValue& get(MemoryAddress index) const
+    {
+        const Page* page = find_page(page_index(index));
+        return page != nullptr ? (*page)[slot_index(index)] : default_value();
+    }
+    void set(MemoryAddress index, MemoryValue value)
+    {
+        get_or_create_page(page_index(index))[slot_index(index)] = value;
+    }
+
+    size_t num_pages() const { return pages.size(); }
+
+  private:
+    // MemoryValue's variant index already is the tag, a separate tag array would not make the slots smaller.
+    using Page = std::array<MemoryValue, PAGE_SIZE>;
+
+    struct CachedPage {
+        // Page indices are at most 2^(32 - PAGE_BITS), so this can't be a valid one.
+        uint32_t page_index = UINT32_MAX;
+        Page* page = nullptr;
+    };
+
+    static uint32_t page_index(MemoryAddress index) { return index >> PAGE_BITS; }
+    static size_t slot_index(MemoryAddress index) { return index & (PAGE_SIZE - 1); }
+    static const MemoryValue& default_value();
+
+    Page* find_page(uint32_t page_index) const
+    {
+        const CachedPage& cached = cache[page_index % PAGE_CACHE_SIZE];
+        return cached.page_index == page_index ? cached.page : find_page_slow(page_index);
+    }
+    Page& get_or_create_page(uint32_t page_index)
+    {
+        Page* page = find_page(page_index);
+        return page != nullptr ? *page : create_page(page_index);
+    }
+    Page* find_page_slow(uint32_t page_index) const;
+    Page& create_page(uint32_t page_index);
+
+    unordered_flat_map<uint32_t, std::unique_ptr<Page>> pages;
+    mutable std::array<CachedPage, PAGE_CACHE_SIZE> cache;
+};
+
+} // namespace bb::avm2::simulation
@@ -0,0 +1,73 @@
+#include "barretenberg/vm2/simulation/lib/paged_memory.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace bb::avm2::simulation {
+namespace {
+
+TEST(AvmPagedMemoryTest, UnwrittenSlotsAreZero)
+{
+    PagedMemory memory;
+
+    EXPECT_EQ(memory.get(0), MemoryValue::from<FF>(0));
+    EXPECT_EQ(memory.get(UINT32_MAX), MemoryValue::from<FF>(0));
+    // Reads don't allocate.
+    EXPECT_EQ(memory.num_pages(), 0);
+
+    memory.set(1, MemoryValue::from<uint32_t>(7));
+    EXPECT_EQ(memory.get(0), MemoryValue::from<FF>(0));
+    EXPECT_EQ(memory.get(2), MemoryValue::from<FF>(0));
+}
+
+TEST(AvmPagedMemoryTest, SetAndGetAcrossPages)
+{
+    PagedMemory memory;
+    const std::vector<MemoryAddress> addresses = {
+        0, 1, PagedMemory::PAGE_SIZE - 1, PagedMemory::PAGE_SIZE, 10 * PagedMemory::PAGE_SIZE + 3, UINT32_MAX,
+    };
+
+    for (MemoryAddress address : addresses) {
+        memory.set(address, MemoryValue::from<uint64_t>(address));
+    }
+    for (MemoryAddress address : addresses) {
+        EXPECT_EQ(memory.get(address), MemoryValue::from<uint64_t>(address));
+    }
+    EXPECT_EQ(memory.num_pages(), 4);
+
+    // Overwrites change the tag too.
+    memory.set(PagedMemory::PAGE_SIZE, MemoryValue::from<FF>(42));
+    EXPECT_EQ(memory.get(PagedMemory::PAGE_SIZE), MemoryValue::from<FF>(42));
+}
+
+TEST(AvmPagedMemoryTest, PagesCollidingInCache)
+{
+    PagedMemory memory;
+    // These pages all map to the same cache entry.
+    const MemoryAddress stride = PagedMemory::PAGE_CACHE_SIZE * PagedMemory::PAGE_SIZE;
+
+    for (MemoryAddress i = 0; i < 8; i++) {
+        memory.set(i * stride, MemoryValue::from<uint32_t>(i));
+    }
+    for (MemoryAddress i = 0; i < 8; i++) {
+        EXPECT_EQ(memory.get(i * stride), MemoryValue::from<uint32_t>(i));
+    }
+}
+
+TEST(AvmPagedMemoryTest, ReferencesStayValid)
+{
+    PagedMemory memory;
+    memory.set(5, MemoryValue::from<uint8_t>(5));
+    const MemoryValue& value = memory.get(5);
+
+    // Allocating other pages doesn't move existing ones.
+    for (MemoryAddress i = 1; i < 100; i++) {
+        memory.set(i * PagedMemory::PAGE_SIZE, MemoryValue::from<uint8_t>(1));
+    }
+    EXPECT_EQ(&value, &memory.get(5));
+    EXPECT_EQ(value, MemoryValue::from<uint8_t>(5));
+}
+
+} // namespace
+} // namespace bb::avm2::simulation
@@ -0,0 +1,116 @@
+#include "barretenberg/vm2/simulation/memory.hpp"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/simulation/events/memory_event.hpp"
+#include "barretenberg/vm2/simulation/events/range_check_event.hpp"
+#include "barretenberg/vm2/simulation/lib/execution_id_manager.hpp"
+#include "barretenberg/vm2/simulation/range_check.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+
+namespace bb::avm2::simulation {
+namespace {
+
+// A three-operand instruction such as ADD or XOR, operands are optionally indirect.
+struct Instruction {
+    MemoryAddress a;
+    MemoryAddress b;
+    MemoryAddress dst;
+    bool indirect;
+};
+
+// Generates an opcode-heavy program: most operands are in a small window of low addresses (the "registers"), some
+// are pointers into a heap further up, like in code produced by the compiler.
+std::vector<Instruction> make_program(size_t num_instructions, MemoryAddress heap_size)
+{
+    constexpr MemoryAddress NUM_REGISTERS = 64;
+    constexpr MemoryAddress HEAP_START = 1 << 16;
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<MemoryAddress> register_dist(0, NUM_REGISTERS - 1);
+    std::uniform_int_distribution<MemoryAddress> heap_dist(HEAP_START, HEAP_START + heap_size - 1);
+    std::uniform_int_distribution<int> indirect_dist(0, 3);
+
+    std::vector<Instruction> program;
+    program.reserve(num_instructions);
+    for (size_t i = 0; i < num_instructions; i++) {
+        const bool indirect = indirect_dist(rng) == 0;
+        program.push_back({
+            .a = register_dist(rng),
+            .b = indirect ? heap_dist(rng) : register_dist(rng),
+            .dst = register_dist(rng),
+            .indirect = indirect,
+        });
+    }
+    return program;
+}
+
+void run_program(MemoryInterface& memory, const std::vector<Instruction>& program)
+{
+    for (const auto& instr : program) {
+        MemoryAddress b = instr.b;
+        if (instr.indirect) {
+            // Resolve the pointer, the heap slot is kept in a register next to it.
+            memory.set(instr.a, MemoryValue::from<uint32_t>(b));
+            b = memory.get(instr.a).as<uint32_t>();
+        }
+        const uint64_t a_value = memory.get(instr.a).get_tag() == MemoryTag::FF ? 1 : 2;
+        const uint64_t b_value = memory.get(b).get_tag() == MemoryTag::FF ? 3 : 4;
+        memory.set(instr.dst, MemoryValue::from<uint64_t>(a_value + b_value));
+    }
+}
+
+} // namespace
+
+static void BM_MemoryOpcodeHeavy(benchmark::State& state)
+{
+    const auto program = make_program(static_cast<size_t>(state.range(0)), static_cast<MemoryAddress>(state.range(1)));
+
+    // Memory events are dropped so that only the storage and tag checks are measured.
+    NoopEventEmitter<MemoryEvent> memory_events;
+    NoopEventEmitter<RangeCheckEvent> range_check_events;
+    RangeCheck range_check(range_check_events);
+    ExecutionIdManager execution_id_manager(0);
+
+    for (auto _ : state) {
+        Memory memory(/*space_id=*/1, range_check, execution_id_manager, memory_events);
+        run_program(memory, program);
+        benchmark::DoNotOptimize(memory);
+        benchmark::ClobberMemory();
+    }
+}
+
+static void BM_MemoryStoreOpcodeHeavy(benchmark::State& state)
+{
+    const auto program = make_program(static_cast<size_t>(state.range(0)), static_cast<MemoryAddress>(state.range(1)));
+
+    for (auto _ : state) {
+        MemoryStore memory;
+        run_program(memory, program);
+        benchmark::DoNotOptimize(memory);
+        benchmark::ClobberMemory();
+    }
+}
+
+// Arguments are the number of instructions and the size of the heap the indirect operands point into.
+BENCHMARK(BM_MemoryOpcodeHeavy)
+    ->Args({ 100000, 1 << 10 })
+    ->Args({ 100000, 1 << 16 })
+    ->Args({ 1000000, 1 << 16 })
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_MemoryStoreOpcodeHeavy)
+    ->Args({ 100000, 1 << 10 })
+    ->Args({ 100000, 1 << 16 })
+    ->Args({ 1000000, 1 << 16 })
+    ->Unit(benchmark::kMicrosecond);
+
+} // namespace bb::avm2::simulation
+
+BENCHMARK_MAIN();
@@ -14,8 +14,11 @@ void Memory::set(MemoryAddress index, MemoryValue value)
     // TODO: validate address?
     // TODO: reconsider tag validation.
     validate_tag(value);
-    memory[index] = value;
-    debug("Memory write: ", index, " <- ", value.to_string());
+    memory.set(index, value);
+    // Stringifying the value is more expensive than the write itself, so only do it when it will be logged.
+    if (debug_logging) {
+        debug("Memory write: ", index, " <- ", value.to_string());
+    }
     events.emit({ .execution_clk = execution_id_manager.get_execution_id(),
                   .mode = MemoryMode::WRITE,
                   .addr = index,
@@ -26,17 +29,16 @@ void Memory::set(MemoryAddress index, MemoryValue value)
 const MemoryValue& Memory::get(MemoryAddress index) const
 {
     // TODO: validate address?
-    static const auto default_value = MemoryValue::from<FF>(0);
-
-    auto it = memory.find(index);
-    const auto& vt = it != memory.end() ? it->second : default_value;
+    const auto& vt = memory.get(index);
     events.emit({ .execution_clk = execution_id_manager.get_execution_id(),
                   .mode = MemoryMode::READ,
                   .addr = index,
                   .value = vt,
                   .space_id = space_id });
 
-    debug("Memory read: ", index, " -> ", vt.to_string());
+    if (debug_logging) {
+        debug("Memory read: ", index, " -> ", vt.to_string());
+    }
     return vt;
 }
 
@@ -2,11 +2,11 @@
 
 #include <memory>
 
-#include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/common/memory_types.hpp"
 #include "barretenberg/vm2/simulation/events/event_emitter.hpp"
 #include "barretenberg/vm2/simulation/events/memory_event.hpp"
 #include "barretenberg/vm2/simulation/lib/execution_id_manager.hpp"
+#include "barretenberg/vm2/simulation/lib/paged_memory.hpp"
 #include "barretenberg/vm2/simulation/range_check.hpp"
 
 namespace bb::avm2::simulation {
@@ -45,7 +45,7 @@ class Memory : public MemoryInterface {
 
   private:
     uint32_t space_id;
-    unordered_flat_map<size_t, MemoryValue> memory;
+    PagedMemory memory;
 
     RangeCheckInterface& range_check;
     ExecutionIdGetterInterface& execution_id_manager;
@@ -82,25 +82,20 @@ class MemoryProvider : public MemoryProviderInterface {
     EventEmitterInterface<MemoryEvent>& events;
 };
 
-// Just a map that doesn't emit events or do anything else.
+// Just a memory that doesn't emit events or do anything else.
 class MemoryStore : public MemoryInterface {
   public:
     MemoryStore(uint32_t space_id = 0)
         : space_id(space_id)
     {}
 
-    const MemoryValue& get(MemoryAddress index) const override
-    {
-        static const auto default_value = MemoryValue::from<FF>(0);
-        auto it = memory.find(index);
-        return it != memory.end() ? it->second : default_value;
-    }
-    void set(MemoryAddress index, MemoryValue value) override { memory[index] = value; }
+    const MemoryValue& get(MemoryAddress index) const override { return memory.get(index); }
+    void set(MemoryAddress index, MemoryValue value) override { memory.set(index, value); }
     uint32_t get_space_id() const override { return space_id; }
 
   private:
     uint32_t space_id;
-    unordered_flat_map<size_t, MemoryValue> memory;
+    PagedMemory memory;
 };
 
 } // namespace bb::avm2::simulation
@@ -66,19 +66,22 @@ namespace {
 
 // Configuration for full simulation (for proving).
 struct ProvingSettings {
+    static constexpr bool collect_events = true;
     template <typename E> using DefaultEventEmitter = EventEmitter<E>;
     template <typename E> using DefaultDeduplicatingEventEmitter = DeduplicatingEventEmitter<E>;
 };
 
 // Configuration for fast simulation.
 struct FastSettings {
+    static constexpr bool collect_events = false;
     template <typename E> using DefaultEventEmitter = NoopEventEmitter<E>;
     template <typename E> using DefaultDeduplicatingEventEmitter = NoopEventEmitter<E>;
 };
 
 } // namespace
 
-template <typename S> EventsContainer AvmSimulationHelper::simulate_with_settings()
+template <typename S>
+EventsContainer AvmSimulationHelper::simulate_with_settings(const EventBatchHandlers& batch_handlers)
 {
     typename S::template DefaultEventEmitter<ExecutionEvent> execution_emitter;
     typename S::template DefaultDeduplicatingEventEmitter<AluEvent> alu_emitter;
@@ -121,6 +124,13 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
     typename S::template DefaultEventEmitter<L1ToL2MessageTreeCheckEvent> l1_to_l2_msg_tree_check_emitter;
     typename S::template DefaultEventEmitter<EmitUnencryptedLogEvent> emit_unencrypted_log_emitter;
 
+    if constexpr (S::collect_events) {
+        bitwise_emitter.set_batch_handler(batch_handlers.batch_size, batch_handlers.bitwise);
+        field_gt_emitter.set_batch_handler(batch_handlers.batch_size, batch_handlers.field_gt);
+        poseidon2_hash_emitter.set_batch_handler(batch_handlers.batch_size, batch_handlers.poseidon2_hash);
+        poseidon2_perm_emitter.set_batch_handler(batch_handlers.batch_size, batch_handlers.poseidon2_permutation);
+    }
+
     ExecutionIdManager execution_id_manager(1);
     RangeCheck range_check(range_check_emitter);
     FieldGreaterThan field_gt(range_check, field_gt_emitter);
@@ -227,6 +237,14 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
 
     tx_execution.simulate(hints.tx);
 
+    if constexpr (S::collect_events) {
+        // Hand over the last batches of the streamed events.
+        bitwise_emitter.flush();
+        field_gt_emitter.flush();
+        poseidon2_hash_emitter.flush();
+        poseidon2_perm_emitter.flush();
+    }
+
     return {
         tx_event_emitter.dump_events(),
         execution_emitter.dump_events(),
@@ -270,9 +288,9 @@ template <typename S> EventsContainer AvmSimulationHelper::simulate_with_setting
     };
 }
 
-EventsContainer AvmSimulationHelper::simulate()
+EventsContainer AvmSimulationHelper::simulate(const EventBatchHandlers& batch_handlers)
 {
-    return simulate_with_settings<ProvingSettings>();
+    return simulate_with_settings<ProvingSettings>(batch_handlers);
 }
 
 void AvmSimulationHelper::simulate_fast()
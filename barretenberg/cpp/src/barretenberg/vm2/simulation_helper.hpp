@@ -12,13 +12,15 @@ class AvmSimulationHelper {
     {}
 
     // Full simulation with event collection.
-    simulation::EventsContainer simulate();
+    // The events of subsystems with a batch handler are streamed to it, and are left out of the returned container.
+    simulation::EventsContainer simulate(const simulation::EventBatchHandlers& batch_handlers = {});
 
     // Fast simulation without event collection.
     void simulate_fast();
 
   private:
-    template <typename S> simulation::EventsContainer simulate_with_settings();
+    template <typename S>
+    simulation::EventsContainer simulate_with_settings(const simulation::EventBatchHandlers& batch_handlers = {});
 
     ExecutionHints hints;
 };
@@ -22,7 +22,6 @@ void BitwiseTraceBuilder::process(const simulation::EventEmitterInterface<simula
     // We activate last selector in the extra pre-pended row (to support shift)
     trace.set(C::bitwise_last, 0, 1);
 
-    uint32_t row = 1;
     for (const auto& event : events) {
         auto tag = event.a.get_tag();
 
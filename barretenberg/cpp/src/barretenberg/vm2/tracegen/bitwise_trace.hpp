@@ -12,10 +12,14 @@ namespace bb::avm2::tracegen {
 
 class BitwiseTraceBuilder final {
   public:
+    // Events can be processed in several batches, the rows of each batch follow those of the previous one.
     void process(const simulation::EventEmitterInterface<simulation::BitwiseEvent>::Container& events,
                  TraceContainer& trace);
 
     static const InteractionDefinition interactions;
+
+  private:
+    uint32_t row = 1;
 };
 
 } // namespace bb::avm2::tracegen
@@ -2,6 +2,7 @@
 #include <gtest/gtest.h>
 
 #include <cstdint>
+#include <vector>
 
 #include "barretenberg/vm2/common/memory_types.hpp"
 #include "barretenberg/vm2/testing/macros.hpp"
@@ -312,5 +313,39 @@ TEST(BitwiseTraceGenTest, ErrorFFAndTagMismatch)
                       (FF(static_cast<uint8_t>(ValueTag::FF)) - FF(static_cast<uint8_t>(ValueTag::U16))).invert()))));
 }
 
+TEST(BitwiseTraceGenTest, ProcessInBatches)
+{
+    std::vector<simulation::BitwiseEvent> events = {
+        {
+            .operation = BitwiseOperation::AND,
+            .a = MemoryValue::from<uint32_t>(0x52488425),
+            .b = MemoryValue::from<uint32_t>(0xC684486C),
+            .res = 0x42000024,
+        },
+        {
+            .operation = BitwiseOperation::XOR,
+            .a = MemoryValue::from<uint16_t>(0x5248),
+            .b = MemoryValue::from<uint16_t>(0xC684),
+            .res = 0x94CC,
+        },
+    };
+
+    TestTraceContainer expected_trace;
+    BitwiseTraceBuilder().process(events, expected_trace);
+
+    // Rows of the second batch follow those of the first one.
+    TestTraceContainer trace;
+    BitwiseTraceBuilder builder;
+    builder.process({ events[0] }, trace);
+    builder.process({ events[1] }, trace);
+
+    ASSERT_EQ(trace.get_num_rows(), expected_trace.get_num_rows());
+    for (size_t col = 0; col < TraceContainer::num_columns(); ++col) {
+        expected_trace.visit_column(static_cast<Column>(col), [&](uint32_t row, const FF& value) {
+            EXPECT_EQ(trace.get(static_cast<Column>(col), row), value);
+        });
+    }
+}
+
 } // namespace
 } // namespace bb::avm2::tracegen
@@ -18,7 +18,6 @@ void FieldGreaterThanTraceBuilder::process(
 {
     using C = Column;
 
-    uint32_t row = 1;
     for (const auto& event : events) {
         // Copy the things that will need range checks since we'll mutate them in the shifts
         U256Decomposition a_limbs = event.a_limbs;
@@ -291,7 +291,6 @@ void Poseidon2TraceBuilder::process_hash(
     TraceContainer& trace)
 {
     using C = Column;
-    uint32_t row = 1; // We start from row 1 because this trace contains shifted columns.
     for (const auto& event : hash_events) {
         auto input_size = event.inputs.size();
         auto num_perm_events = (input_size / 3) + static_cast<size_t>(input_size % 3 != 0);
@@ -309,7 +308,7 @@ void Poseidon2TraceBuilder::process_hash(
                 // Mix the input chunk into the previous permutation output state
                 perm_state[j] += perm_input[j];
             }
-            trace.set(row,
+            trace.set(hash_row,
                       { {
                           { C::poseidon2_hash_sel, 1 },
                           { C::poseidon2_hash_start, i == 0 },
@@ -336,7 +335,7 @@ void Poseidon2TraceBuilder::process_hash(
                           { C::poseidon2_hash_output, event.output },
                       } });
             input_size -= chunk_size;
-            row++;
+            hash_row++;
         }
     }
 }
@@ -351,8 +350,6 @@ void Poseidon2TraceBuilder::process_permutation(
     // These are where we will store the intermediate values of current_state in the trace.
     std::array<Column, 4> round_state_cols;
 
-    uint32_t row = 0;
-
     for (const auto& event : perm_events) {
         // The bulk of this code is a copy of the Poseidon2Permutation::permute function from bb
         // Note that the functions mutate current_state in place.
@@ -360,7 +357,7 @@ void Poseidon2TraceBuilder::process_permutation(
 
         // Apply 1st linear layer
         Poseidon2Perm::matrix_multiplication_external(current_state);
-        trace.set(row,
+        trace.set(permutation_row,
                   { {
                       { C::poseidon2_perm_sel, 1 },
                       { C::poseidon2_perm_a_0, event.input[0] },
@@ -384,7 +381,7 @@ void Poseidon2TraceBuilder::process_permutation(
             Poseidon2Perm::matrix_multiplication_external(current_state);
             // Store end of round state
             round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
+            trace.set(permutation_row,
                       { { { round_state_cols[0], current_state[0] },
                           { round_state_cols[1], current_state[1] },
                           { round_state_cols[2], current_state[2] },
@@ -399,7 +396,7 @@ void Poseidon2TraceBuilder::process_permutation(
             Poseidon2Perm::matrix_multiplication_internal(current_state);
             // Store end of round state
             round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
+            trace.set(permutation_row,
                       { { { round_state_cols[0], current_state[0] },
                           { round_state_cols[1], current_state[1] },
                           { round_state_cols[2], current_state[2] },
@@ -412,14 +409,14 @@ void Poseidon2TraceBuilder::process_permutation(
             Poseidon2Perm::apply_sbox(current_state);
             Poseidon2Perm::matrix_multiplication_external(current_state);
             round_state_cols = intermediate_round_cols[i];
-            trace.set(row,
+            trace.set(permutation_row,
                       { { { round_state_cols[0], current_state[0] },
                           { round_state_cols[1], current_state[1] },
                           { round_state_cols[2], current_state[2] },
                           { round_state_cols[3], current_state[3] } } });
         }
         // Set the output
-        trace.set(row,
+        trace.set(permutation_row,
                   { {
                       { C::poseidon2_perm_b_0, current_state[0] },
                       { C::poseidon2_perm_b_1, current_state[1] },
@@ -427,7 +424,7 @@ void Poseidon2TraceBuilder::process_permutation(
                       { C::poseidon2_perm_b_3, current_state[3] },
 
                   } });
-        row++;
+        permutation_row++;
     }
 }
 
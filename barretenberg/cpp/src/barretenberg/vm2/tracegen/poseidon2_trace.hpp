@@ -12,6 +12,8 @@ namespace bb::avm2::tracegen {
 
 class Poseidon2TraceBuilder final {
   public:
+    // Hash and permutation events can be processed in several batches, the rows of each batch follow those of the
+    // previous one.
     void process_hash(const simulation::EventEmitterInterface<simulation::Poseidon2HashEvent>::Container& hash_events,
                       TraceContainer& trace);
     void process_permutation(
@@ -23,6 +25,10 @@ class Poseidon2TraceBuilder final {
                                          TraceContainer& trace);
 
     static const InteractionDefinition interactions;
+
+  private:
+    uint32_t hash_row = 1; // We start from row 1 because this trace contains shifted columns.
+    uint32_t permutation_row = 0;
 };
 
 } // namespace bb::avm2::tracegen
@@ -1,5 +1,7 @@
 #include "barretenberg/vm2/tracegen/public_data_tree_trace.hpp"
 
+#include <unordered_map>
+
 #include "barretenberg/vm2/common/aztec_constants.hpp"
 #include "barretenberg/vm2/generated/relations/lookups_public_data_check.hpp"
 #include "barretenberg/vm2/generated/relations/perms_public_data_check.hpp"
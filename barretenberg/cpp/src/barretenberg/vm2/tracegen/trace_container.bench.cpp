@@ -0,0 +1,85 @@
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+#include <benchmark/benchmark.h>
+#include <sys/resource.h>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/field.hpp"
+
+using namespace benchmark;
+using namespace bb::avm2;
+
+namespace bb::avm2::tracegen {
+namespace {
+
+// Roughly the number of columns a subtrace fills.
+constexpr size_t NUM_BENCH_COLUMNS = 200;
+
+void fill_columns(TraceContainer& trace, size_t num_rows)
+{
+    bb::parallel_for(num_rows, [&](size_t row) {
+        for (size_t col = 0; col < NUM_BENCH_COLUMNS; ++col) {
+            trace.set(static_cast<Column>(col), static_cast<uint32_t>(row), row + col + 1);
+        }
+    });
+}
+
+void set_peak_rss_counter(benchmark::State& state)
+{
+    struct rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    // ru_maxrss is in kilobytes on Linux.
+    state.counters["peak_rss_mb"] = static_cast<double>(usage.ru_maxrss) / 1024;
+}
+
+} // namespace
+
+static void BM_TraceContainerSet(benchmark::State& state)
+{
+    const size_t num_rows = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        TraceContainer trace;
+        fill_columns(trace, num_rows);
+        benchmark::DoNotOptimize(trace);
+    }
+    set_peak_rss_counter(state);
+}
+
+static void BM_TraceContainerGetMultiple(benchmark::State& state)
+{
+    const size_t num_rows = static_cast<size_t>(state.range(0));
+    TraceContainer trace;
+    fill_columns(trace, num_rows);
+    const std::array<ColumnAndShifts, 4> cols = { static_cast<ColumnAndShifts>(0),
+                                                  static_cast<ColumnAndShifts>(1),
+                                                  static_cast<ColumnAndShifts>(2),
+                                                  static_cast<ColumnAndShifts>(3) };
+
+    for (auto _ : state) {
+        for (uint32_t row = 0; row < num_rows; ++row) {
+            benchmark::DoNotOptimize(trace.get_multiple(cols, row));
+        }
+    }
+}
+
+static void BM_TraceContainerVisitColumn(benchmark::State& state)
+{
+    const size_t num_rows = static_cast<size_t>(state.range(0));
+    TraceContainer trace;
+    fill_columns(trace, num_rows);
+
+    for (auto _ : state) {
+        FF sum = 0;
+        trace.visit_column(static_cast<Column>(0), [&](uint32_t, const FF& value) { sum += value; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(BM_TraceContainerSet)->Arg(1 << 12)->Arg(1 << 16)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TraceContainerGetMultiple)->Arg(1 << 16)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TraceContainerVisitColumn)->Arg(1 << 16)->Unit(benchmark::kMicrosecond);
+
+} // namespace bb::avm2::tracegen
+
+BENCHMARK_MAIN();
@@ -1,5 +1,8 @@
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
 
+#include <bit>
+
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/log.hpp"
 #include "barretenberg/vm2/common/field.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
@@ -13,16 +16,65 @@ constexpr auto clk_column = Column::precomputed_clk;
 
 } // namespace
 
+void TraceContainer::DenseColumn::clear()
+{
+    auto* chunk_table = chunks.exchange(nullptr, std::memory_order_acq_rel);
+    if (chunk_table != nullptr) {
+        for (size_t i = 0; i < NUM_CHUNKS; ++i) {
+            delete chunk_table[i].load(std::memory_order_relaxed);
+        }
+        delete[] chunk_table;
+    }
+    max_row_number = -1;
+    row_number_dirty = false;
+}
+
+TraceContainer::Chunk* TraceContainer::DenseColumn::get_chunk(uint32_t row) const
+{
+    if (row >= MAX_AVM_TRACE_SIZE) {
+        return nullptr;
+    }
+    const auto* chunk_table = chunks.load(std::memory_order_acquire);
+    return chunk_table == nullptr ? nullptr : chunk_table[row >> CHUNK_LOG_SIZE].load(std::memory_order_acquire);
+}
+
+TraceContainer::Chunk& TraceContainer::DenseColumn::get_or_create_chunk(uint32_t row)
+{
+    BB_ASSERT_LT(row, MAX_AVM_TRACE_SIZE, "Row is out of the trace bounds");
+
+    auto* chunk_table = chunks.load(std::memory_order_acquire);
+    if (chunk_table == nullptr) {
+        // Value-initialized, so every chunk starts as nullptr.
+        auto* new_table = new std::atomic<Chunk*>[NUM_CHUNKS]();
+        if (chunks.compare_exchange_strong(chunk_table, new_table, std::memory_order_acq_rel)) {
+            chunk_table = new_table;
+        } else {
+            // Another writer got there first, chunk_table now holds its table.
+            delete[] new_table;
+        }
+    }
+
+    auto& slot = chunk_table[row >> CHUNK_LOG_SIZE];
+    Chunk* chunk = slot.load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+        auto* new_chunk = new Chunk();
+        if (slot.compare_exchange_strong(chunk, new_chunk, std::memory_order_acq_rel)) {
+            chunk = new_chunk;
+        } else {
+            delete new_chunk;
+        }
+    }
+    return *chunk;
+}
+
 TraceContainer::TraceContainer()
-    : trace(std::make_unique<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
+    : trace(std::make_unique<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>>())
 {}
 
 const FF& TraceContainer::get(Column col, uint32_t row) const
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::shared_lock lock(column_data.mutex);
-    const auto it = column_data.rows.find(row);
-    return it == column_data.rows.end() ? zero : it->second;
+    const auto* chunk = (*trace)[static_cast<size_t>(col)].get_chunk(row);
+    return chunk == nullptr ? zero : chunk->values[row & (CHUNK_SIZE - 1)];
 }
 
 const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row) const
@@ -36,13 +88,26 @@ const FF& TraceContainer::get_column_or_shift(ColumnAndShifts col, uint32_t row)
 void TraceContainer::set(Column col, uint32_t row, const FF& value)
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
+    const size_t offset = row & (CHUNK_SIZE - 1);
+    const uint64_t bit = 1UL << (offset % 64);
+
     if (!value.is_zero()) {
-        column_data.rows.insert_or_assign(row, value);
-        column_data.max_row_number = std::max(column_data.max_row_number, static_cast<int64_t>(row));
+        auto& chunk = column_data.get_or_create_chunk(row);
+        chunk.values[offset] = value;
+        chunk.non_zero[offset / 64].fetch_or(bit, std::memory_order_relaxed);
+        int64_t max_row = column_data.max_row_number.load(std::memory_order_relaxed);
+        while (max_row < static_cast<int64_t>(row) &&
+               !column_data.max_row_number.compare_exchange_weak(max_row, row, std::memory_order_relaxed)) {
+        }
     } else {
-        auto num_erased = column_data.rows.erase(row);
-        if (column_data.max_row_number == row && num_erased > 0) {
+        // Zero is the default value, so we don't need to allocate a chunk for it.
+        auto* chunk = column_data.get_chunk(row);
+        if (chunk == nullptr) {
+            return;
+        }
+        chunk->values[offset] = zero;
+        const uint64_t previous = chunk->non_zero[offset / 64].fetch_and(~bit, std::memory_order_relaxed);
+        if ((previous & bit) != 0 && column_data.max_row_number.load(std::memory_order_relaxed) == row) {
             // This shouldn't happen often. We delay recalculation of the max row number
             // until someone actually needs it.
             column_data.row_number_dirty = true;
@@ -59,22 +124,37 @@ void TraceContainer::set(uint32_t row, std::span<const std::pair<Column, FF>> va
 
 void TraceContainer::reserve_column(Column col, size_t size)
 {
+    // Precomputed columns are filled from the first row, so we allocate their chunks upfront rather than as rows
+    // are set.
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    column_data.rows.reserve(size);
+    const size_t num_rows = std::min(size, MAX_AVM_TRACE_SIZE);
+    for (size_t row = 0; row < num_rows; row += CHUNK_SIZE) {
+        column_data.get_or_create_chunk(static_cast<uint32_t>(row));
+    }
 }
 
 uint32_t TraceContainer::get_column_rows(Column col) const
 {
     auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    if (column_data.row_number_dirty) {
-        // Trigger recalculation of max row number.
-        auto keys = std::views::keys(column_data.rows);
-        const auto it = std::max_element(keys.begin(), keys.end());
-        // We use -1 to indicate that the column is empty.
-        column_data.max_row_number = it == keys.end() ? -1 : static_cast<int64_t>(*it);
-        column_data.row_number_dirty = false;
+    if (column_data.row_number_dirty.exchange(false)) {
+        // Trigger recalculation of max row number, looking for the last non-zero row.
+        int64_t max_row_number = -1;
+        const auto* chunk_table = column_data.chunks.load(std::memory_order_acquire);
+        for (size_t i = NUM_CHUNKS; chunk_table != nullptr && max_row_number < 0 && i-- > 0;) {
+            const auto* chunk = chunk_table[i].load(std::memory_order_acquire);
+            if (chunk == nullptr) {
+                continue;
+            }
+            for (size_t word = chunk->non_zero.size(); word-- > 0;) {
+                const uint64_t bits = chunk->non_zero[word].load(std::memory_order_relaxed);
+                if (bits != 0) {
+                    max_row_number = static_cast<int64_t>((i << CHUNK_LOG_SIZE) + (word * 64) + 63 -
+                                                          static_cast<size_t>(std::countl_zero(bits)));
+                    break;
+                }
+            }
+        }
+        column_data.max_row_number = max_row_number;
     }
     return static_cast<uint32_t>(column_data.max_row_number + 1);
 }
@@ -97,20 +177,44 @@ uint32_t TraceContainer::get_num_rows() const
 
 void TraceContainer::visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::shared_lock lock(column_data.mutex);
-    for (const auto& [row, value] : column_data.rows) {
-        visitor(row, value);
+    const auto* chunk_table = (*trace)[static_cast<size_t>(col)].chunks.load(std::memory_order_acquire);
+    if (chunk_table == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < NUM_CHUNKS; ++i) {
+        const auto* chunk = chunk_table[i].load(std::memory_order_acquire);
+        if (chunk == nullptr) {
+            continue;
+        }
+        for (size_t word = 0; word < chunk->non_zero.size(); ++word) {
+            uint64_t bits = chunk->non_zero[word].load(std::memory_order_relaxed);
+            while (bits != 0) {
+                const size_t offset = (word * 64) + static_cast<size_t>(std::countr_zero(bits));
+                visitor(static_cast<uint32_t>((i << CHUNK_LOG_SIZE) + offset), chunk->values[offset]);
+                bits &= bits - 1;
+            }
+        }
+    }
+}
+
+void TraceContainer::visit_column_chunks(Column col,
+                                         const std::function<void(uint32_t, std::span<const FF>)>& visitor) const
+{
+    const auto* chunk_table = (*trace)[static_cast<size_t>(col)].chunks.load(std::memory_order_acquire);
+    if (chunk_table == nullptr) {
+        return;
+    }
+    for (size_t i = 0; i < NUM_CHUNKS; ++i) {
+        const auto* chunk = chunk_table[i].load(std::memory_order_acquire);
+        if (chunk != nullptr) {
+            visitor(static_cast<uint32_t>(i << CHUNK_LOG_SIZE), chunk->values);
+        }
     }
 }
 
 void TraceContainer::clear_column(Column col)
 {
-    auto& column_data = (*trace)[static_cast<size_t>(col)];
-    std::unique_lock lock(column_data.mutex);
-    column_data.rows.clear();
-    column_data.max_row_number = 0;
-    column_data.row_number_dirty = false;
+    (*trace)[static_cast<size_t>(col)].clear();
 }
 
 } // namespace bb::avm2::tracegen
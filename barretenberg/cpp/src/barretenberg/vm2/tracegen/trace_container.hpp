@@ -2,25 +2,28 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <functional>
 #include <memory>
-#include <shared_mutex>
 #include <span>
-#include <unordered_map>
 
+#include "barretenberg/vm2/common/constants.hpp"
 #include "barretenberg/vm2/common/field.hpp"
-#include "barretenberg/vm2/common/map.hpp"
 #include "barretenberg/vm2/constraining/flavor_settings.hpp"
 #include "barretenberg/vm2/generated/columns.hpp"
 #include "barretenberg/vm2/tracegen/lib/trace_conversion.hpp"
 
 namespace bb::avm2::tracegen {
 
-// This container is thread-safe.
-// Contention can only happen when concurrently accessing the same column.
+// This container is thread-safe as long as concurrent writes target different rows.
+// Writes never take a lock: any number of threads can fill disjoint row ranges of the same column.
 class TraceContainer {
   public:
+    // Columns are stored densely, in chunks of this many rows.
+    static constexpr size_t CHUNK_LOG_SIZE = 10;
+    static constexpr size_t CHUNK_SIZE = 1 << CHUNK_LOG_SIZE;
+
     TraceContainer();
 
     const FF& get(Column col, uint32_t row) const;
@@ -46,8 +49,11 @@ class TraceContainer {
     // Reserve column size. Useful for precomputed columns.
     void reserve_column(Column col, size_t size);
 
-    // Visits non-zero values in a column.
+    // Visits non-zero values in a column, in row order.
     void visit_column(Column col, const std::function<void(uint32_t, const FF&)>& visitor) const;
+    // Visits the allocated chunks of a column, in row order. Each chunk is given with the row of its first value,
+    // rows that were never set hold zero.
+    void visit_column_chunks(Column col, const std::function<void(uint32_t, std::span<const FF>)>& visitor) const;
     // Returns the number of rows in a column. That is, the maximum non-zero row index + 1.
     uint32_t get_column_rows(Column col) const;
     // Maximum number of rows in any column.
@@ -57,26 +63,35 @@ class TraceContainer {
     // Number of columns (without shifts).
     static constexpr size_t num_columns() { return NUM_COLUMNS_WITHOUT_SHIFTS; }
 
-    // Free column memory.
+    // Free column memory. Must not be called concurrently with other accesses to the column.
     void clear_column(Column col);
 
   private:
-    // We use a mutex per column to allow for concurrent writes.
-    // Observe that therefore concurrent write access to different columns is cheap.
-    struct SparseColumn {
-        std::shared_mutex mutex;
-        int64_t max_row_number = -1; // We use -1 to indicate that the column is empty.
-        bool row_number_dirty;       // Needs recalculation.
-        // Future memory optimization notes: we can do the same trick as in Operand.
-        // That is, store a variant with a unique_ptr. However, we should benchmark this.
-        // (see serialization.hpp).
-        unordered_flat_map<uint32_t, FF> rows;
+    static constexpr size_t NUM_CHUNKS = MAX_AVM_TRACE_SIZE / CHUNK_SIZE;
+
+    struct Chunk {
+        std::array<FF, CHUNK_SIZE> values;
+        // One bit per row, set if the row holds a non-zero value.
+        std::array<std::atomic<uint64_t>, CHUNK_SIZE / 64> non_zero{};
+
+        Chunk() { values.fill(FF::zero()); }
+    };
+
+    // Both the chunk table and the chunks are allocated on first write and published with a CAS, so that
+    // writers racing to allocate the same chunk agree on a single one.
+    struct DenseColumn {
+        std::atomic<std::atomic<Chunk*>*> chunks = nullptr;
+        std::atomic<int64_t> max_row_number = -1; // We use -1 to indicate that the column is empty.
+        std::atomic<bool> row_number_dirty = false; // Needs recalculation.
+
+        ~DenseColumn() { clear(); }
+        void clear();
+        Chunk* get_chunk(uint32_t row) const;
+        Chunk& get_or_create_chunk(uint32_t row);
     };
-    // We store the trace as a sparse matrix.
     // We use a unique_ptr to allocate the array in the heap vs the stack.
-    // Even if the _content_ of each unordered_map is always heap-allocated, if we have 3k columns
-    // we could unnecessarily put strain on the stack with sizeof(unordered_map) * 3k bytes.
-    std::unique_ptr<std::array<SparseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
+    // Columns only cost a few words until they are written to.
+    std::unique_ptr<std::array<DenseColumn, NUM_COLUMNS_WITHOUT_SHIFTS>> trace;
 };
 
 } // namespace bb::avm2::tracegen
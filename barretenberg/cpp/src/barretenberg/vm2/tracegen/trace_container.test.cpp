@@ -0,0 +1,99 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/vm2/common/constants.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2::tracegen {
+namespace {
+
+using testing::ElementsAre;
+using testing::Pair;
+
+using C = Column;
+
+TEST(TraceContainerTest, GetAndSet)
+{
+    TraceContainer trace;
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+
+    trace.set(C::execution_sel, 3, 1);
+    trace.set(C::execution_sel, 5000, 7);
+
+    EXPECT_EQ(trace.get(C::execution_sel, 3), 1);
+    EXPECT_EQ(trace.get(C::execution_sel, 5000), 7);
+    EXPECT_EQ(trace.get(C::execution_sel, 4999), 0);
+    EXPECT_EQ(trace.get(C::execution_sel, static_cast<uint32_t>(MAX_AVM_TRACE_SIZE)), 0);
+    EXPECT_EQ(trace.get(C::execution_context_id, 3), 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 5001);
+}
+
+TEST(TraceContainerTest, SettingZeroShrinksColumn)
+{
+    TraceContainer trace;
+    trace.set(C::execution_sel, 3, 1);
+    trace.set(C::execution_sel, 5000, 7);
+
+    trace.set(C::execution_sel, 5000, 0);
+    EXPECT_EQ(trace.get(C::execution_sel, 5000), 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 4);
+
+    trace.set(C::execution_sel, 3, 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+}
+
+TEST(TraceContainerTest, VisitsNonZeroValuesInRowOrder)
+{
+    TraceContainer trace;
+    trace.set(C::execution_sel, 5000, 7);
+    trace.set(C::execution_sel, 3, 1);
+    trace.set(C::execution_sel, 64, 2);
+    trace.set(C::execution_sel, 64, 0);
+    trace.set(C::execution_sel, 65, 3);
+
+    std::vector<std::pair<uint32_t, FF>> values;
+    trace.visit_column(C::execution_sel, [&](uint32_t row, const FF& value) { values.emplace_back(row, value); });
+    EXPECT_THAT(values, ElementsAre(Pair(3, 1), Pair(65, 3), Pair(5000, 7)));
+
+    std::vector<uint32_t> chunk_rows;
+    trace.visit_column_chunks(C::execution_sel, [&](uint32_t first_row, std::span<const FF> chunk) {
+        // Chunks hold every row in their range, including the zero ones.
+        EXPECT_EQ(chunk.size(), TraceContainer::CHUNK_SIZE);
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            EXPECT_EQ(chunk[i], trace.get(C::execution_sel, first_row + static_cast<uint32_t>(i)));
+        }
+        chunk_rows.push_back(first_row);
+    });
+    EXPECT_THAT(chunk_rows, ElementsAre(0, (5000 / TraceContainer::CHUNK_SIZE) * TraceContainer::CHUNK_SIZE));
+
+    trace.clear_column(C::execution_sel);
+    EXPECT_EQ(trace.get(C::execution_sel, 3), 0);
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), 0);
+}
+
+TEST(TraceContainerTest, ConcurrentWritesToDisjointRows)
+{
+    TraceContainer trace;
+    constexpr uint32_t num_rows = 1 << 14;
+
+    bb::parallel_for(num_rows, [&](size_t row) {
+        trace.set(C::execution_sel, static_cast<uint32_t>(row), 1);
+        trace.set(C::execution_context_id, static_cast<uint32_t>(row), row + 1);
+    });
+
+    EXPECT_EQ(trace.get_column_rows(C::execution_sel), num_rows);
+    EXPECT_EQ(trace.get_column_rows(C::execution_context_id), num_rows);
+    uint32_t num_values = 0;
+    trace.visit_column(C::execution_context_id, [&](uint32_t row, const FF& value) {
+        EXPECT_EQ(value, row + 1);
+        num_values++;
+    });
+    EXPECT_EQ(num_values, num_rows);
+}
+
+} // namespace
+} // namespace bb::avm2::tracegen
@@ -1,11 +1,18 @@
 #include "barretenberg/vm2/tracegen_helper.hpp"
 
 #include <array>
+#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <mutex>
+#include <queue>
 #include <span>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
 #include "barretenberg/common/std_array.hpp"
 #include "barretenberg/common/thread.hpp"
@@ -116,6 +123,92 @@ void execute_jobs(std::span<std::function<void()>> jobs)
     parallel_for(jobs.size(), [&](size_t i) { jobs[i](); });
 }
 
+// Runs tasks one at a time, in the order they were submitted, on a dedicated thread.
+// At most MAX_PENDING tasks are queued, submitting more blocks until the worker catches up.
+class OrderedWorker {
+  public:
+    static constexpr size_t MAX_PENDING = 4;
+
+    OrderedWorker()
+        : thread([this]() { run(); })
+    {}
+    OrderedWorker(const OrderedWorker&) = delete;
+    OrderedWorker& operator=(const OrderedWorker&) = delete;
+    // If finish() wasn't called, e.g. because the simulation threw, the pending tasks are dropped.
+    ~OrderedWorker()
+    {
+        {
+            std::unique_lock lock(mutex);
+            tasks = {};
+        }
+        join();
+    }
+
+    void submit(std::function<void()> task)
+    {
+        std::unique_lock lock(mutex);
+        not_full.wait(lock, [&]() { return tasks.size() < MAX_PENDING; });
+        tasks.push(std::move(task));
+        not_empty.notify_one();
+    }
+
+    // Waits for all submitted tasks and rethrows the first error thrown by any of them.
+    void finish()
+    {
+        join();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+  private:
+    void run()
+    {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock lock(mutex);
+                not_empty.wait(lock, [&]() { return done || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop();
+                not_full.notify_one();
+            }
+            // Once a task has failed, the trace is incomplete and the remaining tasks are dropped.
+            if (!error) {
+                try {
+                    task();
+                } catch (...) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    void join()
+    {
+        {
+            std::unique_lock lock(mutex);
+            done = true;
+        }
+        not_empty.notify_one();
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+
+    std::mutex mutex;
+    std::condition_variable not_empty;
+    std::condition_variable not_full;
+    std::queue<std::function<void()>> tasks;
+    bool done = false;
+    std::exception_ptr error;
+    // Declared last, so that the rest of the state is initialized before the thread starts.
+    std::thread thread;
+};
+
 template <typename T> inline void clear_events(T& c)
 {
     c.clear();
@@ -179,23 +272,113 @@ void check_interactions([[maybe_unused]] const TraceContainer& trace)
 
 } // namespace
 
+// Fills the columns of the streamed subsystems as batches of events come in from the simulation. Each subsystem has
+// its own builder and worker, so its batches are processed in order and its rows follow on from the previous batch.
+// A batch is freed as soon as it has been processed.
+class AvmTraceGenHelper::StreamingTraceGen {
+  public:
+    StreamingTraceGen(TraceContainer& trace)
+        : trace(trace)
+    {}
+
+    EventBatchHandlers get_handlers(size_t batch_size)
+    {
+        return {
+            .batch_size = batch_size,
+            .bitwise =
+                [this](EventEmitterInterface<BitwiseEvent>::Container&& events) {
+                    bitwise_worker.submit([this, events = std::move(events)]() {
+                        AVM_TRACK_TIME("tracegen/bitwise", bitwise_builder.process(events, trace));
+                    });
+                },
+            .field_gt =
+                [this](EventEmitterInterface<FieldGreaterThanEvent>::Container&& events) {
+                    field_gt_worker.submit([this, events = std::move(events)]() {
+                        AVM_TRACK_TIME("tracegen/field_gt", field_gt_builder.process(events, trace));
+                    });
+                },
+            .poseidon2_hash =
+                [this](EventEmitterInterface<Poseidon2HashEvent>::Container&& events) {
+                    poseidon2_hash_worker.submit([this, events = std::move(events)]() {
+                        AVM_TRACK_TIME("tracegen/poseidon2_hash", poseidon2_hash_builder.process_hash(events, trace));
+                    });
+                },
+            .poseidon2_permutation =
+                [this](EventEmitterInterface<Poseidon2PermutationEvent>::Container&& events) {
+                    poseidon2_permutation_worker.submit([this, events = std::move(events)]() {
+                        AVM_TRACK_TIME("tracegen/poseidon2_permutation",
+                                       poseidon2_permutation_builder.process_permutation(events, trace));
+                    });
+                },
+        };
+    }
+
+    void finish()
+    {
+        bitwise_worker.finish();
+        field_gt_worker.finish();
+        poseidon2_hash_worker.finish();
+        poseidon2_permutation_worker.finish();
+    }
+
+  private:
+    TraceContainer& trace;
+    BitwiseTraceBuilder bitwise_builder;
+    FieldGreaterThanTraceBuilder field_gt_builder;
+    Poseidon2TraceBuilder poseidon2_hash_builder;
+    Poseidon2TraceBuilder poseidon2_permutation_builder;
+    OrderedWorker bitwise_worker;
+    OrderedWorker field_gt_worker;
+    OrderedWorker poseidon2_hash_worker;
+    OrderedWorker poseidon2_permutation_worker;
+};
+
+AvmTraceGenHelper::AvmTraceGenHelper() = default;
+AvmTraceGenHelper::~AvmTraceGenHelper() = default;
+
 TraceContainer AvmTraceGenHelper::generate_trace(EventsContainer&& events, const PublicInputs& public_inputs)
 {
     TraceContainer trace;
+    generate_trace(trace, std::move(events), public_inputs);
+    return trace;
+}
 
+void AvmTraceGenHelper::generate_trace(TraceContainer& trace,
+                                       EventsContainer&& events,
+                                       const PublicInputs& public_inputs)
+{
     fill_trace_columns(trace, std::move(events), public_inputs);
     fill_trace_interactions(trace);
 
     check_interactions(trace);
     print_trace_stats(trace);
+}
 
-    return trace;
+EventBatchHandlers AvmTraceGenHelper::start_streaming(TraceContainer& trace, size_t batch_size)
+{
+    streaming = std::make_unique<StreamingTraceGen>(trace);
+    streamed = true;
+    return streaming->get_handlers(batch_size);
+}
+
+void AvmTraceGenHelper::finish_streaming()
+{
+    // Release the workers even if processing failed.
+    auto finished = std::move(streaming);
+    finished->finish();
 }
 
 void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                                            EventsContainer&& events,
                                            const PublicInputs& public_inputs)
 {
+    const bool events_streamed = std::exchange(streamed, false);
+    // Streamed events are handed to the streaming workers rather than collected.
+    BB_ASSERT_EQ(!events_streamed || (events.bitwise.empty() && events.field_gt.empty() &&
+                                      events.poseidon2_hash.empty() && events.poseidon2_permutation.empty()),
+                 true,
+                 "Streamed events were also collected");
+
     // We process the events in parallel. Ideally the jobs should access disjoint column sets.
     {
         auto jobs = concatenate(
@@ -286,18 +469,6 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                                    ecc_builder.process_add_with_memory(events.ecc_add_mem, trace));
                     clear_events(events.ecc_add_mem);
                 },
-                [&]() {
-                    Poseidon2TraceBuilder poseidon2_builder;
-                    AVM_TRACK_TIME("tracegen/poseidon2_hash",
-                                   poseidon2_builder.process_hash(events.poseidon2_hash, trace));
-                    clear_events(events.poseidon2_hash);
-                },
-                [&]() {
-                    Poseidon2TraceBuilder poseidon2_builder;
-                    AVM_TRACK_TIME("tracegen/poseidon2_permutation",
-                                   poseidon2_builder.process_permutation(events.poseidon2_permutation, trace));
-                    clear_events(events.poseidon2_permutation);
-                },
                 [&]() {
                     Poseidon2TraceBuilder poseidon2_builder;
                     AVM_TRACK_TIME(
@@ -316,11 +487,6 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                                    to_radix_builder.process_with_memory(events.to_radix_memory, trace));
                     clear_events(events.to_radix_memory);
                 },
-                [&]() {
-                    FieldGreaterThanTraceBuilder field_gt_builder;
-                    AVM_TRACK_TIME("tracegen/field_gt", field_gt_builder.process(events.field_gt, trace));
-                    clear_events(events.field_gt);
-                },
                 [&]() {
                     MerkleCheckTraceBuilder merkle_check_builder;
                     AVM_TRACK_TIME("tracegen/merkle_check", merkle_check_builder.process(events.merkle_check, trace));
@@ -361,11 +527,6 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                                    data_copy_trace_builder.process(events.data_copy_events, trace));
                     clear_events(events.data_copy_events);
                 },
-                [&]() {
-                    BitwiseTraceBuilder bitwise_builder;
-                    AVM_TRACK_TIME("tracegen/bitwise", bitwise_builder.process(events.bitwise, trace));
-                    clear_events(events.bitwise);
-                },
                 [&]() {
                     CalldataTraceBuilder calldata_builder;
                     AVM_TRACK_TIME("tracegen/calldata_hashing",
@@ -432,6 +593,34 @@ void AvmTraceGenHelper::fill_trace_columns(TraceContainer& trace,
                     clear_events(events.emit_unencrypted_log_events);
                 } });
 
+        // The columns of these subsystems were already filled while simulating if their events were streamed.
+        if (!events_streamed) {
+            auto streamable_jobs = std::vector<std::function<void()>>{
+                [&]() {
+                    BitwiseTraceBuilder bitwise_builder;
+                    AVM_TRACK_TIME("tracegen/bitwise", bitwise_builder.process(events.bitwise, trace));
+                    clear_events(events.bitwise);
+                },
+                [&]() {
+                    FieldGreaterThanTraceBuilder field_gt_builder;
+                    AVM_TRACK_TIME("tracegen/field_gt", field_gt_builder.process(events.field_gt, trace));
+                    clear_events(events.field_gt);
+                },
+                [&]() {
+                    Poseidon2TraceBuilder poseidon2_builder;
+                    AVM_TRACK_TIME("tracegen/poseidon2_hash",
+                                   poseidon2_builder.process_hash(events.poseidon2_hash, trace));
+                    clear_events(events.poseidon2_hash);
+                },
+                [&]() {
+                    Poseidon2TraceBuilder poseidon2_builder;
+                    AVM_TRACK_TIME("tracegen/poseidon2_permutation",
+                                   poseidon2_builder.process_permutation(events.poseidon2_permutation, trace));
+                    clear_events(events.poseidon2_permutation);
+                } };
+            jobs.insert(jobs.end(), streamable_jobs.begin(), streamable_jobs.end());
+        }
+
         AVM_TRACK_TIME("tracegen/traces", execute_jobs(jobs));
     }
 }
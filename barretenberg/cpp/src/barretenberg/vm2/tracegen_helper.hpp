@@ -1,5 +1,8 @@
 #pragma once
 
+#include <cstddef>
+#include <memory>
+
 #include "barretenberg/vm2/common/avm_inputs.hpp"
 #include "barretenberg/vm2/simulation/events/events_container.hpp"
 #include "barretenberg/vm2/tracegen/trace_container.hpp"
@@ -8,17 +11,38 @@ namespace bb::avm2 {
 
 class AvmTraceGenHelper {
   public:
-    AvmTraceGenHelper() = default;
+    static constexpr size_t DEFAULT_STREAMING_BATCH_SIZE = 1 << 12;
+
+    AvmTraceGenHelper();
+    ~AvmTraceGenHelper();
 
     tracegen::TraceContainer generate_trace(simulation::EventsContainer&& events, const PublicInputs& public_inputs);
+    void generate_trace(tracegen::TraceContainer& trace,
+                        simulation::EventsContainer&& events,
+                        const PublicInputs& public_inputs);
     // These are useful for debugging.
     void fill_trace_columns(tracegen::TraceContainer& trace,
                             simulation::EventsContainer&& events,
                             const PublicInputs& public_inputs);
     void fill_trace_interactions(tracegen::TraceContainer& trace);
 
+    // Starts filling the columns of the subsystems whose events can be streamed, each on its own thread. The returned
+    // handlers are to be passed to the simulation, and finish_streaming() called once it has completed. The rest of
+    // the trace is then generated as usual, without the streamed subsystems. The workers write to the trace until
+    // they are joined by finish_streaming() or the destruction of this helper, so the trace must outlive the helper.
+    simulation::EventBatchHandlers start_streaming(tracegen::TraceContainer& trace,
+                                                   size_t batch_size = DEFAULT_STREAMING_BATCH_SIZE);
+    // Waits for the streamed events to be processed.
+    void finish_streaming();
+
     tracegen::TraceContainer generate_precomputed_columns();
     tracegen::TraceContainer generate_public_inputs_columns(const PublicInputs& public_inputs);
+
+  private:
+    class StreamingTraceGen;
+    std::unique_ptr<StreamingTraceGen> streaming;
+    // Whether the columns of the streamed subsystems were filled by the last streaming session.
+    bool streamed = false;
 };
 
 } // namespace bb::avm2
@@ -0,0 +1,92 @@
+#include "barretenberg/vm2/tracegen_helper.hpp"
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+#include "barretenberg/vm2/common/memory_types.hpp"
+#include "barretenberg/vm2/simulation/events/bitwise_event.hpp"
+#include "barretenberg/vm2/simulation/events/event_emitter.hpp"
+#include "barretenberg/vm2/tracegen/bitwise_trace.hpp"
+#include "barretenberg/vm2/tracegen/trace_container.hpp"
+
+namespace bb::avm2 {
+namespace {
+
+using simulation::BitwiseEvent;
+using simulation::EventBatchHandlers;
+using simulation::EventEmitter;
+using tracegen::BitwiseTraceBuilder;
+using tracegen::TraceContainer;
+
+std::vector<BitwiseEvent> make_events(size_t num_events)
+{
+    std::vector<BitwiseEvent> events;
+    for (size_t i = 0; i < num_events; i++) {
+        events.push_back({
+            .operation = BitwiseOperation::AND,
+            .a = MemoryValue::from<uint32_t>(0x52488425),
+            .b = MemoryValue::from<uint32_t>(static_cast<uint32_t>(i)),
+            .res = 0x52488425 & i,
+        });
+    }
+    return events;
+}
+
+// Stands in for the simulation, emitting the events through the streaming handlers.
+void simulate(const EventBatchHandlers& handlers, const std::vector<BitwiseEvent>& events, bool fail)
+{
+    EventEmitter<BitwiseEvent> emitter;
+    emitter.set_batch_handler(handlers.batch_size, handlers.bitwise);
+    for (auto event : events) {
+        emitter.emit(std::move(event));
+    }
+    if (fail) {
+        throw std::runtime_error("simulation failed");
+    }
+    emitter.flush();
+}
+
+TEST(AvmTraceGenHelperTest, StreamedEventsMatchSinglePass)
+{
+    const auto events = make_events(10);
+
+    TraceContainer expected_trace;
+    BitwiseTraceBuilder().process(events, expected_trace);
+
+    TraceContainer trace;
+    AvmTraceGenHelper tracegen_helper;
+    simulate(tracegen_helper.start_streaming(trace, /*batch_size=*/3), events, /*fail=*/false);
+    tracegen_helper.finish_streaming();
+
+    ASSERT_EQ(trace.get_num_rows(), expected_trace.get_num_rows());
+    for (size_t col = 0; col < TraceContainer::num_columns(); ++col) {
+        expected_trace.visit_column(static_cast<Column>(col), [&](uint32_t row, const FF& value) {
+            EXPECT_EQ(trace.get(static_cast<Column>(col), row), value);
+        });
+    }
+}
+
+TEST(AvmTraceGenHelperTest, SimulationThrowsWhileStreaming)
+{
+    const auto events = make_events(100);
+
+    TraceContainer trace;
+    {
+        AvmTraceGenHelper tracegen_helper;
+        EXPECT_THROW(simulate(tracegen_helper.start_streaming(trace, /*batch_size=*/1), events, /*fail=*/true),
+                     std::runtime_error);
+        // finish_streaming() is never called, destroying the helper joins the workers and drops pending batches.
+    }
+
+    // The workers are done with the trace, which only holds whole events. Each u32 event takes 4 rows after row 0.
+    const uint32_t num_rows = trace.get_num_rows();
+    EXPECT_LE(num_rows, 1 + 4 * events.size());
+    if (num_rows > 0) {
+        EXPECT_EQ((num_rows - 1) % 4, 0U);
+    }
+}
+
+} // namespace
+} // namespace bb::avm2
@@ -24,15 +24,21 @@
 #include <optional>
 #include <ostream>
 #include <stdexcept>
+#include <string>
 #include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace bb::world_state {
 
 using namespace bb::crypto::merkle_tree;
 
+namespace {
+const std::string SNAPSHOT_STAGING_DIR = "snapshot_import";
+} // namespace
+
 WorldState::WorldState(uint64_t thread_pool_size,
                        const std::string& data_dir,
                        const std::unordered_map<MerkleTreeId, uint64_t>& map_size,
@@ -183,6 +189,76 @@ void WorldState::copy_stores(const std::string& dstPath, bool compact) const
     std::for_each(_persistentStores->begin(), _persistentStores->end(), copyStore);
 }
 
+lmdblib::SnapshotStats WorldState::export_snapshot(const std::string& dstPath,
+                                                   const lmdblib::SnapshotOptions& options) const
+{
+    // Blocks are committed to each tree in turn, so retry until all of the transactions see the same block
+    const size_t maxAttempts = 100;
+    std::vector<LMDBTreeStore::ReadTransaction::Ptr> txs;
+    for (size_t attempt = 0; txs.empty(); ++attempt) {
+        if (attempt == maxAttempts) {
+            throw std::runtime_error("Unable to export snapshot, trees are not at the same block");
+        }
+        std::optional<block_number_t> blockNumber;
+        for (const auto& store : *_persistentStores) {
+            LMDBTreeStore::ReadTransaction::Ptr tx = store->create_read_transaction();
+            TreeMeta meta;
+            store->read_meta_data(meta, *tx);
+            if (blockNumber.has_value() && blockNumber.value() != meta.unfinalizedBlockHeight) {
+                txs.clear();
+                break;
+            }
+            blockNumber = meta.unfinalizedBlockHeight;
+            txs.push_back(std::move(tx));
+        }
+    }
+
+    lmdblib::SnapshotStats stats;
+    size_t i = 0;
+    for (const auto& store : *_persistentStores) {
+        std::filesystem::path directory = dstPath;
+        directory /= store->get_name();
+        lmdblib::SnapshotOptions storeOptions = options;
+        if (options.baseSnapshotPath.has_value()) {
+            std::filesystem::path base = options.baseSnapshotPath.value();
+            storeOptions.baseSnapshotPath = (base / store->get_name()).string();
+        }
+        stats += store->export_snapshot(directory, storeOptions, *txs[i++]);
+    }
+    return stats;
+}
+
+void WorldState::import_snapshot(const std::string& srcPath,
+                                 const std::string& dataDir,
+                                 const std::unordered_map<MerkleTreeId, uint64_t>& mapSize)
+{
+    // The trees are loaded into a staging directory and only moved into place once all of them are complete. A tree's
+    // meta data is loaded before the rest of its data, so a partially imported tree would otherwise open as valid
+    std::filesystem::path stagingDir = dataDir;
+    stagingDir /= SNAPSHOT_STAGING_DIR;
+    // Left behind by an import that didn't complete
+    std::filesystem::remove_all(stagingDir);
+    std::vector<std::string> names;
+    for (const auto& [id, size] : mapSize) {
+        auto name = getMerkleTreeName(id);
+        std::filesystem::path directory = stagingDir / name;
+        std::filesystem::create_directories(directory);
+        {
+            LMDBTreeStore store(directory, name, size, 1);
+            store.import_snapshot(std::filesystem::path(srcPath) / name);
+        }
+        names.push_back(name);
+    }
+
+    for (const auto& name : names) {
+        std::filesystem::path directory = dataDir;
+        directory /= name;
+        // Fails if the tree's directory already holds data
+        std::filesystem::rename(stagingDir / name, directory);
+    }
+    std::filesystem::remove_all(stagingDir);
+}
+
 Fork::SharedPtr WorldState::retrieve_fork(const uint64_t& forkId) const
 {
     std::unique_lock lock(mtx);
@@ -525,6 +601,12 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     Fork::SharedPtr fork = retrieve_fork(CANONICAL_FORK_ID);
     std::atomic_bool success = true;
     std::string message;
+    if (_groupCommit) {
+        prepare_commit(fork, success, message);
+        if (!success) {
+            return std::make_pair(false, message);
+        }
+    }
     Signal signal(static_cast<uint32_t>(fork->_trees.size()));
 
     {
@@ -561,9 +643,45 @@ std::pair<bool, std::string> WorldState::commit(WorldStateStatusFull& status)
     }
 
     signal.wait_for_level(0);
+    if (_groupCommit) {
+        // Whatever has been written is made durable, even if another tree failed to commit
+        sync_commit(fork, success, message);
+    }
     return std::make_pair(success.load(), message);
 }
 
+void WorldState::prepare_commit(Fork::SharedPtr fork, std::atomic_bool& success, std::string& message)
+{
+    Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    auto callback = [&](const Response& response) {
+        bool expected = true;
+        if (!response.success && success.compare_exchange_strong(expected, false)) {
+            message = response.message;
+        }
+        signal.signal_decrement();
+    };
+    for (auto& [id, tree] : fork->_trees) {
+        std::visit([&callback](auto&& wrapper) { wrapper.tree->prepare_commit(callback); }, tree);
+    }
+    signal.wait_for_level();
+}
+
+void WorldState::sync_commit(Fork::SharedPtr fork, std::atomic_bool& success, std::string& message)
+{
+    Signal signal(static_cast<uint32_t>(fork->_trees.size()));
+    auto callback = [&](const Response& response) {
+        bool expected = true;
+        if (!response.success && success.compare_exchange_strong(expected, false)) {
+            message = response.message;
+        }
+        signal.signal_decrement();
+    };
+    for (auto& [id, tree] : fork->_trees) {
+        std::visit([&callback](auto&& wrapper) { wrapper.tree->sync_commit(callback); }, tree);
+    }
+    signal.wait_for_level();
+}
+
 void WorldState::rollback()
 {
     // NOTE: the calling code is expected to ensure no other reads or writes happen during rollback
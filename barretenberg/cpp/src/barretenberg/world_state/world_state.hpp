@@ -13,6 +13,7 @@
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/lmdblib/lmdb_environment.hpp"
+#include "barretenberg/lmdblib/lmdb_snapshot.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/world_state/fork.hpp"
 #include "barretenberg/world_state/tree_with_store.hpp"
@@ -96,6 +97,30 @@ class WorldState {
      */
     void copy_stores(const std::string& dstPath, bool compact) const;
 
+    /**
+     * @brief Streams a snapshot of the committed state of all trees to the target directory
+     * @details The trees are read through read transactions opened at the same block, so blocks can still be synced
+     * while the snapshot is written. Given a base snapshot taken at an earlier block, only the chunks that have
+     * changed since are written.
+     *
+     * @param dstPath Parent folder where the snapshot of each tree will be written
+     * @param options Chunking and rate limits, the base snapshot path is the parent folder of an earlier snapshot
+     */
+    lmdblib::SnapshotStats export_snapshot(const std::string& dstPath, const lmdblib::SnapshotOptions& options) const;
+
+    /**
+     * @brief Loads a snapshot written by export_snapshot into a new data directory for a world state to be opened on
+     * @details The trees are loaded into a staging directory within dataDir and moved into place once all of them have
+     * been loaded, so an interrupted import never leaves a tree that opens with part of its data missing.
+     *
+     * @param srcPath Parent folder of the snapshot
+     * @param dataDir Data directory, must not hold any trees
+     * @param mapSize Map size of each tree's store
+     */
+    static void import_snapshot(const std::string& srcPath,
+                                const std::string& dataDir,
+                                const std::unordered_map<MerkleTreeId, uint64_t>& mapSize);
+
     /**
      * @brief Get tree metadata for a particular tree
      *
@@ -264,9 +289,32 @@ class WorldState {
 
     /**
      * @brief Commits the current state of the world state.
+     * @details In group commit mode each tree's data pages are flushed as it is written, but the flush of its meta data
+     * is deferred until each tree's environment is synced once all of them have been written. A crash before those
+     * syncs complete loses at most this commit for the trees that were not yet synced.
      */
     std::pair<bool, std::string> commit(WorldStateStatusFull& status);
 
+    /**
+     * @brief Sets whether commits are made as a group across the trees
+     * @details In group commit mode all trees first serialise their changes concurrently, nothing is written unless
+     * all of them succeed. The prepared writes are then applied with the meta data flush of each tree's environment
+     * deferred until every tree has been written, see commit. Must not be changed while a commit is in progress.
+     */
+    void set_group_commit(bool groupCommit) { _groupCommit = groupCommit; }
+
+    /**
+     * @brief Sets how many levels below the root of each tree are stored with every committed block
+     * @details Historical sibling paths and leaves of those blocks then start their traversal below the stored levels.
+     * Applies to blocks committed from now on, 0 (the default) stores nothing.
+     */
+    void set_historical_upper_node_levels(uint32_t levels)
+    {
+        for (const auto& store : *_persistentStores) {
+            store->set_upper_node_levels(levels);
+        }
+    }
+
     /**
      * @brief Rolls back any uncommitted changes made to the world state.
      */
@@ -303,6 +351,7 @@ class WorldState {
     std::unordered_map<uint64_t, Fork::SharedPtr> _forks;
     uint64_t _forkId = 0;
     uint32_t _initial_header_generator_point;
+    bool _groupCommit = false;
 
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
     void create_canonical_fork(const std::string& dataDir,
@@ -343,6 +392,9 @@ class WorldState {
 
     static void populate_status_summary(WorldStateStatusFull& status);
 
+    void prepare_commit(Fork::SharedPtr fork, std::atomic_bool& success, std::string& message);
+    void sync_commit(Fork::SharedPtr fork, std::atomic_bool& success, std::string& message);
+
     template <typename TreeType>
     void commit_tree(TreeDBStats& dbStats,
                      Signal& signal,
@@ -378,7 +430,7 @@ void WorldState::commit_tree(TreeDBStats& dbStats,
                              std::string& message,
                              TreeMeta& meta)
 {
-    tree.commit([&](TypedResponse<CommitResponse>& response) {
+    auto callback = [&](TypedResponse<CommitResponse>& response) {
         bool expected = true;
         if (!response.success && success.compare_exchange_strong(expected, false)) {
             message = response.message;
@@ -386,7 +438,12 @@ void WorldState::commit_tree(TreeDBStats& dbStats,
         dbStats = std::move(response.inner.stats);
         meta = std::move(response.inner.meta);
         signal.signal_decrement();
-    });
+    };
+    if (_groupCommit) {
+        tree.commit_prepared(true, callback);
+    } else {
+        tree.commit(callback);
+    }
 }
 
 template <typename TreeType>
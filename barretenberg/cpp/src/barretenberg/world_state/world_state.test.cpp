@@ -1,4 +1,5 @@
 #include "barretenberg/world_state/world_state.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/crypto/merkle_tree/fixtures.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/node_store/tree_meta.hpp"
@@ -8,12 +9,14 @@
 #include "barretenberg/world_state/fork.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include <array>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
 #include <gtest/gtest.h>
 #include <optional>
 #include <stdexcept>
 #include <sys/types.h>
+#include <thread>
 #include <unordered_map>
 
 using namespace bb::world_state;
@@ -574,6 +577,160 @@ TEST_F(WorldStateTest, CommitsAndRollsBackAllTrees)
         ws, WorldStateRevision::committed(), MerkleTreeId::PUBLIC_DATA_TREE, PublicDataLeafValue(143, 1), false);
 }
 
+namespace {
+void append_block(WorldState& ws, size_t block, size_t num_leaves)
+{
+    std::vector<fr> notes;
+    std::vector<NullifierLeafValue> nullifiers;
+    std::vector<PublicDataLeafValue> public_writes;
+    for (size_t i = 0; i < num_leaves; ++i) {
+        const fr value(1000 + (block * num_leaves) + i);
+        notes.emplace_back(value);
+        nullifiers.emplace_back(value);
+        public_writes.emplace_back(value, block);
+    }
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, notes);
+    ws.append_leaves<fr>(MerkleTreeId::L1_TO_L2_MESSAGE_TREE, notes);
+    ws.append_leaves<fr>(MerkleTreeId::ARCHIVE, { fr(block) });
+    ws.batch_insert_indexed_leaves<NullifierLeafValue>(MerkleTreeId::NULLIFIER_TREE, nullifiers, 0);
+    ws.batch_insert_indexed_leaves<PublicDataLeafValue>(MerkleTreeId::PUBLIC_DATA_TREE, public_writes, 0);
+}
+
+void assert_same_db_contents(const TreeDBStats& stats, const TreeDBStats& expected)
+{
+    EXPECT_EQ(stats.blocksDBStats.numDataItems, expected.blocksDBStats.numDataItems);
+    EXPECT_EQ(stats.nodesDBStats.numDataItems, expected.nodesDBStats.numDataItems);
+    EXPECT_EQ(stats.leafPreimagesDBStats.numDataItems, expected.leafPreimagesDBStats.numDataItems);
+    EXPECT_EQ(stats.leafIndicesDBStats.numDataItems, expected.leafIndicesDBStats.numDataItems);
+    EXPECT_EQ(stats.blockIndicesDBStats.numDataItems, expected.blockIndicesDBStats.numDataItems);
+}
+} // namespace
+
+TEST_F(WorldStateTest, GroupCommitMatchesSequentialCommit)
+{
+    std::string group_data_dir = random_temp_directory();
+    std::filesystem::create_directories(group_data_dir);
+    WorldStateMeta committed_meta;
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        WorldState group_ws(
+            thread_pool_size, group_data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        group_ws.set_group_commit(true);
+
+        for (size_t block = 1; block <= 3; ++block) {
+            append_block(ws, block, 4);
+            append_block(group_ws, block, 4);
+
+            WorldStateStatusFull status;
+            WorldStateStatusFull group_status;
+            EXPECT_TRUE(ws.commit(status).first);
+            EXPECT_TRUE(group_ws.commit(group_status).first);
+
+            EXPECT_EQ(group_status.meta, status.meta);
+            assert_same_db_contents(group_status.dbStats.noteHashTreeStats, status.dbStats.noteHashTreeStats);
+            assert_same_db_contents(group_status.dbStats.messageTreeStats, status.dbStats.messageTreeStats);
+            assert_same_db_contents(group_status.dbStats.archiveTreeStats, status.dbStats.archiveTreeStats);
+            assert_same_db_contents(group_status.dbStats.publicDataTreeStats, status.dbStats.publicDataTreeStats);
+            assert_same_db_contents(group_status.dbStats.nullifierTreeStats, status.dbStats.nullifierTreeStats);
+            committed_meta = group_status.meta;
+        }
+        assert_leaf_value(group_ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, 3, fr(3));
+    }
+    {
+        // The commits were made durable, reopening gives the same state
+        WorldState ws(
+            thread_pool_size, group_data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        EXPECT_EQ(ws.get_tree_info(WorldStateRevision::committed(), MerkleTreeId::NULLIFIER_TREE).meta,
+                  committed_meta.nullifierTreeMeta);
+        EXPECT_EQ(ws.get_tree_info(WorldStateRevision::committed(), MerkleTreeId::ARCHIVE).meta,
+                  committed_meta.archiveTreeMeta);
+    }
+    std::filesystem::remove_all(group_data_dir);
+}
+
+TEST_F(WorldStateTest, GroupCommitLatency)
+{
+    constexpr size_t num_blocks = 16;
+    constexpr size_t leaves_per_block = 64;
+    for (bool group_commit : { false, true }) {
+        std::string dir = random_temp_directory();
+        std::filesystem::create_directories(dir);
+        {
+            WorldState ws(4, dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+            ws.set_group_commit(group_commit);
+            std::chrono::nanoseconds total{ 0 };
+            for (size_t block = 1; block <= num_blocks; ++block) {
+                append_block(ws, block, leaves_per_block);
+                WorldStateStatusFull status;
+                auto start = std::chrono::steady_clock::now();
+                EXPECT_TRUE(ws.commit(status).first);
+                total += std::chrono::steady_clock::now() - start;
+            }
+            info(group_commit ? "group" : "sequential",
+                 " commit: ",
+                 std::chrono::duration_cast<std::chrono::microseconds>(total).count() / num_blocks,
+                 "us per block");
+        }
+        std::filesystem::remove_all(dir);
+    }
+}
+
+TEST_F(WorldStateTest, ExportAndImportSnapshot)
+{
+    std::string snapshot_dir = random_temp_directory();
+    std::string import_dir = random_temp_directory();
+    {
+        WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        append_block(ws, 1, 4);
+        WorldStateStatusFull status;
+        EXPECT_TRUE(ws.commit(status).first);
+
+        // Blocks committed during the export are committed to each tree in turn, the export must still read all of
+        // the trees at the same block
+        std::thread committer([&]() {
+            for (size_t block = 2; block <= 8; ++block) {
+                append_block(ws, block, 4);
+                WorldStateStatusFull block_status;
+                EXPECT_TRUE(ws.commit(block_status).first);
+            }
+        });
+        lmdblib::SnapshotStats stats = ws.export_snapshot(snapshot_dir, {});
+        committer.join();
+        EXPECT_GT(stats.numEntries, 0);
+    }
+
+    std::unordered_map<MerkleTreeId, uint64_t> map_sizes;
+    for (const auto& [id, height] : tree_heights) {
+        map_sizes[id] = map_size;
+    }
+    WorldState::import_snapshot(snapshot_dir, import_dir, map_sizes);
+    EXPECT_FALSE(std::filesystem::exists(std::filesystem::path(import_dir) / "snapshot_import"));
+
+    {
+        WorldState ws(
+            thread_pool_size, import_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
+        block_number_t block =
+            ws.get_tree_info(WorldStateRevision::committed(), MerkleTreeId::ARCHIVE).meta.unfinalizedBlockHeight;
+        EXPECT_GE(block, 1);
+        EXPECT_LE(block, 8);
+        for (const auto& [id, height] : tree_heights) {
+            EXPECT_EQ(ws.get_tree_info(WorldStateRevision::committed(), id).meta.unfinalizedBlockHeight, block);
+        }
+        assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, block, fr(block));
+        assert_leaf_exists(
+            ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, fr(1000 + (block * 4)), true);
+
+        // The restored state can be built on
+        append_block(ws, block + 1, 4);
+        WorldStateStatusFull status;
+        EXPECT_TRUE(ws.commit(status).first);
+        assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, block + 1, fr(block + 1));
+    }
+
+    std::filesystem::remove_all(snapshot_dir);
+    std::filesystem::remove_all(import_dir);
+}
+
 TEST_F(WorldStateTest, SyncExternalBlockFromEmpty)
 {
     WorldState ws(thread_pool_size, data_dir, map_size, tree_heights, tree_prefill, initial_header_generator_point);
@@ -6,6 +6,8 @@ import { isAnyArrayBuffer } from 'util/types';
 
 export interface MessageReceiver {
   call(msg: Buffer | Uint8Array): Promise<Buffer | Uint8Array>;
+  /** Handles an encoded array of messages concurrently, resolving with the response or error for each message */
+  callBatch?(msgs: Buffer | Uint8Array): Promise<(Buffer | Uint8Array | Error)[]>;
 }
 
 export type RoundtripDuration = {
@@ -67,6 +69,70 @@ export class MsgpackChannel<
     const callEnd = process.hrtime.bigint();
     duration.callUs = Number((callEnd - encodingEnd) / 1000n);
 
+    const response = this.decodeResponse(request, encodedResponse);
+    const decodingEnd = process.hrtime.bigint();
+    duration.decodingUs = Number((decodingEnd - callEnd) / 1000n);
+
+    duration.totalUs = Number((process.hrtime.bigint() - start) / 1000n);
+
+    return { duration, response: response.value };
+  }
+
+  /**
+   * Sends several messages of the same type in a single call. The messages are handled concurrently, so they must not
+   * depend on each other. Throws the first error if any of the messages fails.
+   */
+  public async sendMessages<T extends M>(
+    msgType: T,
+    bodies: Req[T][],
+  ): Promise<{ duration: RoundtripDuration; responses: Resp[T][] }> {
+    if (!this.dest.callBatch) {
+      throw new Error('Message receiver does not support batches');
+    }
+
+    const duration: RoundtripDuration = {
+      callUs: 0,
+      totalUs: 0,
+      decodingUs: 0,
+      encodingUs: 0,
+    };
+
+    const start = process.hrtime.bigint();
+    const requests = bodies.map(
+      body => new TypedMessage(msgType, new MessageHeader({ requestId: this.msgId++ }), body),
+    );
+    const encodedRequests = this.encoder.encode(requests);
+    const encodingEnd = process.hrtime.bigint();
+    duration.encodingUs = Number((encodingEnd - start) / 1000n);
+
+    const encodedResponses = await this.dest.callBatch(encodedRequests);
+    const callEnd = process.hrtime.bigint();
+    duration.callUs = Number((callEnd - encodingEnd) / 1000n);
+
+    if (encodedResponses.length !== requests.length) {
+      throw new Error(
+        'Invalid batch response: expected ' + requests.length + ' responses, got ' + encodedResponses.length,
+      );
+    }
+
+    const responses = encodedResponses.map((encodedResponse, i) => {
+      if (encodedResponse instanceof Error) {
+        throw encodedResponse;
+      }
+      return this.decodeResponse(requests[i], encodedResponse).value;
+    });
+    const decodingEnd = process.hrtime.bigint();
+    duration.decodingUs = Number((decodingEnd - callEnd) / 1000n);
+
+    duration.totalUs = Number((process.hrtime.bigint() - start) / 1000n);
+
+    return { duration, responses };
+  }
+
+  private decodeResponse<T extends M>(
+    request: TypedMessage<T, Req[T]>,
+    encodedResponse: Buffer | Uint8Array,
+  ): TypedMessage<T, Resp[T]> {
     const buf = Buffer.isBuffer(encodedResponse)
       ? encodedResponse
       : isAnyArrayBuffer(encodedResponse)
@@ -89,8 +155,6 @@ export class MsgpackChannel<
     }
 
     const response = TypedMessage.fromMessagePack<T, Resp[T]>(decodedResponse);
-    const decodingEnd = process.hrtime.bigint();
-    duration.decodingUs = Number((decodingEnd - callEnd) / 1000n);
 
     if (response.header.requestId !== request.header.messageId) {
       throw new Error(
@@ -102,8 +166,6 @@ export class MsgpackChannel<
       throw new Error('Invalid response message type: ' + response.msgType + ' != ' + response.msgType);
     }
 
-    duration.totalUs = Number((process.hrtime.bigint() - start) / 1000n);
-
-    return { duration, response: response.value };
+    return response;
   }
 }
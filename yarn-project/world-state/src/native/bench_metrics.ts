@@ -31,10 +31,16 @@ type DataRetrievalMetrics = {
   value: number;
 };
 
+type RoundTripMetrics = {
+  batchSize: number;
+  value: number;
+};
+
 export class NativeBenchMetics {
   private blockSyncMetrics: BlockSyncMetrics[] = [];
   private insertionMetrics: InsertionMetrics[] = [];
   private dataRetrievalMetrics: DataRetrievalMetrics[] = [];
+  private roundTripMetrics: RoundTripMetrics[] = [];
 
   public toPrettyString() {
     let pretty = '';
@@ -50,6 +56,10 @@ export class NativeBenchMetics {
     for (const metric of this.dataRetrievalMetrics) {
       pretty += `  ${DataRetrievalType[metric.retrievalType]}: ${metric.value} us\n`;
     }
+    pretty += `Round trip metrics:\n`;
+    for (const metric of this.roundTripMetrics) {
+      pretty += `  batches of ${metric.batchSize}: ${metric.value} us per message\n`;
+    }
     return pretty;
   }
 
@@ -62,6 +72,9 @@ export class NativeBenchMetics {
   public addDataRetrievalMetric(retrievalType: DataRetrievalType, value: number) {
     this.dataRetrievalMetrics.push({ retrievalType, value: value });
   }
+  public addRoundTripMetric(batchSize: number, value: number) {
+    this.roundTripMetrics.push({ batchSize, value });
+  }
 
   public toGithubActionBenchmarkJSON(indent = 2) {
     const data = [];
@@ -86,6 +99,13 @@ export class NativeBenchMetics {
         unit: 'us',
       });
     }
+    for (const roundTrip of this.roundTripMetrics) {
+      data.push({
+        name: `Round Trip/${roundTrip.batchSize} messages per batch`,
+        value: roundTrip.value,
+        unit: 'us',
+      });
+    }
     return JSON.stringify(data, null, indent);
   }
 }
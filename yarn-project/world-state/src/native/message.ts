@@ -45,6 +45,7 @@ export enum WorldStateMessageType {
   REVERT_ALL_CHECKPOINTS,
 
   COPY_STORES,
+  EXPORT_SNAPSHOT,
 
   CLOSE = 999,
 }
@@ -281,7 +282,7 @@ interface WithForkId {
   forkId: number;
 }
 
-interface WithWorldStateRevision {
+export interface WithWorldStateRevision {
   revision: WorldStateRevision;
 }
 
@@ -433,6 +434,21 @@ interface CopyStoresRequest extends WithCanonicalForkId {
   compact: boolean;
 }
 
+interface ExportSnapshotRequest extends WithCanonicalForkId {
+  dstPath: string;
+  /** An earlier snapshot, only the data changed since it was taken is written */
+  baseSnapshotPath?: string;
+  chunkSize?: number;
+  maxBytesPerSecond?: number;
+}
+
+export interface SnapshotStats {
+  numEntries: bigint | number;
+  chunksWritten: bigint | number;
+  chunksReused: bigint | number;
+  bytesWritten: bigint | number;
+}
+
 export type WorldStateRequestCategories = WithForkId | WithWorldStateRevision | WithCanonicalForkId;
 
 export function isWithForkId(body: WorldStateRequestCategories): body is WithForkId {
@@ -488,6 +504,7 @@ export type WorldStateRequest = {
   [WorldStateMessageType.REVERT_ALL_CHECKPOINTS]: WithForkId;
 
   [WorldStateMessageType.COPY_STORES]: CopyStoresRequest;
+  [WorldStateMessageType.EXPORT_SNAPSHOT]: ExportSnapshotRequest;
 
   [WorldStateMessageType.CLOSE]: WithCanonicalForkId;
 };
@@ -533,6 +550,7 @@ export type WorldStateResponse = {
   [WorldStateMessageType.REVERT_ALL_CHECKPOINTS]: void;
 
   [WorldStateMessageType.COPY_STORES]: void;
+  [WorldStateMessageType.EXPORT_SNAPSHOT]: SnapshotStats;
 
   [WorldStateMessageType.CLOSE]: void;
 };
@@ -1,20 +1,28 @@
-import { MAX_NOTE_HASHES_PER_TX, MAX_NULLIFIERS_PER_TX } from '@aztec/constants';
+import {
+  MAX_NOTE_HASHES_PER_TX,
+  MAX_NULLIFIERS_PER_TX,
+  MAX_TOTAL_PUBLIC_DATA_UPDATE_REQUESTS_PER_TX,
+} from '@aztec/constants';
 import { padArrayEnd } from '@aztec/foundation/collection';
 import { EthAddress } from '@aztec/foundation/eth-address';
 import { Fr } from '@aztec/foundation/fields';
 import { createLogger } from '@aztec/foundation/log';
 import { L2Block } from '@aztec/stdlib/block';
 import { type IndexedTreeId, MerkleTreeId, type MerkleTreeReadOperations } from '@aztec/stdlib/trees';
+import { getTelemetryClient } from '@aztec/telemetry-client';
 
 import { jest } from '@jest/globals';
 import { mkdir, mkdtemp, rm, writeFile } from 'fs/promises';
 import { tmpdir } from 'os';
 import path, { join } from 'path';
 
+import { WorldStateInstrumentation } from '../instrumentation/instrumentation.js';
 import type { WorldStateTreeMapSizes } from '../synchronizer/factory.js';
 import { mockBlock } from '../test/utils.js';
 import { DataRetrievalType, InsertionType, NativeBenchMetics } from './bench_metrics.js';
+import { WorldStateMessageType, worldStateRevision } from './message.js';
 import { NativeWorldStateService } from './native_world_state.js';
+import { NativeWorldState } from './native_world_state_instance.js';
 
 jest.setTimeout(300_000);
 
@@ -285,4 +293,39 @@ describe('Native World State: benchmarks', () => {
     );
     metrics.addDataRetrievalMetric(DataRetrievalType.LOW_LEAF, duration * 1000);
   });
+
+  it.each([1, 16, 64])('Round trips leaf value requests in batches of %s', async (batchSize: number) => {
+    // Talk to the native module directly so that only the message path is measured
+    const instanceDir = join(dataDir, 'round-trip');
+    await mkdir(instanceDir, { recursive: true });
+    const instance = new NativeWorldState(
+      instanceDir,
+      wsTreeMapSizes,
+      [],
+      new WorldStateInstrumentation(getTelemetryClient()),
+    );
+    // The public data tree is prefilled, so there are leaves to read without syncing any blocks
+    const numPrefilled = 2 * MAX_TOTAL_PUBLIC_DATA_UPDATE_REQUESTS_PER_TX;
+    const numRequests = 1024;
+    const requests = Array.from({ length: numRequests }, () => ({
+      treeId: MerkleTreeId.PUBLIC_DATA_TREE,
+      revision: worldStateRevision(false, 0, 0),
+      leafIndex: BigInt(Math.floor(Math.random() * numPrefilled)),
+    }));
+
+    const startTime = performance.now();
+
+    for (let i = 0; i < numRequests; i += batchSize) {
+      const batch = requests.slice(i, i + batchSize);
+      if (batchSize === 1) {
+        await instance.call(WorldStateMessageType.GET_LEAF_VALUE, batch[0]);
+      } else {
+        await instance.callBatch(WorldStateMessageType.GET_LEAF_VALUE, batch);
+      }
+    }
+
+    const endTime = performance.now();
+    await instance.close();
+    metrics.addRoundTripMetric(batchSize, ((endTime - startTime) * 1000) / numRequests);
+  });
 });
@@ -26,6 +26,7 @@ import type { WorldStateTreeMapSizes } from '../synchronizer/factory.js';
 import type { MerkleTreeAdminDatabase as MerkleTreeDatabase } from '../world-state-db/merkle_tree_db.js';
 import { MerkleTreesFacade, MerkleTreesForkFacade, serializeLeaf } from './merkle_trees_facade.js';
 import {
+  type SnapshotStats,
   WorldStateMessageType,
   type WorldStateStatusFull,
   type WorldStateStatusSummary,
@@ -345,6 +346,17 @@ export class NativeWorldStateService implements MerkleTreeDatabase {
     });
     return fromEntries(NATIVE_WORLD_STATE_DBS.map(([name, dir]) => [name, join(dstPath, dir, 'data.mdb')] as const));
   }
+
+  /**
+   * Streams a snapshot of the committed trees to dstPath without blocking block sync. Given the path of an earlier
+   * snapshot, only the data that changed since it was taken is written.
+   */
+  public exportSnapshot(
+    dstPath: string,
+    opts: { baseSnapshotPath?: string; chunkSize?: number; maxBytesPerSecond?: number } = {},
+  ): Promise<SnapshotStats> {
+    return this.instance.call(WorldStateMessageType.EXPORT_SNAPSHOT, { dstPath, ...opts, canonical: true });
+  }
 }
 
 // The following paths are defined in cpp-land
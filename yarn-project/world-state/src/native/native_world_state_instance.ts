@@ -21,13 +21,14 @@ import type { WorldStateTreeMapSizes } from '../synchronizer/factory.js';
 import {
   WorldStateMessageType,
   type WorldStateRequest,
+  type WithWorldStateRevision,
   type WorldStateRequestCategories,
   type WorldStateResponse,
   isWithCanonical,
   isWithForkId,
   isWithRevision,
 } from './message.js';
-import { WorldStateOpsQueue } from './world_state_ops_queue.js';
+import { MUTATING_MSG_TYPES, WorldStateOpsQueue } from './world_state_ops_queue.js';
 
 const MAX_WORLD_STATE_THREADS = +(process.env.HARDWARE_CONCURRENCY || '16');
 
@@ -176,6 +177,60 @@ export class NativeWorldState implements NativeWorldStateInstance {
     return response;
   }
 
+  /**
+   * Sends several read requests of the same type to the native instance in a single call. The requests are decoded and
+   * handled concurrently by the native instance, saving a round trip per request.
+   * @param messageType - The type of the messages to send, must not be a mutating message
+   * @param bodies - The message bodies, all reading the same revision
+   * @returns The responses, in the order of the requests
+   */
+  public async callBatch<T extends WorldStateMessageType>(
+    messageType: T,
+    bodies: (WorldStateRequest[T] & WithWorldStateRevision)[],
+  ): Promise<WorldStateResponse[T][]> {
+    assert.equal(MUTATING_MSG_TYPES.has(messageType), false, 'Only read requests can be batched');
+    if (bodies.length === 0) {
+      return [];
+    }
+
+    const revision = bodies[0].revision;
+    for (const body of bodies) {
+      assert.equal(body.revision.forkId, revision.forkId, 'Batched requests must read the same fork');
+      assert.equal(
+        body.revision.includeUncommitted,
+        revision.includeUncommitted,
+        'Batched requests must all include or exclude uncommitted state',
+      );
+    }
+
+    let requestQueue = this.queues.get(revision.forkId);
+    if (requestQueue === undefined) {
+      requestQueue = new WorldStateOpsQueue();
+      this.queues.set(revision.forkId, requestQueue);
+    }
+
+    return await requestQueue.execute(
+      async () => {
+        assert.equal(this.open, true, 'Native instance is closed');
+        try {
+          const { duration, responses } = await this.instance.sendMessages(messageType, bodies);
+          this.log.trace(`Batched call ${WorldStateMessageType[messageType]} took (ms)`, {
+            duration,
+            count: bodies.length,
+            ...revision,
+          });
+          this.instrumentation.recordRoundTrip(duration.totalUs, messageType);
+          return responses;
+        } catch (error) {
+          this.log.error(`Batched call ${WorldStateMessageType[messageType]} failed: ${error}`, error, revision);
+          throw error;
+        }
+      },
+      messageType,
+      revision.includeUncommitted === false,
+    );
+  }
+
   /**
    * Stops the native instance.
    */